@@ -0,0 +1,9 @@
+#ifndef GSTD_ALGORITHM_H
+#define GSTD_ALGORITHM_H
+
+#include <gstd/Algorithm/Hash.h>
+#include <gstd/Algorithm/Search.h>
+#include <gstd/Algorithm/Simd.h>
+#include <gstd/Algorithm/Sort.h>
+
+#endif //GSTD_ALGORITHM_H
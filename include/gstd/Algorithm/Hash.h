@@ -0,0 +1,79 @@
+#ifndef GSTD_HASH_H
+#define GSTD_HASH_H
+
+#include <bit>
+#include <cstring>
+#include <type_traits>
+
+#include <gstd/Type/Types.h>
+
+namespace gstd {
+
+    namespace detail {
+
+        inline constexpr std::uint64_t HashSeedValue = 0x9e3779b97f4a7c15ull;
+
+        inline constexpr std::uint64_t HashFirstFactorValue = 0xbf58476d1ce4e5b9ull;
+
+        inline constexpr std::uint64_t HashSecondFactorValue = 0x94d049bb133111ebull;
+
+        /**
+         * Loading up to 8 bytes as little-endian word, so hash doesn`t depend on platform and constant evaluation
+         */
+        GSTD_CONSTEXPR auto LoadHashWord(const char *data,
+                                         std::uint64_t size) GSTD_NOEXCEPT -> std::uint64_t {
+            std::uint64_t word = 0;
+
+            if (std::is_constant_evaluated() || std::endian::native != std::endian::little || size != 8) {
+                for (std::uint64_t index = 0; index < size; ++index) {
+                    word |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(data[index])) << (index * 8);
+                }
+            } else {
+                std::memcpy(&word,
+                            data,
+                            sizeof(std::uint64_t));
+            }
+
+            return word;
+        }
+
+        GSTD_CONSTEXPR auto HashStep(std::uint64_t hash,
+                                     std::uint64_t word) GSTD_NOEXCEPT -> std::uint64_t {
+            return std::rotl(hash ^ (word * HashFirstFactorValue), 31) * HashSecondFactorValue;
+        }
+
+        GSTD_CONSTEXPR auto HashFinish(std::uint64_t hash) GSTD_NOEXCEPT -> std::uint64_t {
+            hash ^= hash >> 32;
+            hash *= HashFirstFactorValue;
+            hash ^= hash >> 29;
+            hash *= HashSecondFactorValue;
+            hash ^= hash >> 32;
+
+            return hash;
+        }
+
+        /**
+         * Hashing bytes by words of 8 bytes. Hash is same in constant evaluation and at runtime
+         */
+        GSTD_CONSTEXPR auto HashBytes(const char *data,
+                                      std::uint64_t size) GSTD_NOEXCEPT -> std::uint64_t {
+            auto hash = HashSeedValue ^ size;
+
+            for (; size >= 8; data += 8, size -= 8) {
+                hash = HashStep(hash,
+                                LoadHashWord(data, 8));
+            }
+
+            if (size != 0) {
+                hash = HashStep(hash,
+                                LoadHashWord(data, size));
+            }
+
+            return HashFinish(hash);
+        }
+
+    }
+
+}
+
+#endif //GSTD_HASH_H
@@ -0,0 +1,289 @@
+#ifndef GSTD_SEARCH_H
+#define GSTD_SEARCH_H
+
+#include <functional>
+
+#include <gstd/Algorithm/Simd.h>
+
+namespace gstd {
+
+    namespace detail {
+
+        /**
+         * Count of elements, that remained after binary search and counted by linear scan
+         */
+        inline constexpr std::uint64_t SearchScanValue = 16;
+
+        /**
+         * Count of searches, that interleaved in batched search
+         */
+        inline constexpr std::uint64_t SearchBatchValue = 16;
+
+        /**
+         * Checking, if search can be dispatched to SIMD kernels
+         */
+        template<typename ValueT,
+                 typename KeyT,
+                 typename CompareT>
+        inline constexpr bool IsSimdSearchV = std::is_arithmetic_v<ValueT>
+                                              && std::is_same_v<ValueT, KeyT>
+                                              && (std::is_same_v<CompareT, std::less<>>
+                                                  || std::is_same_v<CompareT, std::less<ValueT>>);
+
+        /**
+         * Narrowing range with binary search without branches, until `SearchScanValue` elements remain
+         * @return Start of range, that contains searched position
+         */
+        template<typename ValueT,
+                 typename KeyT,
+                 typename PredicateT>
+        GSTD_FORCEINLINE auto BranchlessNarrow(const ValueT *data,
+                                               std::uint64_t size,
+                                               const KeyT &key,
+                                               const PredicateT &predicate) -> const ValueT * {
+            auto base = data;
+
+            while (size > SearchScanValue) {
+                auto half = size / 2;
+
+                GSTD_PREFETCH(base + half / 2);
+                GSTD_PREFETCH(base + half + half / 2);
+
+                base = predicate(base[half], key) ? base + half : base;
+                size -= half;
+            }
+
+            return base;
+        }
+
+        /**
+         * Counting elements in final range. Elements before range satisfy predicate and elements after it don`t,
+         * so fixed-size window, that contains range, is counted with vectorized loop
+         * @return Searched position
+         */
+        template<typename ValueT,
+                 typename KeyT,
+                 typename PredicateT>
+        GSTD_FORCEINLINE auto LinearScan(const ValueT *data,
+                                         std::uint64_t size,
+                                         const ValueT *base,
+                                         const KeyT &key,
+                                         const PredicateT &predicate) -> std::uint64_t {
+            std::uint64_t count = 0;
+
+            if (size < SearchScanValue) {
+                for (std::uint64_t index = 0; index < size; ++index) {
+                    count += predicate(data[index], key) ? 1 : 0;
+                }
+
+                return count;
+            }
+
+            auto start = base < data + (size - SearchScanValue) ? base : data + (size - SearchScanValue);
+
+            for (std::uint64_t index = 0; index < SearchScanValue; ++index) {
+                count += predicate(start[index], key) ? 1 : 0;
+            }
+
+            return static_cast<std::uint64_t>(start - data) + count;
+        }
+
+        /**
+         * Finding first element, that doesn`t satisfy predicate. Elements, that satisfy predicate, must precede others
+         */
+        template<typename ValueT,
+                 typename KeyT,
+                 typename PredicateT>
+        GSTD_FORCEINLINE auto PartitionPoint(const ValueT *data,
+                                             std::uint64_t size,
+                                             const KeyT &key,
+                                             const PredicateT &predicate) -> std::uint64_t {
+            return LinearScan(data,
+                              size,
+                              BranchlessNarrow(data, size, key, predicate),
+                              key,
+                              predicate);
+        }
+
+        template<typename ValueT,
+                 typename KeyT,
+                 typename CompareT,
+                 typename PredicateT>
+        auto DispatchPartitionPoint(const ValueT *data,
+                                    std::uint64_t size,
+                                    const KeyT &key,
+                                    const PredicateT &predicate) -> std::uint64_t {
+            if GSTD_CONSTEXPR (IsSimdSearchV<ValueT, KeyT, CompareT>) {
+                return SimdDispatch([data, size, &key, &predicate] () -> std::uint64_t {
+                    return PartitionPoint(data, size, key, predicate);
+                });
+            } else {
+                return PartitionPoint(data, size, key, predicate);
+            }
+        }
+
+    }
+
+    /**
+     * Finding first element, that is not less than key, in sorted elements<br>
+     * Binary search is branchless with prefetching of both next candidates, last elements are counted by linear scan
+     * @tparam ValueT Value type
+     * @tparam KeyT Key type
+     * @tparam CompareT Comparator type
+     * @param span Sorted elements
+     * @param key Key
+     * @param compare Comparator
+     * @return Index of first element, that is not less than key, or size of span
+     */
+    template<typename ValueT,
+             typename KeyT,
+             typename CompareT = std::less<>>
+    auto LowerBound(Span<ValueT> span,
+                    const KeyT &key,
+                    CompareT compare = CompareT()) -> std::uint64_t {
+        using ValueType = std::remove_cv_t<ValueT>;
+
+        return detail::DispatchPartitionPoint<ValueType,
+                                              KeyT,
+                                              CompareT>(span.Data(),
+                                                        span.Size(),
+                                                        key,
+                                                        [&compare] (const ValueType &element,
+                                                                    const KeyT &value) -> bool {
+            return compare(element, value);
+        });
+    }
+
+    /**
+     * Finding first element, that is greater than key, in sorted elements
+     * @tparam ValueT Value type
+     * @tparam KeyT Key type
+     * @tparam CompareT Comparator type
+     * @param span Sorted elements
+     * @param key Key
+     * @param compare Comparator
+     * @return Index of first element, that is greater than key, or size of span
+     */
+    template<typename ValueT,
+             typename KeyT,
+             typename CompareT = std::less<>>
+    auto UpperBound(Span<ValueT> span,
+                    const KeyT &key,
+                    CompareT compare = CompareT()) -> std::uint64_t {
+        using ValueType = std::remove_cv_t<ValueT>;
+
+        return detail::DispatchPartitionPoint<ValueType,
+                                              KeyT,
+                                              CompareT>(span.Data(),
+                                                        span.Size(),
+                                                        key,
+                                                        [&compare] (const ValueType &element,
+                                                                    const KeyT &value) -> bool {
+            return !compare(value, element);
+        });
+    }
+
+    /**
+     * Finding range of elements, that equal to key, in sorted elements
+     * @tparam ValueT Value type
+     * @tparam KeyT Key type
+     * @tparam CompareT Comparator type
+     * @param span Sorted elements
+     * @param key Key
+     * @param compare Comparator
+     * @return Pair of lower and upper bounds
+     */
+    template<typename ValueT,
+             typename KeyT,
+             typename CompareT = std::less<>>
+    auto EqualRange(Span<ValueT> span,
+                    const KeyT &key,
+                    CompareT compare = CompareT()) -> Pair<std::uint64_t, std::uint64_t> {
+        auto lower = LowerBound(span,
+                                key,
+                                compare);
+        auto upper = lower + UpperBound(Span<ValueT>(span.Data() + lower, span.Size() - lower),
+                                        key,
+                                        compare);
+
+        return MakePair(std::move(lower),
+                        std::move(upper));
+    }
+
+    /**
+     * Finding lower bounds of many keys. Searches are processed in groups of `SearchBatchValue` in lockstep,
+     * so memory accesses of independent searches overlap
+     * @tparam ValueT Value type
+     * @tparam KeyT Key type
+     * @tparam CompareT Comparator type
+     * @param span Sorted elements
+     * @param keys Keys
+     * @param output Output lower bounds, must have size of keys
+     * @param compare Comparator
+     */
+    template<typename ValueT,
+             typename KeyT,
+             typename CompareT = std::less<>>
+    auto LowerBoundMany(Span<ValueT> span,
+                        Span<KeyT> keys,
+                        Span<std::uint64_t> output,
+                        CompareT compare = CompareT()) -> void {
+        using ValueType = std::remove_cv_t<ValueT>;
+        using KeyType = std::remove_cv_t<KeyT>;
+
+        detail::CheckSameSize(output,
+                              keys.Size());
+
+        const ValueType *data = span.Data();
+        auto size = span.Size();
+        const KeyType *needles = keys.Data();
+        auto needleCount = keys.Size();
+        auto results = output.Data();
+        auto predicate = [&compare] (const ValueType &element,
+                                     const KeyType &value) -> bool {
+            return compare(element, value);
+        };
+        auto kernel = [data, size, needles, needleCount, results, &predicate] () {
+            std::uint64_t first = 0;
+
+            for (; first < needleCount; first += detail::SearchBatchValue) {
+                auto count = needleCount - first < detail::SearchBatchValue ? needleCount - first : detail::SearchBatchValue;
+                const ValueType *bases[detail::SearchBatchValue];
+
+                for (std::uint64_t lane = 0; lane < count; ++lane) {
+                    bases[lane] = data;
+                }
+
+                for (auto remaining = size; remaining > detail::SearchScanValue; ) {
+                    auto half = remaining / 2;
+
+                    for (std::uint64_t lane = 0; lane < count; ++lane) {
+                        GSTD_PREFETCH(bases[lane] + half / 2);
+                        GSTD_PREFETCH(bases[lane] + half + half / 2);
+
+                        bases[lane] = predicate(bases[lane][half], needles[first + lane]) ? bases[lane] + half : bases[lane];
+                    }
+
+                    remaining -= half;
+                }
+
+                for (std::uint64_t lane = 0; lane < count; ++lane) {
+                    results[first + lane] = detail::LinearScan(data,
+                                                              size,
+                                                              bases[lane],
+                                                              needles[first + lane],
+                                                              predicate);
+                }
+            }
+        };
+
+        if GSTD_CONSTEXPR (detail::IsSimdSearchV<ValueType, KeyType, CompareT>) {
+            detail::SimdDispatch(kernel);
+        } else {
+            kernel();
+        }
+    }
+
+}
+
+#endif //GSTD_SEARCH_H
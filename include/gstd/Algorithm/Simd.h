@@ -0,0 +1,441 @@
+#ifndef GSTD_SIMD_H
+#define GSTD_SIMD_H
+
+#include <gstd/Containers/Span.h>
+#include <gstd/System/Cpu.h>
+#include <gstd/Type/Pair.h>
+
+namespace gstd {
+
+    namespace detail {
+
+        /**
+         * Count of independent accumulators in reductions<br>
+         * Fixed for all SIMD levels, so floating point results don`t depend on dispatched instruction set
+         */
+        inline constexpr std::uint64_t SimdLanesValue = 16;
+
+        /**
+         * Count of elements, that checked without branches in searching kernels
+         */
+        inline constexpr std::uint64_t SimdBlockValue = 32;
+
+        template<typename ValueT>
+        using SimdAccumulatorType = std::conditional_t<std::is_floating_point_v<ValueT>,
+                                                       ValueT,
+                                                       std::conditional_t<std::is_signed_v<ValueT>,
+                                                                          std::int64_t,
+                                                                          std::uint64_t>>;
+
+#if defined(GSTD_ARCH_X86_64)
+
+        template<typename KernelT>
+        GSTD_TARGET("avx512f,avx512bw,avx512vl,avx512dq,avx2,bmi,bmi2,popcnt") GSTD_FLATTEN
+        auto RunAVX512(const KernelT &kernel) {
+            return kernel();
+        }
+
+        template<typename KernelT>
+        GSTD_TARGET("avx2,bmi,bmi2,popcnt") GSTD_FLATTEN
+        auto RunAVX2(const KernelT &kernel) {
+            return kernel();
+        }
+
+#endif
+
+        /**
+         * Running kernel, compiled for best available SIMD level<br>
+         * Kernel is written as plain loops over independent lanes and vectorized by compiler for each level
+         * @tparam KernelT Kernel type
+         * @param kernel Kernel
+         * @return Result of kernel
+         */
+        template<typename KernelT>
+        GSTD_FORCEINLINE auto SimdDispatch(const KernelT &kernel) {
+#if defined(GSTD_ARCH_X86_64)
+            switch (CurrentSimdLevel()) {
+                case SimdLevel::AVX512:
+                    return RunAVX512(kernel);
+                case SimdLevel::AVX2:
+                    return RunAVX2(kernel);
+                default:
+                    break;
+            }
+#endif
+
+            return kernel();
+        }
+
+        /**
+         * Reducing lanes pairwise in fixed order
+         * @tparam ValueT Value type
+         * @tparam FunctionT Reducing function type
+         * @param lanes Lanes
+         * @param function Reducing function
+         * @return Reduced value
+         */
+        template<typename ValueT,
+                 typename FunctionT>
+        GSTD_FORCEINLINE auto ReduceLanes(ValueT (&lanes)[SimdLanesValue],
+                                          const FunctionT &function) -> ValueT {
+            for (auto width = SimdLanesValue / 2; width > 0; width /= 2) {
+                for (std::uint64_t lane = 0; lane < width; ++lane) {
+                    lanes[lane] = function(lanes[lane],
+                                           lanes[lane + width]);
+                }
+            }
+
+            return lanes[0];
+        }
+
+        template<typename ValueT>
+        GSTD_CONSTEXPR auto CheckSameSize(const Span<ValueT> &first,
+                                          std::uint64_t size) -> void {
+            if (first.Size() != size) {
+                Panic("Sizes of spans must be equal!");
+            }
+        }
+
+    }
+
+    /**
+     * Summing all elements. Integers are summed in 64-bit accumulator
+     * @tparam ValueT Arithmetic value type
+     * @param span Elements
+     * @return Sum of elements
+     */
+    template<typename ValueT>
+    auto Sum(Span<ValueT> span) -> detail::SimdAccumulatorType<std::remove_cv_t<ValueT>> {
+        using ValueType = std::remove_cv_t<ValueT>;
+        using AccumulatorType = detail::SimdAccumulatorType<ValueType>;
+
+        static_assert(std::is_arithmetic_v<ValueType>,
+                      "`Sum` is available only for arithmetic types!");
+
+        const ValueType *data = span.Data();
+        auto size = span.Size();
+
+        return detail::SimdDispatch([data, size] () -> AccumulatorType {
+            AccumulatorType lanes[detail::SimdLanesValue] = {};
+            std::uint64_t index = 0;
+
+            for (; index + detail::SimdLanesValue <= size; index += detail::SimdLanesValue) {
+                for (std::uint64_t lane = 0; lane < detail::SimdLanesValue; ++lane) {
+                    lanes[lane] += static_cast<AccumulatorType>(data[index + lane]);
+                }
+            }
+
+            for (std::uint64_t lane = 0; index < size; ++index, ++lane) {
+                lanes[lane] += static_cast<AccumulatorType>(data[index]);
+            }
+
+            return detail::ReduceLanes(lanes,
+                                       [] (AccumulatorType first,
+                                           AccumulatorType second) {
+                return first + second;
+            });
+        });
+    }
+
+    /**
+     * Finding minimal and maximal elements. NaN values are not supported
+     * @tparam ValueT Arithmetic value type
+     * @param span Elements
+     * @return Pair of minimal and maximal elements or `None`, if span is empty
+     */
+    template<typename ValueT>
+    auto MinMax(Span<ValueT> span) -> Optional<Pair<std::remove_cv_t<ValueT>,
+                                                    std::remove_cv_t<ValueT>>> {
+        using ValueType = std::remove_cv_t<ValueT>;
+
+        static_assert(std::is_arithmetic_v<ValueType>,
+                      "`MinMax` is available only for arithmetic types!");
+
+        if (span.Empty()) {
+            return MakeNone();
+        }
+
+        const ValueType *data = span.Data();
+        auto size = span.Size();
+
+        return MakeSome(detail::SimdDispatch([data, size] () -> Pair<ValueType,
+                                                                     ValueType> {
+            ValueType minimums[detail::SimdLanesValue];
+            ValueType maximums[detail::SimdLanesValue];
+
+            for (std::uint64_t lane = 0; lane < detail::SimdLanesValue; ++lane) {
+                minimums[lane] = data[0];
+                maximums[lane] = data[0];
+            }
+
+            std::uint64_t index = 0;
+
+            for (; index + detail::SimdLanesValue <= size; index += detail::SimdLanesValue) {
+                for (std::uint64_t lane = 0; lane < detail::SimdLanesValue; ++lane) {
+                    auto value = data[index + lane];
+
+                    minimums[lane] = value < minimums[lane] ? value : minimums[lane];
+                    maximums[lane] = value > maximums[lane] ? value : maximums[lane];
+                }
+            }
+
+            for (std::uint64_t lane = 0; index < size; ++index, ++lane) {
+                minimums[lane] = data[index] < minimums[lane] ? data[index] : minimums[lane];
+                maximums[lane] = data[index] > maximums[lane] ? data[index] : maximums[lane];
+            }
+
+            auto minimum = detail::ReduceLanes(minimums,
+                                               [] (ValueType first,
+                                                   ValueType second) {
+                return second < first ? second : first;
+            });
+            auto maximum = detail::ReduceLanes(maximums,
+                                               [] (ValueType first,
+                                                   ValueType second) {
+                return second > first ? second : first;
+            });
+
+            return MakePair(std::move(minimum),
+                            std::move(maximum));
+        }));
+    }
+
+    /**
+     * Counting elements, that equal to value
+     * @tparam ValueT Arithmetic value type
+     * @param span Elements
+     * @param value Value
+     * @return Count of equal elements
+     */
+    template<typename ValueT>
+    auto Count(Span<ValueT> span,
+               const std::remove_cv_t<ValueT> &value) -> std::uint64_t {
+        using ValueType = std::remove_cv_t<ValueT>;
+
+        static_assert(std::is_arithmetic_v<ValueType>,
+                      "`Count` is available only for arithmetic types!");
+
+        const ValueType *data = span.Data();
+        auto size = span.Size();
+        auto needle = value;
+
+        return detail::SimdDispatch([data, size, needle] () -> std::uint64_t {
+            std::uint64_t lanes[detail::SimdLanesValue] = {};
+            std::uint64_t index = 0;
+
+            for (; index + detail::SimdLanesValue <= size; index += detail::SimdLanesValue) {
+                for (std::uint64_t lane = 0; lane < detail::SimdLanesValue; ++lane) {
+                    lanes[lane] += data[index + lane] == needle;
+                }
+            }
+
+            for (std::uint64_t lane = 0; index < size; ++index, ++lane) {
+                lanes[lane] += data[index] == needle;
+            }
+
+            return detail::ReduceLanes(lanes,
+                                       [] (std::uint64_t first,
+                                           std::uint64_t second) {
+                return first + second;
+            });
+        });
+    }
+
+    /**
+     * Finding first element, that satisfies predicate<br>
+     * Predicate is evaluated without branches for blocks of elements, so it must be cheap and without side effects
+     * @tparam ValueT Value type
+     * @tparam PredicateT Predicate type
+     * @param span Elements
+     * @param predicate Predicate
+     * @return Index of first found element or `None`
+     */
+    template<typename ValueT,
+             typename PredicateT>
+    auto FindIf(Span<ValueT> span,
+                const PredicateT &predicate) -> Optional<std::uint64_t> {
+        using ValueType = std::remove_cv_t<ValueT>;
+
+        const ValueType *data = span.Data();
+        auto size = span.Size();
+
+        auto index = detail::SimdDispatch([data, size, &predicate] () -> std::uint64_t {
+            std::uint64_t index = 0;
+
+            for (; index + detail::SimdBlockValue <= size; index += detail::SimdBlockValue) {
+                bool found = false;
+
+                for (std::uint64_t offset = 0; offset < detail::SimdBlockValue; ++offset) {
+                    found |= static_cast<bool>(predicate(data[index + offset]));
+                }
+
+                if (found) {
+                    break;
+                }
+            }
+
+            for (; index < size; ++index) {
+                if (predicate(data[index])) {
+                    return index;
+                }
+            }
+
+            return size;
+        });
+
+        if (index == size) {
+            return MakeNone();
+        }
+
+        return MakeSome(std::move(index));
+    }
+
+    /**
+     * Finding first element, that equal to value
+     * @tparam ValueT Arithmetic value type
+     * @param span Elements
+     * @param value Value
+     * @return Index of first found element or `None`
+     */
+    template<typename ValueT>
+    auto Find(Span<ValueT> span,
+              const std::remove_cv_t<ValueT> &value) -> Optional<std::uint64_t> {
+        using ValueType = std::remove_cv_t<ValueT>;
+
+        static_assert(std::is_arithmetic_v<ValueType>,
+                      "`Find` is available only for arithmetic types!");
+
+        auto needle = value;
+
+        return FindIf(span,
+                      [needle] (ValueType element) -> bool {
+            return element == needle;
+        });
+    }
+
+    /**
+     * Elementwise adding: `output[i] = first[i] + second[i]`
+     * @tparam ValueT Arithmetic value type
+     * @param first First operands
+     * @param second Second operands
+     * @param output Results, may be same as one of operands
+     */
+    template<typename ValueT>
+    auto Add(std::type_identity_t<Span<const ValueT>> first,
+             std::type_identity_t<Span<const ValueT>> second,
+             Span<ValueT> output) -> void {
+        static_assert(std::is_arithmetic_v<ValueT>,
+                      "`Add` is available only for arithmetic types!");
+
+        detail::CheckSameSize(second,
+                              first.Size());
+        detail::CheckSameSize(output,
+                              first.Size());
+
+        detail::SimdDispatch([first, second, output] () {
+            for (std::uint64_t index = 0; index < output.Size(); ++index) {
+                output.Data()[index] = first.Data()[index] + second.Data()[index];
+            }
+        });
+    }
+
+    /**
+     * Elementwise multiplying: `output[i] = first[i] * second[i]`
+     * @tparam ValueT Arithmetic value type
+     * @param first First operands
+     * @param second Second operands
+     * @param output Results, may be same as one of operands
+     */
+    template<typename ValueT>
+    auto Mul(std::type_identity_t<Span<const ValueT>> first,
+             std::type_identity_t<Span<const ValueT>> second,
+             Span<ValueT> output) -> void {
+        static_assert(std::is_arithmetic_v<ValueT>,
+                      "`Mul` is available only for arithmetic types!");
+
+        detail::CheckSameSize(second,
+                              first.Size());
+        detail::CheckSameSize(output,
+                              first.Size());
+
+        detail::SimdDispatch([first, second, output] () {
+            for (std::uint64_t index = 0; index < output.Size(); ++index) {
+                output.Data()[index] = first.Data()[index] * second.Data()[index];
+            }
+        });
+    }
+
+    /**
+     * Scaling: `output[i] = input[i] * factor`
+     * @tparam ValueT Arithmetic value type
+     * @param input Operands
+     * @param factor Factor
+     * @param output Results, may be same as operands
+     */
+    template<typename ValueT>
+    auto Scale(std::type_identity_t<Span<const ValueT>> input,
+               const std::type_identity_t<ValueT> &factor,
+               Span<ValueT> output) -> void {
+        static_assert(std::is_arithmetic_v<ValueT>,
+                      "`Scale` is available only for arithmetic types!");
+
+        detail::CheckSameSize(output,
+                              input.Size());
+
+        auto multiplier = factor;
+
+        detail::SimdDispatch([input, multiplier, output] () {
+            for (std::uint64_t index = 0; index < output.Size(); ++index) {
+                output.Data()[index] = input.Data()[index] * multiplier;
+            }
+        });
+    }
+
+    /**
+     * Computing dot product. Integers are accumulated in 64-bit accumulator
+     * @tparam ValueT Arithmetic value type
+     * @param first First vector
+     * @param second Second vector
+     * @return Dot product
+     */
+    template<typename ValueT>
+    auto Dot(Span<ValueT> first,
+             std::type_identity_t<Span<const std::remove_cv_t<ValueT>>> second) -> detail::SimdAccumulatorType<std::remove_cv_t<ValueT>> {
+        using ValueType = std::remove_cv_t<ValueT>;
+        using AccumulatorType = detail::SimdAccumulatorType<ValueType>;
+
+        static_assert(std::is_arithmetic_v<ValueType>,
+                      "`Dot` is available only for arithmetic types!");
+
+        detail::CheckSameSize(second,
+                              first.Size());
+
+        const ValueType *left = first.Data();
+        const ValueType *right = second.Data();
+        auto size = first.Size();
+
+        return detail::SimdDispatch([left, right, size] () -> AccumulatorType {
+            AccumulatorType lanes[detail::SimdLanesValue] = {};
+            std::uint64_t index = 0;
+
+            for (; index + detail::SimdLanesValue <= size; index += detail::SimdLanesValue) {
+                for (std::uint64_t lane = 0; lane < detail::SimdLanesValue; ++lane) {
+                    lanes[lane] += static_cast<AccumulatorType>(left[index + lane]) * static_cast<AccumulatorType>(right[index + lane]);
+                }
+            }
+
+            for (std::uint64_t lane = 0; index < size; ++index, ++lane) {
+                lanes[lane] += static_cast<AccumulatorType>(left[index]) * static_cast<AccumulatorType>(right[index]);
+            }
+
+            return detail::ReduceLanes(lanes,
+                                       [] (AccumulatorType first,
+                                           AccumulatorType second) {
+                return first + second;
+            });
+        });
+    }
+
+}
+
+#endif //GSTD_SIMD_H
@@ -0,0 +1,875 @@
+#ifndef GSTD_SORT_H
+#define GSTD_SORT_H
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+
+#include <gstd/Containers/Vector.h>
+#include <gstd/Type/Pair.h>
+
+namespace gstd {
+
+    namespace detail {
+
+        /**
+         * Ranges smaller than this are sorted by insertion sort
+         */
+        inline constexpr std::int64_t InsertionSortThresholdValue = 24;
+
+        /**
+         * Ranges greater than this choose pivot by pseudomedian of nine
+         */
+        inline constexpr std::int64_t NintherThresholdValue = 128;
+
+        /**
+         * Maximal count of moved elements in partial insertion sort before giving up
+         */
+        inline constexpr std::int64_t PartialInsertionSortLimitValue = 8;
+
+        /**
+         * Count of elements, that classified by one block of branchless partition
+         */
+        inline constexpr std::int64_t PartitionBlockValue = 64;
+
+        /**
+         * Checking, if comparator is standard comparator of arithmetic values, so comparison result can be used as integer
+         */
+        template<typename ValueT,
+                 typename CompareT>
+        inline constexpr bool IsBranchlessCompareV = std::is_arithmetic_v<ValueT>
+                                                     && (std::is_same_v<CompareT, std::less<>>
+                                                         || std::is_same_v<CompareT, std::less<ValueT>>
+                                                         || std::is_same_v<CompareT, std::greater<>>
+                                                         || std::is_same_v<CompareT, std::greater<ValueT>>);
+
+        template<typename ValueT,
+                 typename CompareT>
+        auto InsertionSort(ValueT *begin,
+                           ValueT *end,
+                           CompareT &compare) -> void {
+            if (begin == end) {
+                return;
+            }
+
+            for (auto current = begin + 1; current != end; ++current) {
+                auto sift = current;
+                auto previous = current - 1;
+
+                if (compare(*sift, *previous)) {
+                    auto value = std::move(*sift);
+
+                    do {
+                        *sift-- = std::move(*previous);
+                    } while (sift != begin && compare(value, *--previous));
+
+                    *sift = std::move(value);
+                }
+            }
+        }
+
+        /**
+         * Insertion sort, that relies on element before `begin` being not greater than all elements in range
+         */
+        template<typename ValueT,
+                 typename CompareT>
+        auto UnguardedInsertionSort(ValueT *begin,
+                                    ValueT *end,
+                                    CompareT &compare) -> void {
+            if (begin == end) {
+                return;
+            }
+
+            for (auto current = begin + 1; current != end; ++current) {
+                auto sift = current;
+                auto previous = current - 1;
+
+                if (compare(*sift, *previous)) {
+                    auto value = std::move(*sift);
+
+                    do {
+                        *sift-- = std::move(*previous);
+                    } while (compare(value, *--previous));
+
+                    *sift = std::move(value);
+                }
+            }
+        }
+
+        /**
+         * Insertion sort, that gives up after moving `PartialInsertionSortLimitValue` elements
+         * @return Is range sorted
+         */
+        template<typename ValueT,
+                 typename CompareT>
+        auto PartialInsertionSort(ValueT *begin,
+                                  ValueT *end,
+                                  CompareT &compare) -> bool {
+            if (begin == end) {
+                return true;
+            }
+
+            std::int64_t moved = 0;
+
+            for (auto current = begin + 1; current != end; ++current) {
+                if (moved > PartialInsertionSortLimitValue) {
+                    return false;
+                }
+
+                auto sift = current;
+                auto previous = current - 1;
+
+                if (compare(*sift, *previous)) {
+                    auto value = std::move(*sift);
+
+                    do {
+                        *sift-- = std::move(*previous);
+                    } while (sift != begin && compare(value, *--previous));
+
+                    *sift = std::move(value);
+
+                    moved += current - sift;
+                }
+            }
+
+            return true;
+        }
+
+        template<typename ValueT,
+                 typename CompareT>
+        auto Sort3(ValueT *first,
+                   ValueT *second,
+                   ValueT *third,
+                   CompareT &compare) -> void {
+            if (compare(*second, *first)) {
+                std::iter_swap(first, second);
+            }
+
+            if (compare(*third, *second)) {
+                std::iter_swap(second, third);
+            }
+
+            if (compare(*second, *first)) {
+                std::iter_swap(first, second);
+            }
+        }
+
+        /**
+         * Partitioning around `*begin`: elements equal to pivot go to right part
+         * @return Position of pivot and flag, that range was already partitioned
+         */
+        template<typename ValueT,
+                 typename CompareT>
+        auto PartitionRight(ValueT *begin,
+                            ValueT *end,
+                            CompareT &compare) -> Pair<ValueT *, bool> {
+            auto pivot = std::move(*begin);
+            auto first = begin;
+            auto last = end;
+
+            while (compare(*++first, pivot)) {}
+
+            if (first - 1 == begin) {
+                while (first < last && !compare(*--last, pivot)) {}
+            } else {
+                while (!compare(*--last, pivot)) {}
+            }
+
+            auto partitioned = first >= last;
+
+            while (first < last) {
+                std::iter_swap(first, last);
+
+                while (compare(*++first, pivot)) {}
+                while (!compare(*--last, pivot)) {}
+            }
+
+            auto position = first - 1;
+
+            *begin = std::move(*position);
+            *position = std::move(pivot);
+
+            return MakePair(std::move(position),
+                            std::move(partitioned));
+        }
+
+        /**
+         * Swapping elements by offsets from blocks of branchless partition
+         */
+        template<typename ValueT>
+        auto SwapOffsets(ValueT *first,
+                         ValueT *last,
+                         const std::uint8_t *leftOffsets,
+                         const std::uint8_t *rightOffsets,
+                         std::int64_t count,
+                         bool useSwaps) -> void {
+            if (useSwaps) {
+                for (std::int64_t index = 0; index < count; ++index) {
+                    std::iter_swap(first + leftOffsets[index],
+                                   last - rightOffsets[index]);
+                }
+
+                return;
+            }
+
+            if (count == 0) {
+                return;
+            }
+
+            auto left = first + leftOffsets[0];
+            auto right = last - rightOffsets[0];
+            auto value = std::move(*left);
+
+            *left = std::move(*right);
+
+            for (std::int64_t index = 1; index < count; ++index) {
+                left = first + leftOffsets[index];
+                *right = std::move(*left);
+                right = last - rightOffsets[index];
+                *left = std::move(*right);
+            }
+
+            *right = std::move(value);
+        }
+
+        /**
+         * Partitioning like `PartitionRight`, but comparisons are only written to offset buffers and never branched on
+         */
+        template<typename ValueT,
+                 typename CompareT>
+        auto PartitionRightBranchless(ValueT *begin,
+                                      ValueT *end,
+                                      CompareT &compare) -> Pair<ValueT *, bool> {
+            auto pivot = std::move(*begin);
+            auto first = begin;
+            auto last = end;
+
+            while (compare(*++first, pivot)) {}
+
+            if (first - 1 == begin) {
+                while (first < last && !compare(*--last, pivot)) {}
+            } else {
+                while (!compare(*--last, pivot)) {}
+            }
+
+            auto partitioned = first >= last;
+
+            if (!partitioned) {
+                std::iter_swap(first, last);
+                ++first;
+
+                alignas(64) std::uint8_t leftOffsets[PartitionBlockValue];
+                alignas(64) std::uint8_t rightOffsets[PartitionBlockValue];
+
+                auto leftBase = first;
+                auto rightBase = last;
+                std::int64_t leftCount = 0;
+                std::int64_t rightCount = 0;
+                std::int64_t leftStart = 0;
+                std::int64_t rightStart = 0;
+
+                while (first < last) {
+                    auto unknown = last - first;
+                    auto leftSplit = leftCount == 0 ? (rightCount == 0 ? unknown / 2 : unknown) : 0;
+                    auto rightSplit = rightCount == 0 ? unknown - leftSplit : 0;
+
+                    leftSplit = leftSplit < PartitionBlockValue ? leftSplit : PartitionBlockValue;
+                    rightSplit = rightSplit < PartitionBlockValue ? rightSplit : PartitionBlockValue;
+
+                    for (std::int64_t index = 0; index < leftSplit; ++index) {
+                        leftOffsets[leftCount] = static_cast<std::uint8_t>(index);
+                        leftCount += !compare(*first, pivot);
+                        ++first;
+                    }
+
+                    for (std::int64_t index = 0; index < rightSplit; ++index) {
+                        rightOffsets[rightCount] = static_cast<std::uint8_t>(index + 1);
+                        rightCount += compare(*--last, pivot);
+                    }
+
+                    auto count = leftCount < rightCount ? leftCount : rightCount;
+
+                    SwapOffsets(leftBase,
+                                rightBase,
+                                leftOffsets + leftStart,
+                                rightOffsets + rightStart,
+                                count,
+                                leftCount == rightCount);
+
+                    leftCount -= count;
+                    rightCount -= count;
+                    leftStart += count;
+                    rightStart += count;
+
+                    if (leftCount == 0) {
+                        leftStart = 0;
+                        leftBase = first;
+                    }
+
+                    if (rightCount == 0) {
+                        rightStart = 0;
+                        rightBase = last;
+                    }
+                }
+
+                if (leftCount != 0) {
+                    while (leftCount-- != 0) {
+                        std::iter_swap(leftBase + leftOffsets[leftStart + leftCount],
+                                       --last);
+                    }
+
+                    first = last;
+                }
+
+                if (rightCount != 0) {
+                    while (rightCount-- != 0) {
+                        std::iter_swap(rightBase - rightOffsets[rightStart + rightCount],
+                                       first);
+                        ++first;
+                    }
+
+                    last = first;
+                }
+            }
+
+            auto position = first - 1;
+
+            *begin = std::move(*position);
+            *position = std::move(pivot);
+
+            return MakePair(std::move(position),
+                            std::move(partitioned));
+        }
+
+        /**
+         * Partitioning around `*begin`: elements equal to pivot go to left part. Used, when many elements equal to pivot
+         * @return Position of pivot
+         */
+        template<typename ValueT,
+                 typename CompareT>
+        auto PartitionLeft(ValueT *begin,
+                           ValueT *end,
+                           CompareT &compare) -> ValueT * {
+            auto pivot = std::move(*begin);
+            auto first = begin;
+            auto last = end;
+
+            while (compare(pivot, *--last)) {}
+
+            if (last + 1 == end) {
+                while (first < last && !compare(pivot, *++first)) {}
+            } else {
+                while (!compare(pivot, *++first)) {}
+            }
+
+            while (first < last) {
+                std::iter_swap(first, last);
+
+                while (compare(pivot, *--last)) {}
+                while (!compare(pivot, *++first)) {}
+            }
+
+            *begin = std::move(*last);
+            *last = std::move(pivot);
+
+            return last;
+        }
+
+        /**
+         * Main loop of pattern-defeating quicksort
+         * @param badAllowed Count of highly unbalanced partitions before switching to heapsort
+         * @param leftmost Is range leftmost, i.e. there is no smaller element before `begin`
+         */
+        template<bool BranchlessV,
+                 typename ValueT,
+                 typename CompareT>
+        auto PdqSortLoop(ValueT *begin,
+                         ValueT *end,
+                         CompareT &compare,
+                         std::int64_t badAllowed,
+                         bool leftmost) -> void {
+            while (true) {
+                auto size = end - begin;
+
+                if (size < InsertionSortThresholdValue) {
+                    if (leftmost) {
+                        InsertionSort(begin, end, compare);
+                    } else {
+                        UnguardedInsertionSort(begin, end, compare);
+                    }
+
+                    return;
+                }
+
+                auto half = size / 2;
+
+                if (size > NintherThresholdValue) {
+                    Sort3(begin, begin + half, end - 1, compare);
+                    Sort3(begin + 1, begin + (half - 1), end - 2, compare);
+                    Sort3(begin + 2, begin + (half + 1), end - 3, compare);
+                    Sort3(begin + (half - 1), begin + half, begin + (half + 1), compare);
+
+                    std::iter_swap(begin, begin + half);
+                } else {
+                    Sort3(begin + half, begin, end - 1, compare);
+                }
+
+                if (!leftmost && !compare(*(begin - 1), *begin)) {
+                    begin = PartitionLeft(begin, end, compare) + 1;
+
+                    continue;
+                }
+
+                auto partition = BranchlessV
+                                 ? PartitionRightBranchless(begin, end, compare)
+                                 : PartitionRight(begin, end, compare);
+                auto position = partition.First();
+                auto leftSize = position - begin;
+                auto rightSize = end - (position + 1);
+
+                if (leftSize < size / 8 || rightSize < size / 8) {
+                    if (--badAllowed == 0) {
+                        std::make_heap(begin, end, compare);
+                        std::sort_heap(begin, end, compare);
+
+                        return;
+                    }
+
+                    if (leftSize >= InsertionSortThresholdValue) {
+                        std::iter_swap(begin, begin + leftSize / 4);
+                        std::iter_swap(position - 1, position - leftSize / 4);
+
+                        if (leftSize > NintherThresholdValue) {
+                            std::iter_swap(begin + 1, begin + (leftSize / 4 + 1));
+                            std::iter_swap(begin + 2, begin + (leftSize / 4 + 2));
+                            std::iter_swap(position - 2, position - (leftSize / 4 + 1));
+                            std::iter_swap(position - 3, position - (leftSize / 4 + 2));
+                        }
+                    }
+
+                    if (rightSize >= InsertionSortThresholdValue) {
+                        std::iter_swap(position + 1, position + (1 + rightSize / 4));
+                        std::iter_swap(end - 1, end - rightSize / 4);
+
+                        if (rightSize > NintherThresholdValue) {
+                            std::iter_swap(position + 2, position + (2 + rightSize / 4));
+                            std::iter_swap(position + 3, position + (3 + rightSize / 4));
+                            std::iter_swap(end - 2, end - (1 + rightSize / 4));
+                            std::iter_swap(end - 3, end - (2 + rightSize / 4));
+                        }
+                    }
+                } else if (partition.Second()
+                           && PartialInsertionSort(begin, position, compare)
+                           && PartialInsertionSort(position + 1, end, compare)) {
+                    return;
+                }
+
+                PdqSortLoop<BranchlessV>(begin, position, compare, badAllowed, leftmost);
+
+                begin = position + 1;
+                leftmost = false;
+            }
+        }
+
+    }
+
+    /**
+     * Sorting elements by pattern-defeating quicksort. Sorting is not stable<br>
+     * Sorted, reversed and equal ranges are sorted in linear time, worst case is O(n log n).
+     * For arithmetic elements with standard comparators partition is branchless
+     * @tparam ValueT Value type
+     * @tparam CompareT Comparator type
+     * @param span Elements
+     * @param compare Comparator
+     */
+    template<typename ValueT,
+             typename CompareT = std::less<>>
+    auto Sort(Span<ValueT> span,
+              CompareT compare = CompareT()) -> void {
+        if (span.Size() < 2) {
+            return;
+        }
+
+        detail::PdqSortLoop<detail::IsBranchlessCompareV<ValueT, CompareT>>(span.Data(),
+                                                                             span.Data() + span.Size(),
+                                                                             compare,
+                                                                             std::bit_width(span.Size()),
+                                                                             true);
+    }
+
+    namespace detail {
+
+        /**
+         * Ranges smaller than this are sorted by stable insertion sort instead of radix passes
+         */
+        inline constexpr std::uint64_t RadixInsertionThresholdValue = 64;
+
+        template<typename KeyT>
+        inline constexpr bool IsByteStringKeyV = false;
+
+        template<typename CharT>
+        inline constexpr bool IsByteStringKeyV<Span<CharT>> = sizeof(CharT) == 1;
+
+        /**
+         * Mapping arithmetic key to unsigned integer with same order
+         */
+        template<typename KeyT>
+        GSTD_CONSTEXPR auto RadixKey(KeyT key) GSTD_NOEXCEPT {
+            static_assert(std::is_arithmetic_v<KeyT> && sizeof(KeyT) <= 8,
+                          "Radix key must be arithmetic type with size up to 8 bytes!");
+
+            using UnsignedType = std::conditional_t<sizeof(KeyT) == 1, std::uint8_t,
+                                 std::conditional_t<sizeof(KeyT) == 2, std::uint16_t,
+                                 std::conditional_t<sizeof(KeyT) == 4, std::uint32_t,
+                                                                       std::uint64_t>>>;
+
+            constexpr auto SignValue = static_cast<UnsignedType>(UnsignedType(1) << (sizeof(KeyT) * 8 - 1));
+
+            auto bits = std::bit_cast<UnsignedType>(key);
+
+            if GSTD_CONSTEXPR (std::is_floating_point_v<KeyT>) {
+                return static_cast<UnsignedType>((bits & SignValue) != 0 ? ~bits : bits | SignValue);
+            } else if GSTD_CONSTEXPR (std::is_signed_v<KeyT>) {
+                return static_cast<UnsignedType>(bits ^ SignValue);
+            } else {
+                return bits;
+            }
+        }
+
+        /**
+         * Stable insertion sort by comparator
+         */
+        template<typename ValueT,
+                 typename LessT>
+        auto StableInsertionSort(ValueT *begin,
+                                 ValueT *end,
+                                 const LessT &less) -> void {
+            for (auto current = begin + (begin != end); current < end; ++current) {
+                auto sift = current;
+
+                if (!less(*sift, *(sift - 1))) {
+                    continue;
+                }
+
+                auto value = std::move(*sift);
+
+                do {
+                    *sift = std::move(*(sift - 1));
+                    --sift;
+                } while (sift != begin && less(value, *(sift - 1)));
+
+                *sift = std::move(value);
+            }
+        }
+
+        /**
+         * Least significant digit radix sort by 8-bit digits. Digits, that are equal for all keys, are skipped
+         */
+        template<typename ValueT,
+                 typename KeyFunctionT>
+        auto LsdRadixSort(Span<ValueT> span,
+                          const KeyFunctionT &key) -> void {
+            using KeyType = decltype(RadixKey(key(std::declval<const ValueT &>())));
+
+            constexpr std::uint64_t DigitsValue = sizeof(KeyType);
+
+            auto size = span.Size();
+            auto data = span.Data();
+
+            if (size < RadixInsertionThresholdValue) {
+                StableInsertionSort(data,
+                                    data + size,
+                                    [&key] (const ValueT &first,
+                                            const ValueT &second) {
+                    return RadixKey(key(first)) < RadixKey(key(second));
+                });
+
+                return;
+            }
+
+            std::uint64_t histograms[DigitsValue][256] = {};
+
+            for (std::uint64_t index = 0; index < size; ++index) {
+                auto bits = RadixKey(key(data[index]));
+
+                for (std::uint64_t digit = 0; digit < DigitsValue; ++digit) {
+                    ++histograms[digit][(bits >> (digit * 8)) & 0xff];
+                }
+            }
+
+            Vector<ValueT> scratch;
+
+            scratch.ResizeDefaultInit(size);
+
+            auto source = data;
+            auto destination = scratch.Data();
+
+            for (std::uint64_t digit = 0; digit < DigitsValue; ++digit) {
+                auto &histogram = histograms[digit];
+
+                if (histogram[(RadixKey(key(source[0])) >> (digit * 8)) & 0xff] == size) {
+                    continue;
+                }
+
+                std::uint64_t offsets[256];
+                std::uint64_t offset = 0;
+
+                for (std::uint64_t bucket = 0; bucket < 256; ++bucket) {
+                    offsets[bucket] = offset;
+                    offset += histogram[bucket];
+                }
+
+                for (std::uint64_t index = 0; index < size; ++index) {
+                    auto bucket = (RadixKey(key(source[index])) >> (digit * 8)) & 0xff;
+
+                    destination[offsets[bucket]++] = std::move(source[index]);
+                }
+
+                std::swap(source,
+                          destination);
+            }
+
+            if (source != data) {
+                for (std::uint64_t index = 0; index < size; ++index) {
+                    data[index] = std::move(source[index]);
+                }
+            }
+        }
+
+        /**
+         * Depth, from that buckets of byte strings with long common prefix are sorted by comparisons
+         */
+        inline constexpr std::uint64_t RadixMaxDepthValue = 64;
+
+        /**
+         * Comparing suffixes of byte strings, that start at `depth`
+         * @return Negative, zero or positive value, if first suffix is less, equal or greater than second
+         */
+        template<typename KeyT>
+        auto CompareFromDepth(const KeyT &first,
+                              const KeyT &second,
+                              std::uint64_t depth) -> int {
+            auto firstSize = first.Size() > depth ? first.Size() - depth : 0;
+            auto secondSize = second.Size() > depth ? second.Size() - depth : 0;
+            auto size = firstSize < secondSize ? firstSize : secondSize;
+
+            for (std::uint64_t index = 0; index < size; ++index) {
+                auto left = static_cast<std::uint8_t>(first.Data()[depth + index]);
+                auto right = static_cast<std::uint8_t>(second.Data()[depth + index]);
+
+                if (left != right) {
+                    return left < right ? -1 : 1;
+                }
+            }
+
+            return firstSize < secondSize ? -1 : (firstSize > secondSize ? 1 : 0);
+        }
+
+        /**
+         * Bucket of byte string at `depth`. Bucket 0 holds keys, that end at `depth`
+         */
+        template<typename KeyT>
+        auto RadixBucketOf(const KeyT &string,
+                           std::uint64_t depth) -> std::uint64_t {
+            return depth < string.Size() ? static_cast<std::uint64_t>(static_cast<std::uint8_t>(string.Data()[depth])) + 1 : 0;
+        }
+
+        /**
+         * Range of elements, that is sorted from byte `Depth` of keys
+         */
+        struct RadixRange {
+
+            std::uint64_t Offset;
+
+            std::uint64_t Size;
+
+            std::uint64_t Depth;
+        };
+
+        /**
+         * Stable comparison sort of byte strings from `depth`. Large ranges are sorted by pdqsort
+         * with ties broken by original position, then moved into sorted order through scratch
+         */
+        template<typename ValueT,
+                 typename KeyFunctionT>
+        auto SortFromDepth(ValueT *data,
+                           ValueT *scratch,
+                           std::uint64_t size,
+                           std::uint64_t depth,
+                           const KeyFunctionT &key) -> void {
+            if (size < RadixInsertionThresholdValue) {
+                StableInsertionSort(data,
+                                    data + size,
+                                    [&key, depth] (const ValueT &first,
+                                                   const ValueT &second) {
+                    return CompareFromDepth(key(first), key(second), depth) < 0;
+                });
+
+                return;
+            }
+
+            Vector<std::uint64_t> order;
+
+            order.ResizeUninitialized(size);
+
+            for (std::uint64_t index = 0; index < size; ++index) {
+                order.Data()[index] = index;
+            }
+
+            Sort(order.AsSpan(),
+                 [data, depth, &key] (std::uint64_t first,
+                                      std::uint64_t second) {
+                auto result = CompareFromDepth(key(data[first]), key(data[second]), depth);
+
+                return result < 0 || (result == 0 && first < second);
+            });
+
+            for (std::uint64_t index = 0; index < size; ++index) {
+                scratch[index] = std::move(data[order.Data()[index]]);
+            }
+
+            for (std::uint64_t index = 0; index < size; ++index) {
+                data[index] = std::move(scratch[index]);
+            }
+        }
+
+        /**
+         * Stable most significant digit radix sort of byte strings<br>
+         * Ranges are kept on explicit stack, so depth of call stack doesn`t depend on length of keys.
+         * Common bytes of range are skipped by loop, small ranges and ranges deeper than `RadixMaxDepthValue`
+         * are sorted by comparisons
+         */
+        template<typename ValueT,
+                 typename KeyFunctionT>
+        auto MsdRadixSort(ValueT *data,
+                          ValueT *scratch,
+                          std::uint64_t size,
+                          const KeyFunctionT &key) -> void {
+            Vector<RadixRange> ranges;
+
+            ranges.Append(RadixRange {0, size, 0});
+
+            while (ranges.Size() != 0) {
+                auto range = ranges.Data()[ranges.Size() - 1];
+
+                ranges.ResizeUninitialized(ranges.Size() - 1);
+
+                auto values = data + range.Offset;
+                auto buffer = scratch + range.Offset;
+
+                while (true) {
+                    if (range.Size < RadixInsertionThresholdValue || range.Depth >= RadixMaxDepthValue) {
+                        SortFromDepth(values,
+                                      buffer,
+                                      range.Size,
+                                      range.Depth,
+                                      key);
+
+                        break;
+                    }
+
+                    std::uint64_t counts[257] = {};
+
+                    for (std::uint64_t index = 0; index < range.Size; ++index) {
+                        ++counts[RadixBucketOf(key(values[index]), range.Depth)];
+                    }
+
+                    auto first = RadixBucketOf(key(values[0]), range.Depth);
+
+                    if (counts[first] == range.Size) {
+                        if (first == 0) {
+                            break;
+                        }
+
+                        ++range.Depth;
+
+                        continue;
+                    }
+
+                    std::uint64_t offsets[257];
+                    std::uint64_t offset = 0;
+
+                    for (std::uint64_t bucket = 0; bucket < 257; ++bucket) {
+                        offsets[bucket] = offset;
+                        offset += counts[bucket];
+                    }
+
+                    for (std::uint64_t index = 0; index < range.Size; ++index) {
+                        buffer[offsets[RadixBucketOf(key(values[index]), range.Depth)]++] = std::move(values[index]);
+                    }
+
+                    for (std::uint64_t index = 0; index < range.Size; ++index) {
+                        values[index] = std::move(buffer[index]);
+                    }
+
+                    offset = range.Offset + counts[0];
+
+                    for (std::uint64_t bucket = 1; bucket < 257; ++bucket) {
+                        if (counts[bucket] > 1) {
+                            ranges.Append(RadixRange {offset, counts[bucket], range.Depth + 1});
+                        }
+
+                        offset += counts[bucket];
+                    }
+
+                    break;
+                }
+            }
+        }
+
+    }
+
+    /**
+     * Stable radix sort by key. Key function returns arithmetic key (least significant digit sort)
+     * or byte string as `Span` of 1-byte characters (most significant digit sort)<br>
+     * Uses one scratch buffer of `span.Size()` elements, elements must be default constructible and move assignable
+     * @code
+     * RadixSort(people, [] (const Person &person) { return person.Age; });
+     * RadixSort(names, [] (const std::string &name) { return Span<const char>(name.data(), name.size()); });
+     * @endcode
+     * @tparam ValueT Value type
+     * @tparam KeyFunctionT Key function type
+     * @param span Elements
+     * @param key Key function
+     */
+    template<typename ValueT,
+             typename KeyFunctionT>
+    auto RadixSort(Span<ValueT> span,
+                   const KeyFunctionT &key) -> void {
+        using KeyType = std::remove_cvref_t<decltype(key(std::declval<const ValueT &>()))>;
+
+        if GSTD_CONSTEXPR (detail::IsByteStringKeyV<KeyType>) {
+            if (span.Size() < 2) {
+                return;
+            }
+
+            Vector<ValueT> scratch;
+
+            scratch.ResizeDefaultInit(span.Size());
+
+            detail::MsdRadixSort(span.Data(),
+                                 scratch.Data(),
+                                 span.Size(),
+                                 key);
+        } else {
+            detail::LsdRadixSort(span,
+                                 key);
+        }
+    }
+
+    /**
+     * Stable radix sort of arithmetic elements
+     * @tparam ValueT Arithmetic value type
+     * @param span Elements
+     */
+    template<typename ValueT>
+    auto RadixSort(Span<ValueT> span) -> void {
+        RadixSort(span,
+                  [] (const ValueT &value) -> ValueT {
+            return value;
+        });
+    }
+
+}
+
+#endif //GSTD_SORT_H
@@ -2,6 +2,7 @@
 #define GSTD_ARRAY_H
 
 #include <gstd/Containers/Slice.h>
+#include <gstd/Containers/SliceView.h>
 #include <gstd/Containers/Span.h>
 #include <gstd/Type/Type.h>
 #include <gstd/Utils/Match.h>
@@ -75,6 +76,27 @@ namespace gstd {
             return SizeValue;
         }
 
+        /**
+         * Getting zero-copy strided view over elements by `Slice`
+         * @param slice Slice
+         * @return `SliceView` over elements
+         */
+        GSTD_CONSTEXPR auto View(const Slice &slice) -> SliceView<ValueType> {
+            return SliceView<ValueType>::New(Span<ValueType> {
+                                                 _buffer,
+                                                 SizeValue
+                                             },
+                                             slice);
+        }
+
+        GSTD_CONSTEXPR auto View(const Slice &slice) const -> SliceView<const ValueType> {
+            return SliceView<const ValueType>::New(Span<const ValueType> {
+                                                       _buffer,
+                                                       SizeValue
+                                                   },
+                                                   slice);
+        }
+
     public:
 
         GSTD_CONSTEXPR auto Iter() -> Iterator {
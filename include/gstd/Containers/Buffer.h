@@ -1,6 +1,9 @@
 #ifndef GSTD_BUFFER_H
 #define GSTD_BUFFER_H
 
+#include <bit>
+
+#include <gstd/Memory/MemoryOperations.h>
 #include <gstd/Type/Optional.h>
 
 namespace gstd {
@@ -40,6 +43,50 @@ namespace gstd {
             return _size;
         }
 
+        /**
+         * Assigning `value` to all elements. Byte-sized trivial elements are filled with `MemFill`
+         * @param value Value
+         */
+        GSTD_CONSTEXPR auto Fill(const ValueType &value) -> void {
+            if GSTD_CONSTEXPR (sizeof(ValueType) == 1 && std::is_trivially_copyable_v<ValueType>) {
+                if (!std::is_constant_evaluated()) {
+                    MemFill(static_cast<void *>(_data),
+                            std::bit_cast<Byte>(value),
+                            _size);
+
+                    return;
+                }
+            }
+
+            for (SizeType index = 0; index < _size; ++index) {
+                _data[index] = value;
+            }
+        }
+
+        /**
+         * Assigning elements of `span` to first elements of buffer. Trivially copyable elements are copied with `MemMove`
+         * @param span Source elements, must be not greater than buffer
+         */
+        GSTD_CONSTEXPR auto CopyFrom(Span<const ValueType> span) -> void {
+            if (span.Size() > _size) {
+                Panic("Span is greater than buffer!");
+            }
+
+            if GSTD_CONSTEXPR (std::is_trivially_copyable_v<ValueType>) {
+                if (!std::is_constant_evaluated()) {
+                    MemMove(static_cast<void *>(_data),
+                            static_cast<const void *>(span.Data()),
+                            span.SizeInBytes());
+
+                    return;
+                }
+            }
+
+            for (SizeType index = 0; index < span.Size(); ++index) {
+                _data[index] = span.Data()[index];
+            }
+        }
+
     private:
 
         GSTD_CONSTEXPR auto InBounds(SizeType index) const GSTD_NOEXCEPT -> bool {
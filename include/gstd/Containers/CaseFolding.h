@@ -0,0 +1,964 @@
+#ifndef GSTD_CASEFOLDING_H
+#define GSTD_CASEFOLDING_H
+
+#include <bit>
+#include <compare>
+#include <cstring>
+
+#include <gstd/Algorithm/Simd.h>
+#include <gstd/Containers/Span.h>
+#include <gstd/Containers/String.h>
+#include <gstd/Containers/StringRef.h>
+#include <gstd/Containers/Utf8.h>
+
+#if defined(GSTD_ARCH_X86_64)
+    #include <immintrin.h>
+#endif
+
+namespace gstd {
+
+    namespace detail {
+
+        /**
+         * Range of code points with same case mapping: `First + k * Stride` for `k * Stride <= Length` is mapped to code point + `Delta`
+         */
+        struct CaseRange {
+            std::uint32_t First;
+
+            std::uint16_t Length;
+
+            std::uint16_t Stride;
+
+            std::int32_t Delta;
+        };
+
+        /*
+         * Tables of simple (one to one) case mappings of non-ASCII code points, generated from UnicodeData.txt
+         * and CaseFolding.txt (statuses C and S) of Unicode 14.0. Alternating upper and lower case letters are merged into ranges with stride 2
+         */
+
+        inline constexpr CaseRange LowerCaseRanges[] = {
+            {0x000c0,   22, 1,     32}, {0x000d8,    6, 1,     32}, {0x00100,   46, 2,      1},
+            {0x00130,    0, 1,   -199}, {0x00132,    4, 2,      1}, {0x00139,   14, 2,      1},
+            {0x0014a,   44, 2,      1}, {0x00178,    0, 1,   -121}, {0x00179,    4, 2,      1},
+            {0x00181,    0, 1,    210}, {0x00182,    2, 2,      1}, {0x00186,    0, 1,    206},
+            {0x00187,    0, 1,      1}, {0x00189,    1, 1,    205}, {0x0018b,    0, 1,      1},
+            {0x0018e,    0, 1,     79}, {0x0018f,    0, 1,    202}, {0x00190,    0, 1,    203},
+            {0x00191,    0, 1,      1}, {0x00193,    0, 1,    205}, {0x00194,    0, 1,    207},
+            {0x00196,    0, 1,    211}, {0x00197,    0, 1,    209}, {0x00198,    0, 1,      1},
+            {0x0019c,    0, 1,    211}, {0x0019d,    0, 1,    213}, {0x0019f,    0, 1,    214},
+            {0x001a0,    4, 2,      1}, {0x001a6,    0, 1,    218}, {0x001a7,    0, 1,      1},
+            {0x001a9,    0, 1,    218}, {0x001ac,    0, 1,      1}, {0x001ae,    0, 1,    218},
+            {0x001af,    0, 1,      1}, {0x001b1,    1, 1,    217}, {0x001b3,    2, 2,      1},
+            {0x001b7,    0, 1,    219}, {0x001b8,    0, 1,      1}, {0x001bc,    0, 1,      1},
+            {0x001c4,    0, 1,      2}, {0x001c5,    0, 1,      1}, {0x001c7,    0, 1,      2},
+            {0x001c8,    0, 1,      1}, {0x001ca,    0, 1,      2}, {0x001cb,   16, 2,      1},
+            {0x001de,   16, 2,      1}, {0x001f1,    0, 1,      2}, {0x001f2,    2, 2,      1},
+            {0x001f6,    0, 1,    -97}, {0x001f7,    0, 1,    -56}, {0x001f8,   38, 2,      1},
+            {0x00220,    0, 1,   -130}, {0x00222,   16, 2,      1}, {0x0023a,    0, 1,  10795},
+            {0x0023b,    0, 1,      1}, {0x0023d,    0, 1,   -163}, {0x0023e,    0, 1,  10792},
+            {0x00241,    0, 1,      1}, {0x00243,    0, 1,   -195}, {0x00244,    0, 1,     69},
+            {0x00245,    0, 1,     71}, {0x00246,    8, 2,      1}, {0x00370,    2, 2,      1},
+            {0x00376,    0, 1,      1}, {0x0037f,    0, 1,    116}, {0x00386,    0, 1,     38},
+            {0x00388,    2, 1,     37}, {0x0038c,    0, 1,     64}, {0x0038e,    1, 1,     63},
+            {0x00391,   16, 1,     32}, {0x003a3,    8, 1,     32}, {0x003cf,    0, 1,      8},
+            {0x003d8,   22, 2,      1}, {0x003f4,    0, 1,    -60}, {0x003f7,    0, 1,      1},
+            {0x003f9,    0, 1,     -7}, {0x003fa,    0, 1,      1}, {0x003fd,    2, 1,   -130},
+            {0x00400,   15, 1,     80}, {0x00410,   31, 1,     32}, {0x00460,   32, 2,      1},
+            {0x0048a,   52, 2,      1}, {0x004c0,    0, 1,     15}, {0x004c1,   12, 2,      1},
+            {0x004d0,   94, 2,      1}, {0x00531,   37, 1,     48}, {0x010a0,   37, 1,   7264},
+            {0x010c7,    0, 1,   7264}, {0x010cd,    0, 1,   7264}, {0x013a0,   79, 1,  38864},
+            {0x013f0,    5, 1,      8}, {0x01c90,   42, 1,  -3008}, {0x01cbd,    2, 1,  -3008},
+            {0x01e00,  148, 2,      1}, {0x01e9e,    0, 1,  -7615}, {0x01ea0,   94, 2,      1},
+            {0x01f08,    7, 1,     -8}, {0x01f18,    5, 1,     -8}, {0x01f28,    7, 1,     -8},
+            {0x01f38,    7, 1,     -8}, {0x01f48,    5, 1,     -8}, {0x01f59,    6, 2,     -8},
+            {0x01f68,    7, 1,     -8}, {0x01f88,    7, 1,     -8}, {0x01f98,    7, 1,     -8},
+            {0x01fa8,    7, 1,     -8}, {0x01fb8,    1, 1,     -8}, {0x01fba,    1, 1,    -74},
+            {0x01fbc,    0, 1,     -9}, {0x01fc8,    3, 1,    -86}, {0x01fcc,    0, 1,     -9},
+            {0x01fd8,    1, 1,     -8}, {0x01fda,    1, 1,   -100}, {0x01fe8,    1, 1,     -8},
+            {0x01fea,    1, 1,   -112}, {0x01fec,    0, 1,     -7}, {0x01ff8,    1, 1,   -128},
+            {0x01ffa,    1, 1,   -126}, {0x01ffc,    0, 1,     -9}, {0x02126,    0, 1,  -7517},
+            {0x0212a,    0, 1,  -8383}, {0x0212b,    0, 1,  -8262}, {0x02132,    0, 1,     28},
+            {0x02160,   15, 1,     16}, {0x02183,    0, 1,      1}, {0x024b6,   25, 1,     26},
+            {0x02c00,   47, 1,     48}, {0x02c60,    0, 1,      1}, {0x02c62,    0, 1, -10743},
+            {0x02c63,    0, 1,  -3814}, {0x02c64,    0, 1, -10727}, {0x02c67,    4, 2,      1},
+            {0x02c6d,    0, 1, -10780}, {0x02c6e,    0, 1, -10749}, {0x02c6f,    0, 1, -10783},
+            {0x02c70,    0, 1, -10782}, {0x02c72,    0, 1,      1}, {0x02c75,    0, 1,      1},
+            {0x02c7e,    1, 1, -10815}, {0x02c80,   98, 2,      1}, {0x02ceb,    2, 2,      1},
+            {0x02cf2,    0, 1,      1}, {0x0a640,   44, 2,      1}, {0x0a680,   26, 2,      1},
+            {0x0a722,   12, 2,      1}, {0x0a732,   60, 2,      1}, {0x0a779,    2, 2,      1},
+            {0x0a77d,    0, 1, -35332}, {0x0a77e,    8, 2,      1}, {0x0a78b,    0, 1,      1},
+            {0x0a78d,    0, 1, -42280}, {0x0a790,    2, 2,      1}, {0x0a796,   18, 2,      1},
+            {0x0a7aa,    0, 1, -42308}, {0x0a7ab,    0, 1, -42319}, {0x0a7ac,    0, 1, -42315},
+            {0x0a7ad,    0, 1, -42305}, {0x0a7ae,    0, 1, -42308}, {0x0a7b0,    0, 1, -42258},
+            {0x0a7b1,    0, 1, -42282}, {0x0a7b2,    0, 1, -42261}, {0x0a7b3,    0, 1,    928},
+            {0x0a7b4,   14, 2,      1}, {0x0a7c4,    0, 1,    -48}, {0x0a7c5,    0, 1, -42307},
+            {0x0a7c6,    0, 1, -35384}, {0x0a7c7,    2, 2,      1}, {0x0a7d0,    0, 1,      1},
+            {0x0a7d6,    2, 2,      1}, {0x0a7f5,    0, 1,      1}, {0x0ff21,   25, 1,     32},
+            {0x10400,   39, 1,     40}, {0x104b0,   35, 1,     40}, {0x10570,   10, 1,     39},
+            {0x1057c,   14, 1,     39}, {0x1058c,    6, 1,     39}, {0x10594,    1, 1,     39},
+            {0x10c80,   50, 1,     64}, {0x118a0,   31, 1,     32}, {0x16e40,   31, 1,     32},
+            {0x1e900,   33, 1,     34}
+        };
+
+        inline constexpr CaseRange UpperCaseRanges[] = {
+            {0x000b5,    0, 1,    743}, {0x000e0,   22, 1,    -32}, {0x000f8,    6, 1,    -32},
+            {0x000ff,    0, 1,    121}, {0x00101,   46, 2,     -1}, {0x00131,    0, 1,   -232},
+            {0x00133,    4, 2,     -1}, {0x0013a,   14, 2,     -1}, {0x0014b,   44, 2,     -1},
+            {0x0017a,    4, 2,     -1}, {0x0017f,    0, 1,   -300}, {0x00180,    0, 1,    195},
+            {0x00183,    2, 2,     -1}, {0x00188,    0, 1,     -1}, {0x0018c,    0, 1,     -1},
+            {0x00192,    0, 1,     -1}, {0x00195,    0, 1,     97}, {0x00199,    0, 1,     -1},
+            {0x0019a,    0, 1,    163}, {0x0019e,    0, 1,    130}, {0x001a1,    4, 2,     -1},
+            {0x001a8,    0, 1,     -1}, {0x001ad,    0, 1,     -1}, {0x001b0,    0, 1,     -1},
+            {0x001b4,    2, 2,     -1}, {0x001b9,    0, 1,     -1}, {0x001bd,    0, 1,     -1},
+            {0x001bf,    0, 1,     56}, {0x001c5,    0, 1,     -1}, {0x001c6,    0, 1,     -2},
+            {0x001c8,    0, 1,     -1}, {0x001c9,    0, 1,     -2}, {0x001cb,    0, 1,     -1},
+            {0x001cc,    0, 1,     -2}, {0x001ce,   14, 2,     -1}, {0x001dd,    0, 1,    -79},
+            {0x001df,   16, 2,     -1}, {0x001f2,    0, 1,     -1}, {0x001f3,    0, 1,     -2},
+            {0x001f5,    0, 1,     -1}, {0x001f9,   38, 2,     -1}, {0x00223,   16, 2,     -1},
+            {0x0023c,    0, 1,     -1}, {0x0023f,    1, 1,  10815}, {0x00242,    0, 1,     -1},
+            {0x00247,    8, 2,     -1}, {0x00250,    0, 1,  10783}, {0x00251,    0, 1,  10780},
+            {0x00252,    0, 1,  10782}, {0x00253,    0, 1,   -210}, {0x00254,    0, 1,   -206},
+            {0x00256,    1, 1,   -205}, {0x00259,    0, 1,   -202}, {0x0025b,    0, 1,   -203},
+            {0x0025c,    0, 1,  42319}, {0x00260,    0, 1,   -205}, {0x00261,    0, 1,  42315},
+            {0x00263,    0, 1,   -207}, {0x00265,    0, 1,  42280}, {0x00266,    0, 1,  42308},
+            {0x00268,    0, 1,   -209}, {0x00269,    0, 1,   -211}, {0x0026a,    0, 1,  42308},
+            {0x0026b,    0, 1,  10743}, {0x0026c,    0, 1,  42305}, {0x0026f,    0, 1,   -211},
+            {0x00271,    0, 1,  10749}, {0x00272,    0, 1,   -213}, {0x00275,    0, 1,   -214},
+            {0x0027d,    0, 1,  10727}, {0x00280,    0, 1,   -218}, {0x00282,    0, 1,  42307},
+            {0x00283,    0, 1,   -218}, {0x00287,    0, 1,  42282}, {0x00288,    0, 1,   -218},
+            {0x00289,    0, 1,    -69}, {0x0028a,    1, 1,   -217}, {0x0028c,    0, 1,    -71},
+            {0x00292,    0, 1,   -219}, {0x0029d,    0, 1,  42261}, {0x0029e,    0, 1,  42258},
+            {0x00345,    0, 1,     84}, {0x00371,    2, 2,     -1}, {0x00377,    0, 1,     -1},
+            {0x0037b,    2, 1,    130}, {0x003ac,    0, 1,    -38}, {0x003ad,    2, 1,    -37},
+            {0x003b1,   16, 1,    -32}, {0x003c2,    0, 1,    -31}, {0x003c3,    8, 1,    -32},
+            {0x003cc,    0, 1,    -64}, {0x003cd,    1, 1,    -63}, {0x003d0,    0, 1,    -62},
+            {0x003d1,    0, 1,    -57}, {0x003d5,    0, 1,    -47}, {0x003d6,    0, 1,    -54},
+            {0x003d7,    0, 1,     -8}, {0x003d9,   22, 2,     -1}, {0x003f0,    0, 1,    -86},
+            {0x003f1,    0, 1,    -80}, {0x003f2,    0, 1,      7}, {0x003f3,    0, 1,   -116},
+            {0x003f5,    0, 1,    -96}, {0x003f8,    0, 1,     -1}, {0x003fb,    0, 1,     -1},
+            {0x00430,   31, 1,    -32}, {0x00450,   15, 1,    -80}, {0x00461,   32, 2,     -1},
+            {0x0048b,   52, 2,     -1}, {0x004c2,   12, 2,     -1}, {0x004cf,    0, 1,    -15},
+            {0x004d1,   94, 2,     -1}, {0x00561,   37, 1,    -48}, {0x010d0,   42, 1,   3008},
+            {0x010fd,    2, 1,   3008}, {0x013f8,    5, 1,     -8}, {0x01c80,    0, 1,  -6254},
+            {0x01c81,    0, 1,  -6253}, {0x01c82,    0, 1,  -6244}, {0x01c83,    1, 1,  -6242},
+            {0x01c85,    0, 1,  -6243}, {0x01c86,    0, 1,  -6236}, {0x01c87,    0, 1,  -6181},
+            {0x01c88,    0, 1,  35266}, {0x01d79,    0, 1,  35332}, {0x01d7d,    0, 1,   3814},
+            {0x01d8e,    0, 1,  35384}, {0x01e01,  148, 2,     -1}, {0x01e9b,    0, 1,    -59},
+            {0x01ea1,   94, 2,     -1}, {0x01f00,    7, 1,      8}, {0x01f10,    5, 1,      8},
+            {0x01f20,    7, 1,      8}, {0x01f30,    7, 1,      8}, {0x01f40,    5, 1,      8},
+            {0x01f51,    6, 2,      8}, {0x01f60,    7, 1,      8}, {0x01f70,    1, 1,     74},
+            {0x01f72,    3, 1,     86}, {0x01f76,    1, 1,    100}, {0x01f78,    1, 1,    128},
+            {0x01f7a,    1, 1,    112}, {0x01f7c,    1, 1,    126}, {0x01f80,    7, 1,      8},
+            {0x01f90,    7, 1,      8}, {0x01fa0,    7, 1,      8}, {0x01fb0,    1, 1,      8},
+            {0x01fb3,    0, 1,      9}, {0x01fbe,    0, 1,  -7205}, {0x01fc3,    0, 1,      9},
+            {0x01fd0,    1, 1,      8}, {0x01fe0,    1, 1,      8}, {0x01fe5,    0, 1,      7},
+            {0x01ff3,    0, 1,      9}, {0x0214e,    0, 1,    -28}, {0x02170,   15, 1,    -16},
+            {0x02184,    0, 1,     -1}, {0x024d0,   25, 1,    -26}, {0x02c30,   47, 1,    -48},
+            {0x02c61,    0, 1,     -1}, {0x02c65,    0, 1, -10795}, {0x02c66,    0, 1, -10792},
+            {0x02c68,    4, 2,     -1}, {0x02c73,    0, 1,     -1}, {0x02c76,    0, 1,     -1},
+            {0x02c81,   98, 2,     -1}, {0x02cec,    2, 2,     -1}, {0x02cf3,    0, 1,     -1},
+            {0x02d00,   37, 1,  -7264}, {0x02d27,    0, 1,  -7264}, {0x02d2d,    0, 1,  -7264},
+            {0x0a641,   44, 2,     -1}, {0x0a681,   26, 2,     -1}, {0x0a723,   12, 2,     -1},
+            {0x0a733,   60, 2,     -1}, {0x0a77a,    2, 2,     -1}, {0x0a77f,    8, 2,     -1},
+            {0x0a78c,    0, 1,     -1}, {0x0a791,    2, 2,     -1}, {0x0a794,    0, 1,     48},
+            {0x0a797,   18, 2,     -1}, {0x0a7b5,   14, 2,     -1}, {0x0a7c8,    2, 2,     -1},
+            {0x0a7d1,    0, 1,     -1}, {0x0a7d7,    2, 2,     -1}, {0x0a7f6,    0, 1,     -1},
+            {0x0ab53,    0, 1,   -928}, {0x0ab70,   79, 1, -38864}, {0x0ff41,   25, 1,    -32},
+            {0x10428,   39, 1,    -40}, {0x104d8,   35, 1,    -40}, {0x10597,   10, 1,    -39},
+            {0x105a3,   14, 1,    -39}, {0x105b3,    6, 1,    -39}, {0x105bb,    1, 1,    -39},
+            {0x10cc0,   50, 1,    -64}, {0x118c0,   31, 1,    -32}, {0x16e60,   31, 1,    -32},
+            {0x1e922,   33, 1,    -34}
+        };
+
+        inline constexpr CaseRange FoldCaseRanges[] = {
+            {0x000b5,    0, 1,    775}, {0x000c0,   22, 1,     32}, {0x000d8,    6, 1,     32},
+            {0x00100,   46, 2,      1}, {0x00132,    4, 2,      1}, {0x00139,   14, 2,      1},
+            {0x0014a,   44, 2,      1}, {0x00178,    0, 1,   -121}, {0x00179,    4, 2,      1},
+            {0x0017f,    0, 1,   -268}, {0x00181,    0, 1,    210}, {0x00182,    2, 2,      1},
+            {0x00186,    0, 1,    206}, {0x00187,    0, 1,      1}, {0x00189,    1, 1,    205},
+            {0x0018b,    0, 1,      1}, {0x0018e,    0, 1,     79}, {0x0018f,    0, 1,    202},
+            {0x00190,    0, 1,    203}, {0x00191,    0, 1,      1}, {0x00193,    0, 1,    205},
+            {0x00194,    0, 1,    207}, {0x00196,    0, 1,    211}, {0x00197,    0, 1,    209},
+            {0x00198,    0, 1,      1}, {0x0019c,    0, 1,    211}, {0x0019d,    0, 1,    213},
+            {0x0019f,    0, 1,    214}, {0x001a0,    4, 2,      1}, {0x001a6,    0, 1,    218},
+            {0x001a7,    0, 1,      1}, {0x001a9,    0, 1,    218}, {0x001ac,    0, 1,      1},
+            {0x001ae,    0, 1,    218}, {0x001af,    0, 1,      1}, {0x001b1,    1, 1,    217},
+            {0x001b3,    2, 2,      1}, {0x001b7,    0, 1,    219}, {0x001b8,    0, 1,      1},
+            {0x001bc,    0, 1,      1}, {0x001c4,    0, 1,      2}, {0x001c5,    0, 1,      1},
+            {0x001c7,    0, 1,      2}, {0x001c8,    0, 1,      1}, {0x001ca,    0, 1,      2},
+            {0x001cb,   16, 2,      1}, {0x001de,   16, 2,      1}, {0x001f1,    0, 1,      2},
+            {0x001f2,    2, 2,      1}, {0x001f6,    0, 1,    -97}, {0x001f7,    0, 1,    -56},
+            {0x001f8,   38, 2,      1}, {0x00220,    0, 1,   -130}, {0x00222,   16, 2,      1},
+            {0x0023a,    0, 1,  10795}, {0x0023b,    0, 1,      1}, {0x0023d,    0, 1,   -163},
+            {0x0023e,    0, 1,  10792}, {0x00241,    0, 1,      1}, {0x00243,    0, 1,   -195},
+            {0x00244,    0, 1,     69}, {0x00245,    0, 1,     71}, {0x00246,    8, 2,      1},
+            {0x00345,    0, 1,    116}, {0x00370,    2, 2,      1}, {0x00376,    0, 1,      1},
+            {0x0037f,    0, 1,    116}, {0x00386,    0, 1,     38}, {0x00388,    2, 1,     37},
+            {0x0038c,    0, 1,     64}, {0x0038e,    1, 1,     63}, {0x00391,   16, 1,     32},
+            {0x003a3,    8, 1,     32}, {0x003c2,    0, 1,      1}, {0x003cf,    0, 1,      8},
+            {0x003d0,    0, 1,    -30}, {0x003d1,    0, 1,    -25}, {0x003d5,    0, 1,    -15},
+            {0x003d6,    0, 1,    -22}, {0x003d8,   22, 2,      1}, {0x003f0,    0, 1,    -54},
+            {0x003f1,    0, 1,    -48}, {0x003f4,    0, 1,    -60}, {0x003f5,    0, 1,    -64},
+            {0x003f7,    0, 1,      1}, {0x003f9,    0, 1,     -7}, {0x003fa,    0, 1,      1},
+            {0x003fd,    2, 1,   -130}, {0x00400,   15, 1,     80}, {0x00410,   31, 1,     32},
+            {0x00460,   32, 2,      1}, {0x0048a,   52, 2,      1}, {0x004c0,    0, 1,     15},
+            {0x004c1,   12, 2,      1}, {0x004d0,   94, 2,      1}, {0x00531,   37, 1,     48},
+            {0x010a0,   37, 1,   7264}, {0x010c7,    0, 1,   7264}, {0x010cd,    0, 1,   7264},
+            {0x013f8,    5, 1,     -8}, {0x01c80,    0, 1,  -6222}, {0x01c81,    0, 1,  -6221},
+            {0x01c82,    0, 1,  -6212}, {0x01c83,    1, 1,  -6210}, {0x01c85,    0, 1,  -6211},
+            {0x01c86,    0, 1,  -6204}, {0x01c87,    0, 1,  -6180}, {0x01c88,    0, 1,  35267},
+            {0x01c90,   42, 1,  -3008}, {0x01cbd,    2, 1,  -3008}, {0x01e00,  148, 2,      1},
+            {0x01e9b,    0, 1,    -58}, {0x01e9e,    0, 1,  -7615}, {0x01ea0,   94, 2,      1},
+            {0x01f08,    7, 1,     -8}, {0x01f18,    5, 1,     -8}, {0x01f28,    7, 1,     -8},
+            {0x01f38,    7, 1,     -8}, {0x01f48,    5, 1,     -8}, {0x01f59,    6, 2,     -8},
+            {0x01f68,    7, 1,     -8}, {0x01f88,    7, 1,     -8}, {0x01f98,    7, 1,     -8},
+            {0x01fa8,    7, 1,     -8}, {0x01fb8,    1, 1,     -8}, {0x01fba,    1, 1,    -74},
+            {0x01fbc,    0, 1,     -9}, {0x01fbe,    0, 1,  -7173}, {0x01fc8,    3, 1,    -86},
+            {0x01fcc,    0, 1,     -9}, {0x01fd8,    1, 1,     -8}, {0x01fda,    1, 1,   -100},
+            {0x01fe8,    1, 1,     -8}, {0x01fea,    1, 1,   -112}, {0x01fec,    0, 1,     -7},
+            {0x01ff8,    1, 1,   -128}, {0x01ffa,    1, 1,   -126}, {0x01ffc,    0, 1,     -9},
+            {0x02126,    0, 1,  -7517}, {0x0212a,    0, 1,  -8383}, {0x0212b,    0, 1,  -8262},
+            {0x02132,    0, 1,     28}, {0x02160,   15, 1,     16}, {0x02183,    0, 1,      1},
+            {0x024b6,   25, 1,     26}, {0x02c00,   47, 1,     48}, {0x02c60,    0, 1,      1},
+            {0x02c62,    0, 1, -10743}, {0x02c63,    0, 1,  -3814}, {0x02c64,    0, 1, -10727},
+            {0x02c67,    4, 2,      1}, {0x02c6d,    0, 1, -10780}, {0x02c6e,    0, 1, -10749},
+            {0x02c6f,    0, 1, -10783}, {0x02c70,    0, 1, -10782}, {0x02c72,    0, 1,      1},
+            {0x02c75,    0, 1,      1}, {0x02c7e,    1, 1, -10815}, {0x02c80,   98, 2,      1},
+            {0x02ceb,    2, 2,      1}, {0x02cf2,    0, 1,      1}, {0x0a640,   44, 2,      1},
+            {0x0a680,   26, 2,      1}, {0x0a722,   12, 2,      1}, {0x0a732,   60, 2,      1},
+            {0x0a779,    2, 2,      1}, {0x0a77d,    0, 1, -35332}, {0x0a77e,    8, 2,      1},
+            {0x0a78b,    0, 1,      1}, {0x0a78d,    0, 1, -42280}, {0x0a790,    2, 2,      1},
+            {0x0a796,   18, 2,      1}, {0x0a7aa,    0, 1, -42308}, {0x0a7ab,    0, 1, -42319},
+            {0x0a7ac,    0, 1, -42315}, {0x0a7ad,    0, 1, -42305}, {0x0a7ae,    0, 1, -42308},
+            {0x0a7b0,    0, 1, -42258}, {0x0a7b1,    0, 1, -42282}, {0x0a7b2,    0, 1, -42261},
+            {0x0a7b3,    0, 1,    928}, {0x0a7b4,   14, 2,      1}, {0x0a7c4,    0, 1,    -48},
+            {0x0a7c5,    0, 1, -42307}, {0x0a7c6,    0, 1, -35384}, {0x0a7c7,    2, 2,      1},
+            {0x0a7d0,    0, 1,      1}, {0x0a7d6,    2, 2,      1}, {0x0a7f5,    0, 1,      1},
+            {0x0ab70,   79, 1, -38864}, {0x0ff21,   25, 1,     32}, {0x10400,   39, 1,     40},
+            {0x104b0,   35, 1,     40}, {0x10570,   10, 1,     39}, {0x1057c,   14, 1,     39},
+            {0x1058c,    6, 1,     39}, {0x10594,    1, 1,     39}, {0x10c80,   50, 1,     64},
+            {0x118a0,   31, 1,     32}, {0x16e40,   31, 1,     32}, {0x1e900,   33, 1,     34}
+        };
+
+        /**
+         * Mapping code point by table of case ranges. ASCII code points must be handled by caller
+         * @param ranges Table of case ranges, sorted by first code point
+         * @param codePoint Code point
+         * @return Mapped code point or same code point, if it has no mapping
+         */
+        template<std::uint64_t SizeV>
+        GSTD_CONSTEXPR auto MapCase(const CaseRange (&ranges)[SizeV],
+                                    CodePoint codePoint) GSTD_NOEXCEPT -> CodePoint {
+            std::uint64_t low = 0;
+            std::uint64_t high = SizeV;
+
+            while (low < high) {
+                auto middle = low + (high - low) / 2;
+
+                if (ranges[middle].First <= codePoint) {
+                    low = middle + 1;
+                } else {
+                    high = middle;
+                }
+            }
+
+            if (low == 0) {
+                return codePoint;
+            }
+
+            auto &range = ranges[low - 1];
+            auto offset = codePoint - range.First;
+
+            if (offset > range.Length || offset % range.Stride != 0) {
+                return codePoint;
+            }
+
+            return static_cast<CodePoint>(static_cast<std::int32_t>(codePoint) + range.Delta);
+        }
+
+        /**
+         * Changing case of ASCII letters in 8 bytes at once: bytes from `first` to `last` are XORed with 0x20.
+         * Non-ASCII bytes are not changed
+         * @param word Bytes
+         * @param first First letter of converted case
+         * @param last Last letter of converted case
+         * @return Converted bytes
+         */
+        GSTD_CONSTEXPR auto ChangeAsciiCaseWord(std::uint64_t word,
+                                                char first,
+                                                char last) GSTD_NOEXCEPT -> std::uint64_t {
+            constexpr std::uint64_t LowBitsValue = 0x7f7f7f7f7f7f7f7full;
+            constexpr std::uint64_t HighBitsValue = 0x8080808080808080ull;
+            constexpr std::uint64_t OnesValue = 0x0101010101010101ull;
+
+            auto heptets = word & LowBitsValue;
+            auto aboveFirst = heptets + OnesValue * static_cast<std::uint64_t>(0x80 - first);
+            auto aboveLast = heptets + OnesValue * static_cast<std::uint64_t>(0x80 - last - 1);
+            auto mask = aboveFirst & ~aboveLast & ~word & HighBitsValue;
+
+            return word ^ (mask >> 2);
+        }
+
+        GSTD_CONSTEXPR auto ChangeAsciiCase(char symbol,
+                                            char first,
+                                            char last) GSTD_NOEXCEPT -> char {
+            return symbol >= first && symbol <= last ? static_cast<char>(symbol ^ 0x20) : symbol;
+        }
+
+        /**
+         * Converting case of ASCII bytes at start of string. Output can be same as input
+         * @return Count of converted bytes, conversion stops at first non-ASCII byte
+         */
+        inline auto ConvertAsciiCaseScalar(const char *data,
+                                           std::uint64_t size,
+                                           char *output,
+                                           char first,
+                                           char last) GSTD_NOEXCEPT -> std::uint64_t {
+            std::uint64_t index = 0;
+
+            for (; index + 8 <= size; index += 8) {
+                std::uint64_t word;
+
+                std::memcpy(&word,
+                            data + index,
+                            sizeof(std::uint64_t));
+
+                if ((word & 0x8080808080808080ull) != 0) {
+                    break;
+                }
+
+                word = ChangeAsciiCaseWord(word,
+                                           first,
+                                           last);
+
+                std::memcpy(output + index,
+                            &word,
+                            sizeof(std::uint64_t));
+            }
+
+            for (; index < size && static_cast<std::uint8_t>(data[index]) < 0x80; ++index) {
+                output[index] = ChangeAsciiCase(data[index],
+                                                first,
+                                                last);
+            }
+
+            return index;
+        }
+
+        /**
+         * Finding first byte, where strings are different ignoring case of ASCII letters, or first non-ASCII byte in any string
+         * @return Index of found byte or `size`
+         */
+        inline auto MismatchIgnoreAsciiCaseScalar(const char *first,
+                                                  const char *second,
+                                                  std::uint64_t size) GSTD_NOEXCEPT -> std::uint64_t {
+            std::uint64_t index = 0;
+
+            for (; index + 8 <= size; index += 8) {
+                std::uint64_t firstWord;
+                std::uint64_t secondWord;
+
+                std::memcpy(&firstWord,
+                            first + index,
+                            sizeof(std::uint64_t));
+                std::memcpy(&secondWord,
+                            second + index,
+                            sizeof(std::uint64_t));
+
+                if (((firstWord | secondWord) & 0x8080808080808080ull) != 0
+                    || ChangeAsciiCaseWord(firstWord, 'A', 'Z') != ChangeAsciiCaseWord(secondWord, 'A', 'Z')) {
+                    break;
+                }
+            }
+
+            for (; index < size; ++index) {
+                if (static_cast<std::uint8_t>(first[index] | second[index]) >= 0x80
+                    || ChangeAsciiCase(first[index], 'A', 'Z') != ChangeAsciiCase(second[index], 'A', 'Z')) {
+                    break;
+                }
+            }
+
+            return index;
+        }
+
+#if defined(GSTD_ARCH_X86_64)
+
+        /**
+         * Mask of ASCII letters from `first` to `last` in block. Non-ASCII bytes are negative, so they are not in mask
+         */
+        GSTD_TARGET("avx2")
+        inline auto AsciiRangeMaskAVX2(__m256i block,
+                                       __m256i first,
+                                       __m256i last) GSTD_NOEXCEPT -> __m256i {
+            return _mm256_and_si256(_mm256_cmpgt_epi8(block, first),
+                                    _mm256_cmpgt_epi8(last, block));
+        }
+
+        GSTD_TARGET("avx2,bmi")
+        inline auto ConvertAsciiCaseAVX2(const char *data,
+                                         std::uint64_t size,
+                                         char *output,
+                                         char first,
+                                         char last) GSTD_NOEXCEPT -> std::uint64_t {
+            auto below = _mm256_set1_epi8(static_cast<char>(first - 1));
+            auto above = _mm256_set1_epi8(static_cast<char>(last + 1));
+            auto bit = _mm256_set1_epi8(0x20);
+            std::uint64_t index = 0;
+
+            for (; index + 32 <= size; index += 32) {
+                auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + index));
+
+                if (_mm256_movemask_epi8(block) != 0) {
+                    break;
+                }
+
+                auto mask = AsciiRangeMaskAVX2(block,
+                                               below,
+                                               above);
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + index),
+                                    _mm256_xor_si256(block, _mm256_and_si256(mask, bit)));
+            }
+
+            return index + ConvertAsciiCaseScalar(data + index,
+                                                  size - index,
+                                                  output + index,
+                                                  first,
+                                                  last);
+        }
+
+        GSTD_TARGET("avx2,bmi")
+        inline auto MismatchIgnoreAsciiCaseAVX2(const char *first,
+                                                const char *second,
+                                                std::uint64_t size) GSTD_NOEXCEPT -> std::uint64_t {
+            auto below = _mm256_set1_epi8('A' - 1);
+            auto above = _mm256_set1_epi8('Z' + 1);
+            auto bit = _mm256_set1_epi8(0x20);
+            std::uint64_t index = 0;
+
+            for (; index + 32 <= size; index += 32) {
+                auto firstBlock = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(first + index));
+                auto secondBlock = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(second + index));
+                auto firstLower = _mm256_or_si256(firstBlock,
+                                                  _mm256_and_si256(AsciiRangeMaskAVX2(firstBlock, below, above), bit));
+                auto secondLower = _mm256_or_si256(secondBlock,
+                                                   _mm256_and_si256(AsciiRangeMaskAVX2(secondBlock, below, above), bit));
+                auto equal = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(firstLower, secondLower)));
+                auto nonAscii = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(firstBlock, secondBlock)));
+
+                if (auto mask = ~equal | nonAscii; mask != 0) {
+                    return index + std::countr_zero(mask);
+                }
+            }
+
+            return index + MismatchIgnoreAsciiCaseScalar(first + index,
+                                                         second + index,
+                                                         size - index);
+        }
+
+#endif
+
+        GSTD_INLINE auto ConvertAsciiCase(const char *data,
+                                          std::uint64_t size,
+                                          char *output,
+                                          char first,
+                                          char last) GSTD_NOEXCEPT -> std::uint64_t {
+#if defined(GSTD_ARCH_X86_64)
+            if (CurrentSimdLevel() >= SimdLevel::AVX2) {
+                return ConvertAsciiCaseAVX2(data,
+                                            size,
+                                            output,
+                                            first,
+                                            last);
+            }
+#endif
+
+            return ConvertAsciiCaseScalar(data,
+                                          size,
+                                          output,
+                                          first,
+                                          last);
+        }
+
+        GSTD_INLINE auto MismatchIgnoreAsciiCase(const char *first,
+                                                 const char *second,
+                                                 std::uint64_t size) GSTD_NOEXCEPT -> std::uint64_t {
+#if defined(GSTD_ARCH_X86_64)
+            if (CurrentSimdLevel() >= SimdLevel::AVX2) {
+                return MismatchIgnoreAsciiCaseAVX2(first,
+                                                   second,
+                                                   size);
+            }
+#endif
+
+            return MismatchIgnoreAsciiCaseScalar(first,
+                                                 second,
+                                                 size);
+        }
+
+        /**
+         * Checking, if decoded sequence is invalid. Replacement code point itself has 3 bytes, so it is never decoded from 1 byte
+         */
+        GSTD_CONSTEXPR auto IsInvalidDecoded(const Pair<CodePoint, std::uint64_t> &decoded) GSTD_NOEXCEPT -> bool {
+            return decoded.First() == ReplacementCodePoint && decoded.Second() == 1;
+        }
+
+        /**
+         * Converting case of UTF-8 string. ASCII runs are converted by vectorized kernel, other code points are mapped by table.
+         * Bytes of invalid sequences are copied. Output can be same as input, if `stopOnResize` is set
+         * @param ranges Table of case ranges
+         * @param first First ASCII letter of converted case
+         * @param last Last ASCII letter of converted case
+         * @param stopOnResize Stop before code point, which UTF-8 size is changed by conversion
+         * @return Count of read bytes and count of written bytes. Conversion stops at end of input, when output is full or on resize
+         */
+        template<std::uint64_t SizeV>
+        GSTD_INLINE auto ConvertCase(const char *data,
+                                     std::uint64_t size,
+                                     char *output,
+                                     std::uint64_t capacity,
+                                     const CaseRange (&ranges)[SizeV],
+                                     char first,
+                                     char last,
+                                     bool stopOnResize) GSTD_NOEXCEPT -> Pair<std::uint64_t, std::uint64_t> {
+            std::uint64_t read = 0;
+            std::uint64_t written = 0;
+
+            while (read < size) {
+                auto free = capacity - written;
+                auto count = ConvertAsciiCase(data + read,
+                                              size - read < free ? size - read : free,
+                                              output + written,
+                                              first,
+                                              last);
+
+                read += count;
+                written += count;
+
+                if (read == size || static_cast<std::uint8_t>(data[read]) < 0x80) {
+                    break;
+                }
+
+                auto decoded = DecodeUtf8(data + read,
+                                          data + size);
+
+                if (IsInvalidDecoded(decoded)) {
+                    if (written == capacity) {
+                        break;
+                    }
+
+                    output[written++] = data[read++];
+
+                    continue;
+                }
+
+                auto symbol = Symbol(MapCase(ranges,
+                                             decoded.First()));
+                auto symbolSize = symbol.Utf8Size();
+
+                if ((stopOnResize && symbolSize != decoded.Second()) || symbolSize > capacity - written) {
+                    break;
+                }
+
+                symbol.EncodeUtf8(output + written);
+
+                read += decoded.Second();
+                written += symbolSize;
+            }
+
+            return MakePair(std::move(read),
+                            std::move(written));
+        }
+
+        /**
+         * Counting size of string after case conversion
+         */
+        template<std::uint64_t SizeV>
+        GSTD_INLINE auto ConvertedCaseSize(const char *data,
+                                           std::uint64_t size,
+                                           const CaseRange (&ranges)[SizeV]) GSTD_NOEXCEPT -> std::uint64_t {
+            std::uint64_t index = 0;
+            std::uint64_t result = 0;
+
+            while (index < size) {
+                auto count = AsciiPrefix(data + index,
+                                         size - index,
+                                         size - index);
+
+                index += count;
+                result += count;
+
+                if (index == size) {
+                    break;
+                }
+
+                auto decoded = DecodeUtf8(data + index,
+                                          data + size);
+
+                result += IsInvalidDecoded(decoded) ? 1 : Symbol(MapCase(ranges, decoded.First())).Utf8Size();
+                index += decoded.Second();
+            }
+
+            return result;
+        }
+
+        /**
+         * Converting case of string in place. Code points are converted in place, while their UTF-8 size is not changed,
+         * rest of string is converted into new string with exact size
+         */
+        template<std::uint64_t SizeV>
+        inline auto ConvertCaseInPlace(String &string,
+                                       const CaseRange (&ranges)[SizeV],
+                                       char first,
+                                       char last) -> void {
+            auto size = string.Size();
+            auto converted = ConvertCase(string.Data(),
+                                         size,
+                                         string.Data(),
+                                         size,
+                                         ranges,
+                                         first,
+                                         last,
+                                         true);
+            auto index = converted.First();
+
+            if (index == size) {
+                return;
+            }
+
+            auto restSize = ConvertedCaseSize(string.Data() + index,
+                                              size - index,
+                                              ranges);
+            String result(string.GetAllocator());
+
+            result.ResizeUninitialized(index + restSize);
+
+            std::memcpy(result.Data(),
+                        string.Data(),
+                        index);
+
+            ConvertCase(string.Data() + index,
+                        size - index,
+                        result.Data() + index,
+                        restSize,
+                        ranges,
+                        first,
+                        last,
+                        false);
+
+            string = std::move(result);
+        }
+
+        /**
+         * Code points with folded case are compared as keys. Bytes of invalid sequences are keys after all code points,
+         * so they are different from any code point
+         */
+        inline constexpr std::uint32_t InvalidByteKeyValue = 0x110000;
+
+        /**
+         * Reading folded key of code point and moving to next code point
+         */
+        GSTD_INLINE auto NextFoldedKey(const char *&data,
+                                       const char *end) GSTD_NOEXCEPT -> std::uint32_t {
+            auto byte = static_cast<std::uint8_t>(*data);
+
+            if (byte < 0x80) {
+                ++data;
+
+                return static_cast<std::uint8_t>(ChangeAsciiCase(static_cast<char>(byte), 'A', 'Z'));
+            }
+
+            auto decoded = DecodeUtf8(data,
+                                      end);
+
+            data += decoded.Second();
+
+            if (IsInvalidDecoded(decoded)) {
+                return InvalidByteKeyValue + byte;
+            }
+
+            return MapCase(FoldCaseRanges,
+                           decoded.First());
+        }
+
+        /**
+         * Comparing strings by code points with folded case. ASCII runs are compared by vectorized kernel
+         */
+        GSTD_INLINE auto CompareFolded(const char *first,
+                                       const char *firstEnd,
+                                       const char *second,
+                                       const char *secondEnd) GSTD_NOEXCEPT -> std::strong_ordering {
+            while (true) {
+                auto firstSize = static_cast<std::uint64_t>(firstEnd - first);
+                auto secondSize = static_cast<std::uint64_t>(secondEnd - second);
+                auto count = MismatchIgnoreAsciiCase(first,
+                                                     second,
+                                                     firstSize < secondSize ? firstSize : secondSize);
+
+                first += count;
+                second += count;
+
+                if (first == firstEnd || second == secondEnd) {
+                    return (first != firstEnd) <=> (second != secondEnd);
+                }
+
+                auto firstKey = NextFoldedKey(first,
+                                              firstEnd);
+                auto secondKey = NextFoldedKey(second,
+                                               secondEnd);
+
+                if (firstKey != secondKey) {
+                    return firstKey <=> secondKey;
+                }
+            }
+        }
+
+        /**
+         * Hash state, that takes bytes of folded string by any count and hashes them by words of 8 bytes
+         */
+        class FoldedHasher {
+        public:
+
+            GSTD_INLINE auto WriteWord(std::uint64_t word) GSTD_NOEXCEPT -> void {
+                if (_filled == 0) {
+                    _hash = HashStep(_hash,
+                                     word);
+                } else {
+                    _hash = HashStep(_hash,
+                                     _word | (word << (_filled * 8)));
+                    _word = word >> (64 - _filled * 8);
+                }
+
+                _size += 8;
+            }
+
+            GSTD_INLINE auto WriteByte(std::uint8_t byte) GSTD_NOEXCEPT -> void {
+                _word |= static_cast<std::uint64_t>(byte) << (_filled * 8);
+                _size += 1;
+
+                if (++_filled == 8) {
+                    _hash = HashStep(_hash,
+                                     _word);
+                    _word = 0;
+                    _filled = 0;
+                }
+            }
+
+            GSTD_INLINE auto Finish() GSTD_NOEXCEPT -> std::uint64_t {
+                auto hash = _filled != 0 ? HashStep(_hash, _word) : _hash;
+
+                return HashFinish(HashStep(hash,
+                                           _size));
+            }
+
+        private:
+
+            std::uint64_t _hash = HashSeedValue;
+
+            std::uint64_t _word = 0;
+
+            std::uint64_t _filled = 0;
+
+            std::uint64_t _size = 0;
+        };
+
+    }
+
+    /**
+     * Converting code point to lower case by simple (one to one) mapping
+     * @param symbol Code point
+     * @return Lower case code point or same code point, if it has no lower case
+     */
+    GSTD_CONSTEXPR auto ToLower(Symbol symbol) GSTD_NOEXCEPT -> Symbol {
+        if (symbol.IsAscii()) {
+            return Symbol(static_cast<std::uint8_t>(detail::ChangeAsciiCase(static_cast<char>(symbol.Value()), 'A', 'Z')));
+        }
+
+        return Symbol(detail::MapCase(detail::LowerCaseRanges,
+                                      symbol.Value()));
+    }
+
+    /**
+     * Converting code point to upper case by simple (one to one) mapping
+     * @param symbol Code point
+     * @return Upper case code point or same code point, if it has no upper case
+     */
+    GSTD_CONSTEXPR auto ToUpper(Symbol symbol) GSTD_NOEXCEPT -> Symbol {
+        if (symbol.IsAscii()) {
+            return Symbol(static_cast<std::uint8_t>(detail::ChangeAsciiCase(static_cast<char>(symbol.Value()), 'a', 'z')));
+        }
+
+        return Symbol(detail::MapCase(detail::UpperCaseRanges,
+                                      symbol.Value()));
+    }
+
+    /**
+     * Folding case of code point by simple case folding, for example 'K', 'k' and KELVIN SIGN are folded to 'k'
+     * @param symbol Code point
+     * @return Folded code point
+     */
+    GSTD_CONSTEXPR auto FoldCase(Symbol symbol) GSTD_NOEXCEPT -> Symbol {
+        if (symbol.IsAscii()) {
+            return ToLower(symbol);
+        }
+
+        return Symbol(detail::MapCase(detail::FoldCaseRanges,
+                                      symbol.Value()));
+    }
+
+    /**
+     * Comparing UTF-8 strings ignoring case. Strings are equal, if their code points are equal after simple case folding,
+     * so sizes of equal strings can be different. ASCII runs are compared by 32 bytes with AVX2
+     * @param first First string
+     * @param second Second string
+     * @return Are strings equal ignoring case
+     */
+    GSTD_INLINE auto EqualsIgnoreCase(StringRef first,
+                                      StringRef second) GSTD_NOEXCEPT -> bool {
+        return detail::CompareFolded(first.Data(),
+                                     first.Data() + first.Size(),
+                                     second.Data(),
+                                     second.Data() + second.Size()) == 0;
+    }
+
+    /**
+     * Comparing UTF-8 strings ignoring case by code points after simple case folding. Invalid bytes are greater than all code points
+     * @param first First string
+     * @param second Second string
+     * @return Order of strings
+     */
+    GSTD_INLINE auto CompareIgnoreCase(StringRef first,
+                                       StringRef second) GSTD_NOEXCEPT -> std::strong_ordering {
+        return detail::CompareFolded(first.Data(),
+                                     first.Data() + first.Size(),
+                                     second.Data(),
+                                     second.Data() + second.Size());
+    }
+
+    /**
+     * Hashing UTF-8 string ignoring case. Bytes of string after simple case folding are hashed,
+     * so strings, that are equal by `EqualsIgnoreCase`, have equal hashes. ASCII words are folded without decoding
+     * @param string String
+     * @return Hash of string
+     */
+    GSTD_INLINE auto HashIgnoreCase(StringRef string) GSTD_NOEXCEPT -> std::uint64_t {
+        auto data = string.Data();
+        auto end = data + string.Size();
+        detail::FoldedHasher hasher;
+
+        while (data != end) {
+            if (end - data >= 8) {
+                auto word = detail::LoadHashWord(data,
+                                                 8);
+
+                if ((word & 0x8080808080808080ull) == 0) {
+                    hasher.WriteWord(detail::ChangeAsciiCaseWord(word,
+                                                                 'A',
+                                                                 'Z'));
+
+                    data += 8;
+
+                    continue;
+                }
+            }
+
+            auto key = detail::NextFoldedKey(data,
+                                             end);
+
+            if (key >= detail::InvalidByteKeyValue) {
+                hasher.WriteByte(static_cast<std::uint8_t>(key - detail::InvalidByteKeyValue));
+
+                continue;
+            }
+
+            char buffer[4];
+            auto size = Symbol(key).EncodeUtf8(buffer);
+
+            for (std::uint64_t index = 0; index < size; ++index) {
+                hasher.WriteByte(static_cast<std::uint8_t>(buffer[index]));
+            }
+        }
+
+        return hasher.Finish();
+    }
+
+    /**
+     * Converting UTF-8 string to lower case into buffer. Invalid sequences are copied
+     * @param string String
+     * @param output Buffer
+     * @return Count of written bytes or none, if buffer is too small
+     */
+    GSTD_INLINE auto ToLower(StringRef string,
+                             Span<char> output) GSTD_NOEXCEPT -> Optional<std::uint64_t> {
+        auto converted = detail::ConvertCase(string.Data(),
+                                             string.Size(),
+                                             output.Data(),
+                                             output.Size(),
+                                             detail::LowerCaseRanges,
+                                             'A',
+                                             'Z',
+                                             false);
+
+        if (converted.First() != string.Size()) {
+            return MakeNone();
+        }
+
+        auto size = converted.Second();
+
+        return MakeSome(std::move(size));
+    }
+
+    /**
+     * Converting UTF-8 string to upper case into buffer. Invalid sequences are copied
+     * @param string String
+     * @param output Buffer
+     * @return Count of written bytes or none, if buffer is too small
+     */
+    GSTD_INLINE auto ToUpper(StringRef string,
+                             Span<char> output) GSTD_NOEXCEPT -> Optional<std::uint64_t> {
+        auto converted = detail::ConvertCase(string.Data(),
+                                             string.Size(),
+                                             output.Data(),
+                                             output.Size(),
+                                             detail::UpperCaseRanges,
+                                             'a',
+                                             'z',
+                                             false);
+
+        if (converted.First() != string.Size()) {
+            return MakeNone();
+        }
+
+        auto size = converted.Second();
+
+        return MakeSome(std::move(size));
+    }
+
+    /**
+     * Converting UTF-8 string to lower case in place. String is reallocated only,
+     * if UTF-8 size of some code point is changed, for example U+0130 LATIN CAPITAL LETTER I WITH DOT ABOVE
+     * @param string String
+     */
+    inline auto ToLower(String &string) -> void {
+        detail::ConvertCaseInPlace(string,
+                                   detail::LowerCaseRanges,
+                                   'A',
+                                   'Z');
+    }
+
+    /**
+     * Converting UTF-8 string to upper case in place. String is reallocated only,
+     * if UTF-8 size of some code point is changed, for example U+0131 LATIN SMALL LETTER DOTLESS I
+     * @param string String
+     */
+    inline auto ToUpper(String &string) -> void {
+        detail::ConvertCaseInPlace(string,
+                                   detail::UpperCaseRanges,
+                                   'a',
+                                   'z');
+    }
+
+}
+
+#endif //GSTD_CASEFOLDING_H
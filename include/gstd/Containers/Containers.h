@@ -4,24 +4,38 @@
 #include <gstd/Containers/Array.h>
 #include <gstd/Containers/Bitset.h>
 #include <gstd/Containers/Buffer.h>
+#include <gstd/Containers/CaseFolding.h>
 #include <gstd/Containers/Channel.h>
 #include <gstd/Containers/Colony.h>
 #include <gstd/Containers/Deque.h>
+#include <gstd/Containers/Format.h>
+#include <gstd/Containers/FormatString.h>
 #include <gstd/Containers/Graph.h>
 #include <gstd/Containers/HashMap.h>
 #include <gstd/Containers/HashSet.h>
 #include <gstd/Containers/List.h>
 #include <gstd/Containers/Map.h>
+#include <gstd/Containers/MdSpan.h>
 #include <gstd/Containers/Node.h>
+#include <gstd/Containers/Parse.h>
 #include <gstd/Containers/Queue.h>
 #include <gstd/Containers/Range.h>
+#include <gstd/Containers/Rope.h>
 #include <gstd/Containers/Set.h>
 #include <gstd/Containers/Slice.h>
+#include <gstd/Containers/SliceView.h>
 #include <gstd/Containers/Span.h>
 #include <gstd/Containers/Stack.h>
+#include <gstd/Containers/StaticString.h>
 #include <gstd/Containers/Stream.h>
 #include <gstd/Containers/String.h>
+#include <gstd/Containers/StringBuilder.h>
+#include <gstd/Containers/StringRef.h>
+#include <gstd/Containers/StringSearch.h>
+#include <gstd/Containers/SymbolTable.h>
+#include <gstd/Containers/Transcode.h>
 #include <gstd/Containers/Tree.h>
+#include <gstd/Containers/Utf8.h>
 #include <gstd/Containers/Vector.h>
 
 /*
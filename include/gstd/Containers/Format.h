@@ -0,0 +1,72 @@
+#ifndef GSTD_FORMAT_H
+#define GSTD_FORMAT_H
+
+#include <gstd/Containers/FormatString.h>
+#include <gstd/Containers/Span.h>
+#include <gstd/Type/NumberFormat.h>
+
+namespace gstd {
+
+    /**
+     * Formatting number into buffer without allocation<br>
+     * Integers are written two digits per step. Floating point numbers are written as shortest decimal,
+     * that is parsed back to same value, in fixed or scientific notation like in JavaScript and JSON
+     * @tparam ValueT Arithmetic value type
+     * @param output Buffer
+     * @param value Value
+     * @return Count of written characters or `None`, if buffer is too small. Buffer is not changed in this case
+     */
+    template<typename ValueT>
+    GSTD_CONSTEXPR auto FormatTo(Span<char> output,
+                                 ValueT value) GSTD_NOEXCEPT -> Optional<std::uint64_t> {
+        static_assert(std::is_arithmetic_v<ValueT> && !std::is_same_v<ValueT, long double>,
+                      "`FormatTo` is available only for integers, booleans, `float` and `double`!");
+
+        if (output.Size() >= MaxFormatSizeV<ValueT>) {
+            return MakeSome(detail::WriteNumber(output.Data(),
+                                                value));
+        }
+
+        char buffer[MaxFormatSizeV<ValueT>] = {};
+        auto size = detail::WriteNumber(buffer,
+                                        value);
+
+        if (size > output.Size()) {
+            return MakeNone();
+        }
+
+        for (std::uint64_t index = 0; index < size; ++index) {
+            output.Data()[index] = buffer[index];
+        }
+
+        return MakeSome(std::move(size));
+    }
+
+    /**
+     * Formatting text into buffer without allocation: `FormatTo<"{}: {}">(buffer, key, value)`<br>
+     * Format string is parsed and checked at compile time, `{}` is argument, `{{` and `}}` are braces
+     * @tparam FormatV Format string
+     * @param output Buffer
+     * @param arguments Arguments, that have `Formatter`
+     * @return Count of written characters or `None`, if buffer is too small. Buffer contains beginning of text in this case
+     */
+    template<StaticString FormatV,
+             typename... ArgumentsT>
+    GSTD_CONSTEXPR auto FormatTo(Span<char> output,
+                                 const ArgumentsT &...arguments) -> Optional<std::uint64_t> {
+        detail::FormatBufferWriter writer(output.Data(),
+                                          output.Size());
+
+        detail::FormatWith<FormatV>(writer,
+                                    arguments...);
+
+        if (writer.Size > output.Size()) {
+            return MakeNone();
+        }
+
+        return MakeSome(std::move(writer.Size));
+    }
+
+}
+
+#endif //GSTD_FORMAT_H
@@ -0,0 +1,309 @@
+#ifndef GSTD_FORMATSTRING_H
+#define GSTD_FORMATSTRING_H
+
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+#include <gstd/Containers/StaticString.h>
+#include <gstd/Diagnostic/PanicFormat.h>
+#include <gstd/Type/NumberFormat.h>
+
+namespace gstd {
+
+    /**
+     * Writing value as text. Specialization must have function
+     * `template<typename WriterT> static auto Format(WriterT &writer, const ValueType &value) -> void`,
+     * that calls `writer.Write(data, size)`
+     * @tparam ValueT Value type
+     */
+    template<typename ValueT,
+             typename = void>
+    struct Formatter {
+
+        static_assert(sizeof(ValueT) == 0,
+                      "Type can`t be formatted, specialize `gstd::Formatter` for it!");
+    };
+
+    template<>
+    struct Formatter<char> {
+
+        template<typename WriterT>
+        static GSTD_CONSTEXPR auto Format(WriterT &writer,
+                                          const char &value) -> void {
+            writer.Write(&value,
+                         1);
+        }
+    };
+
+    template<>
+    struct Formatter<const char *> {
+
+        template<typename WriterT>
+        static GSTD_CONSTEXPR auto Format(WriterT &writer,
+                                          const char *const &value) -> void {
+            if (value == nullptr) {
+                writer.Write("(null)",
+                             6);
+
+                return;
+            }
+
+            writer.Write(value,
+                         std::char_traits<char>::length(value));
+        }
+    };
+
+    template<>
+    struct Formatter<char *> : Formatter<const char *> {};
+
+    template<>
+    struct Formatter<std::string_view> {
+
+        template<typename WriterT>
+        static GSTD_CONSTEXPR auto Format(WriterT &writer,
+                                          const std::string_view &value) -> void {
+            writer.Write(value.data(),
+                         value.size());
+        }
+    };
+
+    template<typename ValueT>
+    struct Formatter<ValueT,
+                     std::enable_if_t<std::is_arithmetic_v<ValueT>>> {
+
+        template<typename WriterT>
+        static GSTD_CONSTEXPR auto Format(WriterT &writer,
+                                          const ValueT &value) -> void {
+            char buffer[MaxFormatSizeV<ValueT>] = {};
+
+            writer.Write(buffer,
+                         detail::WriteNumber(buffer,
+                                             value));
+        }
+    };
+
+    template<std::uint64_t CapacityV>
+    struct Formatter<StaticString<CapacityV>> {
+
+        template<typename WriterT>
+        static GSTD_CONSTEXPR auto Format(WriterT &writer,
+                                          const StaticString<CapacityV> &value) -> void {
+            writer.Write(value.Data(),
+                         value.Size());
+        }
+    };
+
+    namespace detail {
+
+        /**
+         * Format string without escapes: literal text and ends of text pieces before each argument and end of text
+         */
+        template<std::uint64_t SizeV,
+                 std::uint64_t CountV>
+        struct ParsedFormat {
+
+            char Text[SizeV + 1];
+
+            std::uint64_t Ends[CountV + 1];
+        };
+
+        /**
+         * Walking format string. `{}` is argument, `{{` and `}}` are escaped braces, other braces are errors
+         * @param literal Function, that is called for each character of text
+         * @param argument Function, that is called for each argument
+         */
+        template<typename LiteralFunctionT,
+                 typename ArgumentFunctionT>
+        GSTD_CONSTEVAL auto WalkFormat(const char *format,
+                                       std::uint64_t size,
+                                       LiteralFunctionT literal,
+                                       ArgumentFunctionT argument) -> void {
+            for (std::uint64_t index = 0; index < size; ++index) {
+                auto next = index + 1 < size ? format[index + 1] : '\0';
+
+                if (format[index] == '{' && next == '}') {
+                    argument();
+                    ++index;
+                } else if (format[index] == '{' && next == '{') {
+                    literal('{');
+                    ++index;
+                } else if (format[index] == '}' && next == '}') {
+                    literal('}');
+                    ++index;
+                } else if (format[index] == '{' || format[index] == '}') {
+                    Panic("Invalid format string: braces must be `{}` or escaped as `{{` and `}}`!");
+                } else {
+                    literal(format[index]);
+                }
+            }
+        }
+
+        template<StaticString FormatV>
+        GSTD_CONSTEVAL auto CountFormatArguments() -> std::uint64_t {
+            std::uint64_t count = 0;
+
+            WalkFormat(FormatV.Data(),
+                       FormatV.Size(),
+                       [] (char) {},
+                       [&count] () { ++count; });
+
+            return count;
+        }
+
+        template<StaticString FormatV>
+        GSTD_CONSTEVAL auto ParseFormat() -> ParsedFormat<FormatV.Size(),
+                                                          CountFormatArguments<FormatV>()> {
+            ParsedFormat<FormatV.Size(),
+                         CountFormatArguments<FormatV>()> format {};
+            std::uint64_t size = 0;
+            std::uint64_t count = 0;
+
+            WalkFormat(FormatV.Data(),
+                       FormatV.Size(),
+                       [&format, &size] (char symbol) { format.Text[size++] = symbol; },
+                       [&format, &size, &count] () { format.Ends[count++] = size; });
+
+            format.Ends[count] = size;
+
+            return format;
+        }
+
+        /**
+         * Format string, that is parsed once at compile time
+         */
+        template<StaticString FormatV>
+        inline constexpr auto ParsedFormatV = ParseFormat<FormatV>();
+
+        /**
+         * Writer into buffer. Characters, that don`t fit, are counted, but not written
+         */
+        class FormatBufferWriter {
+        public:
+
+            GSTD_CONSTEXPR FormatBufferWriter(char *data,
+                                              std::uint64_t capacity) GSTD_NOEXCEPT
+                    : Data(data),
+                      Capacity(capacity),
+                      Size(0) {}
+
+        public:
+
+            GSTD_CONSTEXPR auto Write(const char *data,
+                                      std::uint64_t size) GSTD_NOEXCEPT -> void {
+                auto free = Size < Capacity ? Capacity - Size : 0;
+                auto count = size < free ? size : free;
+
+                if (std::is_constant_evaluated()) {
+                    for (std::uint64_t index = 0; index < count; ++index) {
+                        Data[Size + index] = data[index];
+                    }
+                } else if (count != 0) {
+                    std::memcpy(Data + Size,
+                                data,
+                                count);
+                }
+
+                Size += size;
+            }
+
+        public:
+
+            char *Data;
+
+            std::uint64_t Capacity;
+
+            std::uint64_t Size;
+        };
+
+        class FormatSizeWriter {
+        public:
+
+            GSTD_CONSTEXPR auto Write(const char *,
+                                      std::uint64_t size) GSTD_NOEXCEPT -> void {
+                Size += size;
+            }
+
+        public:
+
+            std::uint64_t Size = 0;
+        };
+
+        /**
+         * Writing format string with arguments. Only literal pieces and arguments are written,
+         * format string is not scanned at runtime
+         * @param writer Writer with function `Write(data, size)`
+         * @param arguments Arguments
+         */
+        template<StaticString FormatV,
+                 typename WriterT,
+                 typename... ArgumentsT>
+        GSTD_CONSTEXPR auto FormatWith(WriterT &writer,
+                                       const ArgumentsT &...arguments) -> void {
+            static_assert(sizeof...(ArgumentsT) == CountFormatArguments<FormatV>(),
+                          "Count of arguments must be equal to count of `{}` in format string!");
+
+            std::uint64_t index = 0;
+            std::uint64_t start = 0;
+
+            auto write = [&writer, &index, &start] (const auto &argument) -> void {
+                auto &format = ParsedFormatV<FormatV>;
+
+                writer.Write(format.Text + start,
+                             format.Ends[index] - start);
+
+                Formatter<std::decay_t<decltype(argument)>>::Format(writer,
+                                                                    argument);
+
+                start = format.Ends[index++];
+            };
+
+            (write(arguments), ...);
+
+            writer.Write(ParsedFormatV<FormatV>.Text + start,
+                         ParsedFormatV<FormatV>.Ends[sizeof...(ArgumentsT)] - start);
+        }
+
+    }
+
+    /**
+     * Counting characters of formatted text
+     * @tparam FormatV Format string, that is checked at compile time
+     * @param arguments Arguments
+     * @return Count of characters
+     */
+    template<StaticString FormatV,
+             typename... ArgumentsT>
+    GSTD_CONSTEXPR auto FormatSize(const ArgumentsT &...arguments) -> std::uint64_t {
+        detail::FormatSizeWriter writer;
+
+        detail::FormatWith<FormatV>(writer,
+                                    arguments...);
+
+        return writer.Size;
+    }
+
+    /**
+     * Formatting message into stack buffer and panic with it. Heap is not used, so it can be called,
+     * when memory is exhausted
+     * @tparam FormatV Format string, that is checked at compile time
+     * @param arguments Arguments
+     */
+    template<StaticString FormatV,
+             typename... ArgumentsT>
+    [[noreturn]] auto PanicFormat(const ArgumentsT &...arguments) -> void {
+        char buffer[detail::PanicMessageSizeValue];
+        detail::FormatBufferWriter writer(buffer,
+                                          detail::PanicMessageSizeValue - 1);
+
+        detail::FormatWith<FormatV>(writer,
+                                    arguments...);
+
+        buffer[writer.Size < writer.Capacity ? writer.Size : writer.Capacity] = '\0';
+
+        Panic(buffer);
+    }
+
+}
+
+#endif //GSTD_FORMATSTRING_H
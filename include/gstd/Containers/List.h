@@ -2,6 +2,7 @@
 #define GSTD_LIST_H
 
 #include <gstd/Containers/Node.h>
+#include <gstd/Type/Optional.h>
 
 namespace gstd {
 
@@ -0,0 +1,796 @@
+#ifndef GSTD_MDSPAN_H
+#define GSTD_MDSPAN_H
+
+#include <utility>
+
+#include <gstd/Containers/Slice.h>
+#include <gstd/Containers/Span.h>
+
+namespace gstd {
+
+    /**
+     * Constant for indicating about extent, that known only at runtime
+     */
+    inline constexpr std::uint64_t DynamicExtent = std::numeric_limits<std::uint64_t>::max();
+
+    /**
+     * Sizes of multidimensional index space. Each extent is known at compile time or equals `DynamicExtent`<br>
+     * Only dynamic extents are stored in object
+     * @tparam ExtentsV Extents
+     */
+    template<std::uint64_t... ExtentsV>
+    class Extents {
+    public:
+
+        using SizeType = std::uint64_t;
+
+        inline static constexpr SizeType RankValue = sizeof...(ExtentsV);
+
+        inline static constexpr SizeType RankDynamicValue = (static_cast<SizeType>(ExtentsV == DynamicExtent) + ... + 0);
+
+    public:
+
+        /**
+         * Constructor with all dynamic extents equal zero
+         */
+        GSTD_CONSTEXPR Extents() GSTD_NOEXCEPT
+                : _dynamic() {}
+
+        /**
+         * Constructor from only dynamic extents or from all extents
+         * @param sizes Extents
+         */
+        template<typename... SizesT,
+                 typename = std::enable_if_t<sizeof...(SizesT) != 0 && (std::is_integral_v<SizesT> && ...)>>
+        GSTD_CONSTEXPR explicit Extents(SizesT... sizes)
+                : _dynamic() {
+            static_assert(sizeof...(SizesT) == RankDynamicValue || sizeof...(SizesT) == RankValue,
+                          "Count of extents must be equal to dynamic rank or rank!");
+
+            SizeType values[] = {static_cast<SizeType>(sizes)...};
+
+            if GSTD_CONSTEXPR (sizeof...(SizesT) == RankDynamicValue) {
+                for (SizeType index = 0; index < RankDynamicValue; ++index) {
+                    _dynamic[index] = values[index];
+                }
+            } else {
+                for (SizeType rank = 0; rank < RankValue; ++rank) {
+                    if (StaticExtent(rank) == DynamicExtent) {
+                        _dynamic[DynamicIndex(rank)] = values[rank];
+                    } else if (StaticExtent(rank) != values[rank]) {
+                        Panic("Extent doesn`t match static extent!");
+                    }
+                }
+            }
+        }
+
+    public:
+
+        static GSTD_CONSTEXPR auto Rank() GSTD_NOEXCEPT -> SizeType {
+            return RankValue;
+        }
+
+        static GSTD_CONSTEXPR auto RankDynamic() GSTD_NOEXCEPT -> SizeType {
+            return RankDynamicValue;
+        }
+
+        /**
+         * Getting compile time extent
+         * @param rank Dimension
+         * @return Extent or `DynamicExtent`
+         */
+        static GSTD_CONSTEXPR auto StaticExtent(const SizeType &rank) GSTD_NOEXCEPT -> SizeType {
+            constexpr SizeType extents[] = {ExtentsV..., 0};
+
+            return extents[rank];
+        }
+
+    public:
+
+        /**
+         * Getting extent
+         * @param rank Dimension
+         * @return Extent
+         */
+        GSTD_CONSTEXPR auto Extent(const SizeType &rank) const GSTD_NOEXCEPT -> SizeType {
+            if (StaticExtent(rank) != DynamicExtent) {
+                return StaticExtent(rank);
+            }
+
+            return _dynamic[DynamicIndex(rank)];
+        }
+
+        /**
+         * Getting count of elements in index space
+         * @return Product of all extents
+         */
+        GSTD_CONSTEXPR auto Size() const GSTD_NOEXCEPT -> SizeType {
+            SizeType size = 1;
+
+            for (SizeType rank = 0; rank < RankValue; ++rank) {
+                size *= Extent(rank);
+            }
+
+            return size;
+        }
+
+    private:
+
+        static GSTD_CONSTEXPR auto DynamicIndex(const SizeType &rank) GSTD_NOEXCEPT -> SizeType {
+            SizeType index = 0;
+
+            for (SizeType previous = 0; previous < rank; ++previous) {
+                index += StaticExtent(previous) == DynamicExtent;
+            }
+
+            return index;
+        }
+
+    private:
+
+        SizeType _dynamic[RankDynamicValue == 0 ? 1 : RankDynamicValue];
+    };
+
+    namespace detail {
+
+        template<std::uint64_t RankV,
+                 typename ExtentsT>
+        struct DynamicExtents;
+
+        template<std::uint64_t... ExtentsV>
+        struct DynamicExtents<0,
+                              Extents<ExtentsV...>> {
+            using Type = Extents<ExtentsV...>;
+        };
+
+        template<std::uint64_t RankV,
+                 std::uint64_t... ExtentsV>
+        struct DynamicExtents<RankV,
+                              Extents<ExtentsV...>> {
+            using Type = typename DynamicExtents<RankV - 1,
+                                                 Extents<ExtentsV...,
+                                                         DynamicExtent>>::Type;
+        };
+
+    }
+
+    /**
+     * Extents with all dynamic extents
+     * @tparam RankV Rank
+     */
+    template<std::uint64_t RankV>
+    using DExtents = typename detail::DynamicExtents<RankV,
+                                                     Extents<>>::Type;
+
+    /**
+     * Row-major layout (last index is contiguous)
+     */
+    class LayoutRight {
+    public:
+
+        template<typename ExtentsT>
+        class Mapping {
+        public:
+
+            using ExtentsType = ExtentsT;
+
+            using SizeType = std::uint64_t;
+
+            inline static constexpr bool IsAlwaysStridedValue = true;
+
+        public:
+
+            GSTD_CONSTEXPR Mapping() GSTD_NOEXCEPT = default;
+
+            GSTD_CONSTEXPR Mapping(const ExtentsType &extents) GSTD_NOEXCEPT
+                    : _extents(extents) {}
+
+        public:
+
+            GSTD_CONSTEXPR auto GetExtents() const GSTD_NOEXCEPT -> const ExtentsType & {
+                return _extents;
+            }
+
+            GSTD_CONSTEXPR auto Stride(const SizeType &rank) const GSTD_NOEXCEPT -> Position {
+                SizeType stride = 1;
+
+                for (auto next = rank + 1; next < ExtentsType::RankValue; ++next) {
+                    stride *= _extents.Extent(next);
+                }
+
+                return static_cast<Position>(stride);
+            }
+
+            GSTD_CONSTEXPR auto RequiredSpanSize() const GSTD_NOEXCEPT -> SizeType {
+                return _extents.Size();
+            }
+
+        public:
+
+            template<typename... IndicesT>
+            GSTD_CONSTEXPR auto operator()(IndicesT... indices) const GSTD_NOEXCEPT -> Position {
+                SizeType offset = 0;
+                SizeType rank = 0;
+
+                ((offset = offset * _extents.Extent(rank++) + static_cast<SizeType>(indices)), ...);
+
+                return static_cast<Position>(offset);
+            }
+
+        private:
+
+            ExtentsType _extents;
+        };
+    };
+
+    /**
+     * Column-major layout (first index is contiguous)
+     */
+    class LayoutLeft {
+    public:
+
+        template<typename ExtentsT>
+        class Mapping {
+        public:
+
+            using ExtentsType = ExtentsT;
+
+            using SizeType = std::uint64_t;
+
+            inline static constexpr bool IsAlwaysStridedValue = true;
+
+        public:
+
+            GSTD_CONSTEXPR Mapping() GSTD_NOEXCEPT = default;
+
+            GSTD_CONSTEXPR Mapping(const ExtentsType &extents) GSTD_NOEXCEPT
+                    : _extents(extents) {}
+
+        public:
+
+            GSTD_CONSTEXPR auto GetExtents() const GSTD_NOEXCEPT -> const ExtentsType & {
+                return _extents;
+            }
+
+            GSTD_CONSTEXPR auto Stride(const SizeType &rank) const GSTD_NOEXCEPT -> Position {
+                SizeType stride = 1;
+
+                for (SizeType previous = 0; previous < rank; ++previous) {
+                    stride *= _extents.Extent(previous);
+                }
+
+                return static_cast<Position>(stride);
+            }
+
+            GSTD_CONSTEXPR auto RequiredSpanSize() const GSTD_NOEXCEPT -> SizeType {
+                return _extents.Size();
+            }
+
+        public:
+
+            template<typename... IndicesT>
+            GSTD_CONSTEXPR auto operator()(IndicesT... indices) const GSTD_NOEXCEPT -> Position {
+                SizeType values[] = {static_cast<SizeType>(indices)..., 0};
+                SizeType offset = 0;
+
+                for (auto rank = ExtentsType::RankValue; rank > 0; --rank) {
+                    offset = offset * _extents.Extent(rank - 1) + values[rank - 1];
+                }
+
+                return static_cast<Position>(offset);
+            }
+
+        private:
+
+            ExtentsType _extents;
+        };
+    };
+
+    /**
+     * Layout with arbitrary (possibly negative) stride for each dimension<br>
+     * Result layout of `SubMdSpan`
+     */
+    class LayoutStride {
+    public:
+
+        template<typename ExtentsT>
+        class Mapping {
+        public:
+
+            using ExtentsType = ExtentsT;
+
+            using SizeType = std::uint64_t;
+
+            inline static constexpr bool IsAlwaysStridedValue = true;
+
+        public:
+
+            GSTD_CONSTEXPR Mapping() GSTD_NOEXCEPT
+                    : _extents(),
+                      _strides() {}
+
+            /**
+             * Main constructor for strided mapping
+             * @param extents Extents
+             * @param strides Pointer to `Rank` strides
+             */
+            GSTD_CONSTEXPR Mapping(const ExtentsType &extents,
+                                   const Position *strides) GSTD_NOEXCEPT
+                    : _extents(extents),
+                      _strides() {
+                for (SizeType rank = 0; rank < ExtentsType::RankValue; ++rank) {
+                    _strides[rank] = strides[rank];
+                }
+            }
+
+        public:
+
+            GSTD_CONSTEXPR auto GetExtents() const GSTD_NOEXCEPT -> const ExtentsType & {
+                return _extents;
+            }
+
+            GSTD_CONSTEXPR auto Stride(const SizeType &rank) const GSTD_NOEXCEPT -> Position {
+                return _strides[rank];
+            }
+
+            /**
+             * Getting count of elements between lowest and highest addressed elements inclusive
+             * @return Required size of memory in elements
+             */
+            GSTD_CONSTEXPR auto RequiredSpanSize() const GSTD_NOEXCEPT -> SizeType {
+                SizeType size = 1;
+
+                for (SizeType rank = 0; rank < ExtentsType::RankValue; ++rank) {
+                    if (_extents.Extent(rank) == 0) {
+                        return 0;
+                    }
+
+                    auto stride = _strides[rank] < 0 ? -_strides[rank] : _strides[rank];
+
+                    size += (_extents.Extent(rank) - 1) * static_cast<SizeType>(stride);
+                }
+
+                return size;
+            }
+
+        public:
+
+            template<typename... IndicesT>
+            GSTD_CONSTEXPR auto operator()(IndicesT... indices) const GSTD_NOEXCEPT -> Position {
+                Position offset = 0;
+                SizeType rank = 0;
+
+                ((offset += static_cast<Position>(indices) * _strides[rank++]), ...);
+
+                return offset;
+            }
+
+        private:
+
+            ExtentsType _extents;
+
+            Position _strides[ExtentsType::RankValue == 0 ? 1 : ExtentsType::RankValue];
+        };
+    };
+
+    /**
+     * Blocked (tiled) layout for matrices. Matrix is split into `BlockRowsV` x `BlockColumnsV` blocks,
+     * blocks are stored in row-major order and each block is stored contiguous in row-major order<br>
+     * Edge blocks are padded, so `RequiredSpanSize` may be greater than count of elements
+     * @tparam BlockRowsV Rows in block
+     * @tparam BlockColumnsV Columns in block
+     */
+    template<std::uint64_t BlockRowsV,
+             std::uint64_t BlockColumnsV>
+    class LayoutBlocked {
+    public:
+
+        inline static constexpr std::uint64_t BlockRowsValue = BlockRowsV;
+
+        inline static constexpr std::uint64_t BlockColumnsValue = BlockColumnsV;
+
+        static_assert(BlockRowsValue > 0 && BlockColumnsValue > 0,
+                      "Block sizes must be positive!");
+
+        template<typename ExtentsT>
+        class Mapping {
+        public:
+
+            using ExtentsType = ExtentsT;
+
+            using SizeType = std::uint64_t;
+
+            inline static constexpr bool IsAlwaysStridedValue = false;
+
+            static_assert(ExtentsType::RankValue == 2,
+                          "`LayoutBlocked` supports only matrices!");
+
+        public:
+
+            GSTD_CONSTEXPR Mapping() GSTD_NOEXCEPT = default;
+
+            GSTD_CONSTEXPR Mapping(const ExtentsType &extents) GSTD_NOEXCEPT
+                    : _extents(extents) {}
+
+        public:
+
+            GSTD_CONSTEXPR auto GetExtents() const GSTD_NOEXCEPT -> const ExtentsType & {
+                return _extents;
+            }
+
+            /**
+             * Getting count of blocks in one row of blocks
+             * @return Count of blocks
+             */
+            GSTD_CONSTEXPR auto BlocksInRow() const GSTD_NOEXCEPT -> SizeType {
+                return (_extents.Extent(1) + BlockColumnsValue - 1) / BlockColumnsValue;
+            }
+
+            /**
+             * Getting count of rows of blocks
+             * @return Count of rows of blocks
+             */
+            GSTD_CONSTEXPR auto BlocksInColumn() const GSTD_NOEXCEPT -> SizeType {
+                return (_extents.Extent(0) + BlockRowsValue - 1) / BlockRowsValue;
+            }
+
+            GSTD_CONSTEXPR auto RequiredSpanSize() const GSTD_NOEXCEPT -> SizeType {
+                return BlocksInColumn() * BlocksInRow() * BlockRowsValue * BlockColumnsValue;
+            }
+
+        public:
+
+            GSTD_CONSTEXPR auto operator()(SizeType row,
+                                           SizeType column) const GSTD_NOEXCEPT -> Position {
+                auto block = (row / BlockRowsValue) * BlocksInRow() + column / BlockColumnsValue;
+                auto offset = block * BlockRowsValue * BlockColumnsValue
+                              + (row % BlockRowsValue) * BlockColumnsValue
+                              + column % BlockColumnsValue;
+
+                return static_cast<Position>(offset);
+            }
+
+        private:
+
+            ExtentsType _extents;
+        };
+    };
+
+    /**
+     * Non-owning multidimensional view over memory
+     * @code
+     * float buffer[12];
+     * MdSpan<float, Extents<3, 4>> matrix(buffer);
+     * matrix(1, 2) = 1.0f;
+     * auto column = SubMdSpan(matrix, Slice::New(NoPos, NoPos), 2); // [matrix(0, 2), matrix(1, 2), matrix(2, 2)]
+     * @endcode
+     * @tparam ValueT Value type
+     * @tparam ExtentsT Extents type
+     * @tparam LayoutT Layout type
+     */
+    template<typename ValueT,
+             typename ExtentsT,
+             typename LayoutT = LayoutRight>
+    class MdSpan {
+    public:
+
+        using ValueType = ValueT;
+
+        using ExtentsType = ExtentsT;
+
+        using LayoutType = LayoutT;
+
+        using MappingType = typename LayoutType::template Mapping<ExtentsType>;
+
+        using SizeType = std::uint64_t;
+
+        using Pointer = ValueType *;
+
+        using Reference = ValueType &;
+
+        inline static constexpr SizeType RankValue = ExtentsType::RankValue;
+
+    public:
+
+        GSTD_CONSTEXPR MdSpan() GSTD_NOEXCEPT
+                : _pointer(nullptr),
+                  _mapping() {}
+
+        GSTD_CONSTEXPR MdSpan(Pointer pointer,
+                              const MappingType &mapping) GSTD_NOEXCEPT
+                : _pointer(pointer),
+                  _mapping(mapping) {}
+
+        GSTD_CONSTEXPR MdSpan(Pointer pointer,
+                              const ExtentsType &extents) GSTD_NOEXCEPT
+                : MdSpan(pointer,
+                         MappingType(extents)) {}
+
+        GSTD_CONSTEXPR explicit MdSpan(Pointer pointer) GSTD_NOEXCEPT
+                : MdSpan(pointer,
+                         ExtentsType()) {}
+
+        template<typename... SizesT,
+                 typename = std::enable_if_t<sizeof...(SizesT) != 0 && (std::is_integral_v<SizesT> && ...)>>
+        GSTD_CONSTEXPR MdSpan(Pointer pointer,
+                              SizesT... sizes)
+                : MdSpan(pointer,
+                         ExtentsType(sizes...)) {}
+
+    public:
+
+        static GSTD_CONSTEXPR auto Rank() GSTD_NOEXCEPT -> SizeType {
+            return RankValue;
+        }
+
+        GSTD_CONSTEXPR auto Extent(const SizeType &rank) const GSTD_NOEXCEPT -> SizeType {
+            return _mapping.GetExtents().Extent(rank);
+        }
+
+        GSTD_CONSTEXPR auto GetExtents() const GSTD_NOEXCEPT -> const ExtentsType & {
+            return _mapping.GetExtents();
+        }
+
+        GSTD_CONSTEXPR auto GetMapping() const GSTD_NOEXCEPT -> const MappingType & {
+            return _mapping;
+        }
+
+        GSTD_CONSTEXPR auto Data() const GSTD_NOEXCEPT -> Pointer {
+            return _pointer;
+        }
+
+        /**
+         * Getting count of elements
+         * @return Product of all extents
+         */
+        GSTD_CONSTEXPR auto Size() const GSTD_NOEXCEPT -> SizeType {
+            return GetExtents().Size();
+        }
+
+        GSTD_CONSTEXPR auto Empty() const GSTD_NOEXCEPT -> bool {
+            return Size() == 0;
+        }
+
+        template<typename... IndicesT>
+        GSTD_CONSTEXPR auto At(IndicesT... indices) const GSTD_NOEXCEPT -> Optional<Ref<ValueType>> {
+            if (!InBounds(indices...)) {
+                return MakeNone();
+            }
+
+            return MakeSome(MakeRef(_pointer[_mapping(indices...)]));
+        }
+
+    public:
+
+        template<typename... IndicesT>
+        GSTD_CONSTEXPR auto operator()(IndicesT... indices) const -> Reference {
+            if (!InBounds(indices...)) {
+                Panic("Index out of range!");
+            }
+
+            return _pointer[_mapping(indices...)];
+        }
+
+    private:
+
+        template<typename... IndicesT>
+        GSTD_CONSTEXPR auto InBounds(IndicesT... indices) const GSTD_NOEXCEPT -> bool {
+            static_assert(sizeof...(IndicesT) == RankValue,
+                          "Count of indices must be equal to rank!");
+
+            SizeType rank = 0;
+
+            return ((static_cast<SizeType>(indices) < Extent(rank++)) && ...);
+        }
+
+    private:
+
+        Pointer _pointer;
+
+        MappingType _mapping;
+    };
+
+    template<typename ValueT,
+             typename... SizesT>
+    MdSpan(ValueT *pointer,
+           SizesT... sizes) -> MdSpan<ValueT,
+                                      DExtents<sizeof...(SizesT)>>;
+
+    /**
+     * Getting sub view of `MdSpan`. Each specifier is `Slice` (dimension is kept) or index (dimension is removed)<br>
+     * Result points into the same memory and has `LayoutStride`
+     * @tparam ValueT Value type
+     * @tparam ExtentsT Extents type
+     * @tparam LayoutT Layout type
+     * @tparam SpecifiersT Types of specifiers
+     * @param span Viewed `MdSpan`
+     * @param specifiers Specifier for each dimension
+     * @return Sub view
+     */
+    template<typename ValueT,
+             typename ExtentsT,
+             typename LayoutT,
+             typename... SpecifiersT>
+    GSTD_CONSTEXPR auto SubMdSpan(const MdSpan<ValueT,
+                                               ExtentsT,
+                                               LayoutT> &span,
+                                  SpecifiersT... specifiers) {
+        using SpanType = MdSpan<ValueT,
+                                ExtentsT,
+                                LayoutT>;
+
+        static_assert(SpanType::MappingType::IsAlwaysStridedValue,
+                      "`SubMdSpan` supports only strided layouts!");
+
+        static_assert(sizeof...(SpecifiersT) == SpanType::RankValue,
+                      "Count of specifiers must be equal to rank!");
+
+        constexpr std::uint64_t RankValue = (static_cast<std::uint64_t>(std::is_same_v<SpecifiersT, Slice>) + ... + 0);
+
+        using ExtentsType = DExtents<RankValue>;
+
+        std::uint64_t extents[RankValue == 0 ? 1 : RankValue] = {};
+        Position strides[RankValue == 0 ? 1 : RankValue] = {};
+        Position offset = 0;
+        std::uint64_t current = 0;
+        std::uint64_t rank = 0;
+
+        auto apply = [&] (const auto &specifier) {
+            auto extent = span.Extent(rank);
+            auto stride = span.GetMapping().Stride(rank);
+
+            if GSTD_CONSTEXPR (std::is_same_v<std::decay_t<decltype(specifier)>, Slice>) {
+                auto bounds = specifier.Resolve(extent);
+
+                if (bounds.GetCount() != 0) {
+                    offset += bounds.GetStart() * stride;
+                }
+
+                extents[current] = bounds.GetCount();
+                strides[current] = stride * bounds.GetStep();
+
+                ++current;
+            } else {
+                if (static_cast<std::uint64_t>(specifier) >= extent) {
+                    Panic("Index out of range!");
+                }
+
+                offset += static_cast<Position>(specifier) * stride;
+            }
+
+            ++rank;
+        };
+
+        (apply(specifiers), ...);
+
+        auto makeExtents = [&extents] <std::uint64_t... RanksV> (std::index_sequence<RanksV...>) -> ExtentsType {
+            if GSTD_CONSTEXPR (sizeof...(RanksV) == 0) {
+                return ExtentsType();
+            } else {
+                return ExtentsType(extents[RanksV]...);
+            }
+        };
+
+        return MdSpan<ValueT,
+                      ExtentsType,
+                      LayoutStride> {
+            span.Data() + offset,
+            typename LayoutStride::template Mapping<ExtentsType>(makeExtents(std::make_index_sequence<RankValue>()),
+                                                                 strides)
+        };
+    }
+
+    /**
+     * Calling function for each tile of `MdSpan` in row-major order of tiles<br>
+     * Edge tiles are clipped to extents
+     * @tparam ValueT Value type
+     * @tparam ExtentsT Extents type
+     * @tparam LayoutT Layout type
+     * @tparam FunctionT Function type
+     * @param span Viewed `MdSpan`
+     * @param tile Extents of tile for each dimension
+     * @param function Function, that takes tile as strided `MdSpan`
+     */
+    template<typename ValueT,
+             typename ExtentsT,
+             typename LayoutT,
+             typename FunctionT>
+    GSTD_CONSTEXPR auto ForEachTile(const MdSpan<ValueT,
+                                                 ExtentsT,
+                                                 LayoutT> &span,
+                                    const std::uint64_t (&tile)[ExtentsT::RankValue],
+                                    FunctionT &&function) -> void {
+        constexpr std::uint64_t RankValue = ExtentsT::RankValue;
+
+        std::uint64_t starts[RankValue] = {};
+
+        for (std::uint64_t rank = 0; rank < RankValue; ++rank) {
+            if (tile[rank] == 0) {
+                Panic("Tile extent can`t be zero!");
+            }
+
+            if (span.Extent(rank) == 0) {
+                return;
+            }
+        }
+
+        auto makeTile = [&] <std::uint64_t... RanksV> (std::index_sequence<RanksV...>) {
+            return SubMdSpan(span,
+                             Slice::New(static_cast<Position>(starts[RanksV]),
+                                        static_cast<Position>(starts[RanksV] + tile[RanksV]))...);
+        };
+
+        while (true) {
+            std::invoke(function,
+                        makeTile(std::make_index_sequence<RankValue>()));
+
+            auto rank = RankValue;
+
+            while (rank > 0) {
+                --rank;
+
+                starts[rank] += tile[rank];
+
+                if (starts[rank] < span.Extent(rank)) {
+                    break;
+                }
+
+                starts[rank] = 0;
+
+                if (rank == 0) {
+                    return;
+                }
+            }
+        }
+    }
+
+    /**
+     * Calling function for each block of matrix with `LayoutBlocked` in memory order<br>
+     * Each block is contiguous in memory, edge blocks are clipped to extents
+     * @tparam ValueT Value type
+     * @tparam ExtentsT Extents type
+     * @tparam BlockRowsV Rows in block
+     * @tparam BlockColumnsV Columns in block
+     * @tparam FunctionT Function type
+     * @param span Viewed `MdSpan`
+     * @param function Function, that takes block as strided `MdSpan`
+     */
+    template<typename ValueT,
+             typename ExtentsT,
+             std::uint64_t BlockRowsV,
+             std::uint64_t BlockColumnsV,
+             typename FunctionT>
+    GSTD_CONSTEXPR auto ForEachBlock(const MdSpan<ValueT,
+                                                  ExtentsT,
+                                                  LayoutBlocked<BlockRowsV,
+                                                                BlockColumnsV>> &span,
+                                     FunctionT &&function) -> void {
+        using ExtentsType = DExtents<2>;
+
+        const auto &mapping = span.GetMapping();
+        const Position strides[] = {static_cast<Position>(BlockColumnsV), 1};
+
+        for (std::uint64_t row = 0; row < mapping.BlocksInColumn(); ++row) {
+            for (std::uint64_t column = 0; column < mapping.BlocksInRow(); ++column) {
+                auto firstRow = row * BlockRowsV;
+                auto firstColumn = column * BlockColumnsV;
+                auto rows = span.Extent(0) - firstRow < BlockRowsV ? span.Extent(0) - firstRow : BlockRowsV;
+                auto columns = span.Extent(1) - firstColumn < BlockColumnsV ? span.Extent(1) - firstColumn : BlockColumnsV;
+
+                std::invoke(function,
+                            MdSpan<ValueT,
+                                   ExtentsType,
+                                   LayoutStride> {
+                                span.Data() + mapping(firstRow,
+                                                      firstColumn),
+                                typename LayoutStride::template Mapping<ExtentsType>(ExtentsType(rows,
+                                                                                                 columns),
+                                                                                     strides)
+                            });
+            }
+        }
+    }
+
+}
+
+#endif //GSTD_MDSPAN_H
@@ -2,6 +2,7 @@
 #define GSTD_NODE_H
 
 #include <gstd/Memory/RawPtr.h>
+#include <gstd/Type/Ref.h>
 
 namespace gstd {
 
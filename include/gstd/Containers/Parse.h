@@ -0,0 +1,888 @@
+#ifndef GSTD_PARSE_H
+#define GSTD_PARSE_H
+
+#include <bit>
+#include <limits>
+
+#include <gstd/Containers/Format.h>
+#include <gstd/Containers/StringRef.h>
+#include <gstd/Type/Result.h>
+
+namespace gstd {
+
+    /**
+     * Errors of parsing
+     */
+    enum class ParseError {
+        Empty,
+        InvalidCharacter,
+        OutOfRange
+    };
+
+    /**
+     * Parsed value with count of consumed characters
+     * @tparam ValueT Value type
+     */
+    template<typename ValueT>
+    struct Parsed {
+
+        ValueT Value;
+
+        std::uint64_t Consumed;
+    };
+
+    namespace detail {
+
+        GSTD_CONSTEXPR auto IsDigit(char symbol) GSTD_NOEXCEPT -> bool {
+            return static_cast<std::uint8_t>(symbol - '0') < 10;
+        }
+
+        GSTD_CONSTEXPR auto HexDigitValue(char symbol) GSTD_NOEXCEPT -> std::uint8_t {
+            if (IsDigit(symbol)) {
+                return static_cast<std::uint8_t>(symbol - '0');
+            }
+
+            auto lower = static_cast<std::uint8_t>(static_cast<std::uint8_t>(symbol | 0x20) - 'a');
+
+            return lower < 6 ? static_cast<std::uint8_t>(lower + 10) : 16;
+        }
+
+        /**
+         * Checking, that all 8 bytes of little-endian word are decimal digits
+         */
+        GSTD_CONSTEXPR auto IsEightDigits(std::uint64_t word) GSTD_NOEXCEPT -> bool {
+            return ((word & 0xf0f0f0f0f0f0f0f0ull) | (((word + 0x0606060606060606ull) & 0xf0f0f0f0f0f0f0f0ull) >> 4)) == 0x3333333333333333ull;
+        }
+
+        /**
+         * Converting 8 decimal digits in little-endian word to number with three multiplications:
+         * digits are combined in pairs, then in quads, then in whole number
+         */
+        GSTD_CONSTEXPR auto ParseEightDigits(std::uint64_t word) GSTD_NOEXCEPT -> std::uint64_t {
+            word -= 0x3030303030303030ull;
+            word = word * 10 + (word >> 8);
+
+            return (((word & 0x000000ff000000ffull) * (100 + (1000000ull << 32)))
+                    + (((word >> 16) & 0x000000ff000000ffull) * (1 + (10000ull << 32)))) >> 32;
+        }
+
+        /**
+         * Accumulating decimal digits starting from `index`, 8 digits per step. Value wraps, if digits don`t fit
+         * @return Index after last digit
+         */
+        GSTD_CONSTEXPR auto AccumulateDigits(const char *data,
+                                             std::uint64_t size,
+                                             std::uint64_t index,
+                                             std::uint64_t &value) GSTD_NOEXCEPT -> std::uint64_t {
+            while (size - index >= 8) {
+                auto word = LoadHashWord(data + index,
+                                         8);
+
+                if (!IsEightDigits(word)) {
+                    break;
+                }
+
+                value = value * 100000000 + ParseEightDigits(word);
+                index += 8;
+            }
+
+            while (index < size && IsDigit(data[index])) {
+                value = value * 10 + static_cast<std::uint64_t>(data[index] - '0');
+                ++index;
+            }
+
+            return index;
+        }
+
+        template<typename ValueT>
+        GSTD_CONSTEXPR auto ParseIntegerPrefix(StringRef string,
+                                               bool hex) GSTD_NOEXCEPT -> Result<Parsed<ValueT>,
+                                                                                 ParseError> {
+            auto data = string.Data();
+            auto size = string.Size();
+
+            if (size == 0) {
+                return MakeErr(ParseError::Empty);
+            }
+
+            std::uint64_t index = 0;
+            auto negative = false;
+
+            if (data[0] == '+' || (std::is_signed_v<ValueT> && data[0] == '-')) {
+                negative = data[0] == '-';
+                ++index;
+            }
+
+            auto start = index;
+
+            while (index < size && data[index] == '0') {
+                ++index;
+            }
+
+            auto significant = index;
+            std::uint64_t value = 0;
+            auto overflow = false;
+
+            if (hex) {
+                for (std::uint8_t digit; index < size && (digit = HexDigitValue(data[index])) < 16; ++index) {
+                    value = (value << 4) | digit;
+                }
+
+                overflow = index - significant > 16;
+            } else {
+                index = AccumulateDigits(data,
+                                         size,
+                                         index,
+                                         value);
+
+                if (index - significant == 20) {
+                    std::uint64_t head = 0;
+
+                    for (auto position = significant; position < index - 1; ++position) {
+                        head = head * 10 + static_cast<std::uint64_t>(data[position] - '0');
+                    }
+
+                    overflow = head > 1844674407370955161ull || (head == 1844674407370955161ull && data[index - 1] > '5');
+                } else {
+                    overflow = index - significant > 20;
+                }
+            }
+
+            if (index == start) {
+                return MakeErr(ParseError::InvalidCharacter);
+            }
+
+            auto limit = static_cast<std::uint64_t>(std::numeric_limits<ValueT>::max()) + (negative ? 1 : 0);
+
+            if (overflow || value > limit) {
+                return MakeErr(ParseError::OutOfRange);
+            }
+
+            return MakeOk(Parsed<ValueT> {
+                static_cast<ValueT>(negative ? 0 - value : value),
+                index
+            });
+        }
+
+        template<typename FloatT>
+        struct ParseTraits;
+
+        template<>
+        struct ParseTraits<double> {
+
+            using BitsType = std::uint64_t;
+
+            static constexpr std::int32_t SignificandBitsValue = 52;
+
+            static constexpr std::int32_t MinExponentValue = -1023;
+
+            static constexpr std::int32_t InfinitePowerValue = 0x7ff;
+
+            static constexpr std::int64_t SmallestPowerOf10Value = -342;
+
+            static constexpr std::int64_t LargestPowerOf10Value = 308;
+
+            static constexpr std::int64_t MinRoundToEvenExponentValue = -4;
+
+            static constexpr std::int64_t MaxRoundToEvenExponentValue = 23;
+
+            static constexpr std::int64_t MaxExactPowerOf10Value = 22;
+
+            static constexpr double ExactPowersOf10Value[] = {
+                1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+            };
+        };
+
+        template<>
+        struct ParseTraits<float> {
+
+            using BitsType = std::uint32_t;
+
+            static constexpr std::int32_t SignificandBitsValue = 23;
+
+            static constexpr std::int32_t MinExponentValue = -127;
+
+            static constexpr std::int32_t InfinitePowerValue = 0xff;
+
+            static constexpr std::int64_t SmallestPowerOf10Value = -64;
+
+            static constexpr std::int64_t LargestPowerOf10Value = 38;
+
+            static constexpr std::int64_t MinRoundToEvenExponentValue = -17;
+
+            static constexpr std::int64_t MaxRoundToEvenExponentValue = 10;
+
+            static constexpr std::int64_t MaxExactPowerOf10Value = 10;
+
+            static constexpr float ExactPowersOf10Value[] = {
+                1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+            };
+        };
+
+        /**
+         * Binary floating point number: significand without hidden bit and biased exponent
+         */
+        struct BinaryFloat {
+
+            std::uint64_t Significand;
+
+            std::int32_t Exponent;
+        };
+
+        /**
+         * Rounding `significand * 10^exponent` to nearest floating point number with Eisel-Lemire algorithm
+         * (D. Lemire, "Number Parsing at a Gigabyte per Second"). Truncated 128-bit power of 10 is always enough
+         * (N. Mushtak, D. Lemire, "Fast Number Parsing Without Fallback")
+         */
+        template<typename FloatT>
+        GSTD_CONSTEXPR auto EiselLemire(std::uint64_t significand,
+                                        std::int64_t exponent) GSTD_NOEXCEPT -> BinaryFloat {
+            using Traits = ParseTraits<FloatT>;
+
+            if (significand == 0 || exponent < Traits::SmallestPowerOf10Value) {
+                return BinaryFloat {0, 0};
+            }
+
+            if (exponent > Traits::LargestPowerOf10Value) {
+                return BinaryFloat {0, Traits::InfinitePowerValue};
+            }
+
+            auto leadingZeros = std::countl_zero(significand);
+
+            significand <<= leadingZeros;
+
+            auto power = Pow10CacheValue.Values[exponent - Pow10MinExponentValue];
+
+            // Cache keeps powers rounded up, algorithm needs them truncated except small negative powers
+            if (exponent < -27 || exponent >= 0) {
+                power.High -= power.Low == 0 ? 1 : 0;
+                power.Low -= 1;
+            }
+
+            auto product = Multiply64(significand,
+                                      power.High);
+            auto precisionMask = ~0ull >> (Traits::SignificandBitsValue + 3);
+
+            if ((product.High & precisionMask) == precisionMask) {
+                auto low = Multiply64(significand,
+                                      power.Low);
+
+                product.Low += low.High;
+                product.High += low.High > product.Low ? 1 : 0;
+            }
+
+            auto upperBit = static_cast<std::int32_t>(product.High >> 63);
+            auto shift = upperBit + 64 - Traits::SignificandBitsValue - 3;
+
+            BinaryFloat result {
+                product.High >> shift,
+                static_cast<std::int32_t>((((152170 + 65536) * exponent) >> 16) + 63) + upperBit - leadingZeros - Traits::MinExponentValue
+            };
+
+            if (result.Exponent <= 0) {
+                if (-result.Exponent + 1 >= 64) {
+                    return BinaryFloat {0, 0};
+                }
+
+                result.Significand >>= -result.Exponent + 1;
+                result.Significand += result.Significand & 1;
+                result.Significand >>= 1;
+                result.Exponent = result.Significand < (1ull << Traits::SignificandBitsValue) ? 0 : 1;
+
+                return result;
+            }
+
+            // Exact halfway between two floats must round to even
+            if (product.Low <= 1
+                && exponent >= Traits::MinRoundToEvenExponentValue
+                && exponent <= Traits::MaxRoundToEvenExponentValue
+                && (result.Significand & 3) == 1
+                && (result.Significand << shift) == product.High) {
+                result.Significand &= ~1ull;
+            }
+
+            result.Significand += result.Significand & 1;
+            result.Significand >>= 1;
+
+            if (result.Significand >= (2ull << Traits::SignificandBitsValue)) {
+                result.Significand = 1ull << Traits::SignificandBitsValue;
+                ++result.Exponent;
+            }
+
+            result.Significand &= ~(1ull << Traits::SignificandBitsValue);
+
+            if (result.Exponent >= Traits::InfinitePowerValue) {
+                return BinaryFloat {0, Traits::InfinitePowerValue};
+            }
+
+            return result;
+        }
+
+        /**
+         * Decimal number with many digits for exact rounding of long inputs: `0.Digits * 10^Point`
+         */
+        struct LongDecimal {
+
+            static constexpr std::uint32_t MaxDigitsValue = 800;
+
+            static constexpr std::int32_t MaxShiftValue = 60;
+
+            static constexpr std::int32_t PointRangeValue = 2047;
+
+            GSTD_CONSTEXPR auto Trim() GSTD_NOEXCEPT -> void {
+                while (Count != 0 && Digits[Count - 1] == 0) {
+                    --Count;
+                }
+            }
+
+            GSTD_CONSTEXPR auto ShiftLeft(std::int32_t shift) GSTD_NOEXCEPT -> void {
+                if (Count == 0) {
+                    return;
+                }
+
+                std::uint8_t output[MaxDigitsValue + 20] = {};
+                std::uint32_t position = MaxDigitsValue + 20;
+                std::uint64_t value = 0;
+
+                for (auto index = Count; index > 0; --index) {
+                    value += static_cast<std::uint64_t>(Digits[index - 1]) << shift;
+                    output[--position] = static_cast<std::uint8_t>(value % 10);
+                    value /= 10;
+                }
+
+                for (; value != 0; value /= 10) {
+                    output[--position] = static_cast<std::uint8_t>(value % 10);
+                }
+
+                auto produced = MaxDigitsValue + 20 - position;
+                auto kept = produced < MaxDigitsValue ? produced : MaxDigitsValue;
+
+                for (std::uint32_t index = 0; index < produced; ++index) {
+                    if (index < kept) {
+                        Digits[index] = output[position + index];
+                    } else if (output[position + index] != 0) {
+                        Truncated = true;
+                    }
+                }
+
+                Point += static_cast<std::int32_t>(produced - Count);
+                Count = kept;
+
+                Trim();
+            }
+
+            GSTD_CONSTEXPR auto ShiftRight(std::int32_t shift) GSTD_NOEXCEPT -> void {
+                std::uint32_t read = 0;
+                std::uint32_t write = 0;
+                std::uint64_t value = 0;
+
+                while ((value >> shift) == 0) {
+                    if (read < Count) {
+                        value = value * 10 + Digits[read++];
+                    } else if (value == 0) {
+                        return;
+                    } else {
+                        while ((value >> shift) == 0) {
+                            value *= 10;
+                            ++read;
+                        }
+
+                        break;
+                    }
+                }
+
+                Point -= static_cast<std::int32_t>(read) - 1;
+
+                if (Point < -PointRangeValue) {
+                    Count = 0;
+                    Point = 0;
+                    Truncated = false;
+
+                    return;
+                }
+
+                auto mask = (1ull << shift) - 1;
+
+                while (read < Count) {
+                    auto digit = static_cast<std::uint8_t>(value >> shift);
+
+                    value = (value & mask) * 10 + Digits[read++];
+                    Digits[write++] = digit;
+                }
+
+                while (value != 0) {
+                    auto digit = static_cast<std::uint8_t>(value >> shift);
+
+                    value = (value & mask) * 10;
+
+                    if (write < MaxDigitsValue) {
+                        Digits[write++] = digit;
+                    } else if (digit != 0) {
+                        Truncated = true;
+                    }
+                }
+
+                Count = write;
+
+                Trim();
+            }
+
+            /**
+             * Rounding integer part to nearest, ties to even
+             */
+            GSTD_CONSTEXPR auto Round() const GSTD_NOEXCEPT -> std::uint64_t {
+                if (Count == 0 || Point < 0) {
+                    return 0;
+                }
+
+                if (Point > 18) {
+                    return ~0ull;
+                }
+
+                auto point = static_cast<std::uint32_t>(Point);
+                std::uint64_t value = 0;
+
+                for (std::uint32_t index = 0; index < point; ++index) {
+                    value = value * 10 + (index < Count ? Digits[index] : 0);
+                }
+
+                auto roundUp = false;
+
+                if (point < Count) {
+                    roundUp = Digits[point] >= 5;
+
+                    if (Digits[point] == 5 && point + 1 == Count) {
+                        roundUp = Truncated || (point > 0 && (Digits[point - 1] & 1) != 0);
+                    }
+                }
+
+                return value + (roundUp ? 1 : 0);
+            }
+
+            std::uint32_t Count;
+
+            std::int32_t Point;
+
+            bool Truncated;
+
+            std::uint8_t Digits[MaxDigitsValue];
+        };
+
+        /**
+         * Exact conversion of decimal to floating point number by shifting it with powers of 2 (Simple Decimal
+         * Conversion algorithm). It is slow, so it is used only, when significand has more than 19 digits
+         * and Eisel-Lemire can`t decide rounding
+         */
+        template<typename FloatT>
+        GSTD_CONSTEXPR auto DecimalToBinary(LongDecimal &decimal) GSTD_NOEXCEPT -> BinaryFloat {
+            using Traits = ParseTraits<FloatT>;
+
+            constexpr std::int32_t shifts[] = {0, 3, 6, 9, 13, 16, 19, 23, 26, 29, 33, 36, 39, 43, 46, 49, 53, 56, 59};
+
+            auto shiftFor = [&shifts] (std::int32_t point) -> std::int32_t {
+                return point < 19 ? shifts[point] : LongDecimal::MaxShiftValue;
+            };
+
+            if (decimal.Count == 0 || decimal.Point < -324) {
+                return BinaryFloat {0, 0};
+            }
+
+            if (decimal.Point >= 310) {
+                return BinaryFloat {0, Traits::InfinitePowerValue};
+            }
+
+            std::int32_t exponent = 0;
+
+            while (decimal.Point > 0) {
+                auto shift = shiftFor(decimal.Point);
+
+                decimal.ShiftRight(shift);
+
+                if (decimal.Point < -LongDecimal::PointRangeValue) {
+                    return BinaryFloat {0, 0};
+                }
+
+                exponent += shift;
+            }
+
+            while (decimal.Point <= 0) {
+                std::int32_t shift;
+
+                if (decimal.Point == 0) {
+                    if (decimal.Digits[0] >= 5) {
+                        break;
+                    }
+
+                    shift = decimal.Digits[0] < 2 ? 2 : 1;
+                } else {
+                    shift = shiftFor(-decimal.Point);
+                }
+
+                decimal.ShiftLeft(shift);
+
+                if (decimal.Point > LongDecimal::PointRangeValue) {
+                    return BinaryFloat {0, Traits::InfinitePowerValue};
+                }
+
+                exponent -= shift;
+            }
+
+            --exponent;
+
+            while (Traits::MinExponentValue + 1 > exponent) {
+                auto shift = Traits::MinExponentValue + 1 - exponent;
+
+                shift = shift < LongDecimal::MaxShiftValue ? shift : LongDecimal::MaxShiftValue;
+
+                decimal.ShiftRight(shift);
+                exponent += shift;
+            }
+
+            if (exponent - Traits::MinExponentValue >= Traits::InfinitePowerValue) {
+                return BinaryFloat {0, Traits::InfinitePowerValue};
+            }
+
+            decimal.ShiftLeft(Traits::SignificandBitsValue + 1);
+
+            auto significand = decimal.Round();
+
+            if (significand >= (2ull << Traits::SignificandBitsValue)) {
+                decimal.ShiftRight(1);
+                ++exponent;
+                significand = decimal.Round();
+
+                if (exponent - Traits::MinExponentValue >= Traits::InfinitePowerValue) {
+                    return BinaryFloat {0, Traits::InfinitePowerValue};
+                }
+            }
+
+            BinaryFloat result {
+                significand & ((1ull << Traits::SignificandBitsValue) - 1),
+                exponent - Traits::MinExponentValue
+            };
+
+            if (significand < (1ull << Traits::SignificandBitsValue)) {
+                --result.Exponent;
+            }
+
+            return result;
+        }
+
+        template<typename FloatT>
+        GSTD_CONSTEXPR auto ParseFloatPrefix(StringRef string) GSTD_NOEXCEPT -> Result<Parsed<FloatT>,
+                                                                                       ParseError> {
+            using Traits = ParseTraits<FloatT>;
+            using BitsType = typename Traits::BitsType;
+
+            auto data = string.Data();
+            auto size = string.Size();
+
+            if (size == 0) {
+                return MakeErr(ParseError::Empty);
+            }
+
+            std::uint64_t index = 0;
+            auto negative = false;
+
+            if (data[0] == '+' || data[0] == '-') {
+                negative = data[0] == '-';
+                ++index;
+            }
+
+            auto sign = [negative] (FloatT value) -> FloatT {
+                return negative ? -value : value;
+            };
+
+            auto matches = [data, size, &index] (StringRef word) -> bool {
+                if (size - index < word.Size()) {
+                    return false;
+                }
+
+                for (std::uint64_t position = 0; position < word.Size(); ++position) {
+                    if ((data[index + position] | 0x20) != word.Data()[position]) {
+                        return false;
+                    }
+                }
+
+                index += word.Size();
+
+                return true;
+            };
+
+            if (matches("nan")) {
+                return MakeOk(Parsed<FloatT> {
+                    sign(std::numeric_limits<FloatT>::quiet_NaN()),
+                    index
+                });
+            }
+
+            if (matches("inf")) {
+                matches("inity");
+
+                return MakeOk(Parsed<FloatT> {
+                    sign(std::numeric_limits<FloatT>::infinity()),
+                    index
+                });
+            }
+
+            std::uint64_t significand = 0;
+            auto integerStart = index;
+
+            index = AccumulateDigits(data,
+                                     size,
+                                     index,
+                                     significand);
+
+            auto integerEnd = index;
+            auto fractionStart = index;
+            auto fractionEnd = index;
+
+            if (index < size && data[index] == '.') {
+                fractionStart = index + 1;
+                fractionEnd = AccumulateDigits(data,
+                                               size,
+                                               fractionStart,
+                                               significand);
+                index = fractionEnd;
+            }
+
+            auto digitCount = (integerEnd - integerStart) + (fractionEnd - fractionStart);
+
+            if (digitCount == 0) {
+                return MakeErr(ParseError::InvalidCharacter);
+            }
+
+            std::int64_t explicitExponent = 0;
+
+            if (index < size && (data[index] | 0x20) == 'e') {
+                auto position = index + 1;
+                auto negativeExponent = false;
+
+                if (position < size && (data[position] == '+' || data[position] == '-')) {
+                    negativeExponent = data[position] == '-';
+                    ++position;
+                }
+
+                if (position < size && IsDigit(data[position])) {
+                    for (; position < size && IsDigit(data[position]); ++position) {
+                        if (explicitExponent < 0x10000) {
+                            explicitExponent = explicitExponent * 10 + (data[position] - '0');
+                        }
+                    }
+
+                    explicitExponent = negativeExponent ? -explicitExponent : explicitExponent;
+                    index = position;
+                }
+            }
+
+            auto exponent = explicitExponent - static_cast<std::int64_t>(fractionEnd - fractionStart);
+            auto truncated = false;
+
+            if (digitCount > 19) {
+                for (auto position = integerStart; position < fractionEnd && (data[position] == '0' || data[position] == '.'); ++position) {
+                    digitCount -= data[position] == '0' ? 1 : 0;
+                }
+
+                if (digitCount > 19) {
+                    truncated = true;
+                    significand = 0;
+
+                    auto position = integerStart;
+
+                    for (; significand < 1000000000000000000ull && position < integerEnd; ++position) {
+                        significand = significand * 10 + static_cast<std::uint64_t>(data[position] - '0');
+                    }
+
+                    if (significand >= 1000000000000000000ull) {
+                        exponent = explicitExponent + static_cast<std::int64_t>(integerEnd - position);
+                    } else {
+                        for (position = fractionStart; significand < 1000000000000000000ull && position < fractionEnd; ++position) {
+                            significand = significand * 10 + static_cast<std::uint64_t>(data[position] - '0');
+                        }
+
+                        exponent = explicitExponent - static_cast<std::int64_t>(position - fractionStart);
+                    }
+                }
+            }
+
+            // Clinger`s fast path: significand and power of 10 are exact, so one rounding gives correct result
+            if (!truncated
+                && significand <= (1ull << (Traits::SignificandBitsValue + 1))
+                && exponent >= -Traits::MaxExactPowerOf10Value
+                && exponent <= Traits::MaxExactPowerOf10Value) {
+                auto value = static_cast<FloatT>(significand);
+
+                value = exponent < 0
+                        ? value / Traits::ExactPowersOf10Value[-exponent]
+                        : value * Traits::ExactPowersOf10Value[exponent];
+
+                return MakeOk(Parsed<FloatT> {
+                    sign(value),
+                    index
+                });
+            }
+
+            auto binary = EiselLemire<FloatT>(significand,
+                                              exponent);
+
+            if (truncated) {
+                auto next = EiselLemire<FloatT>(significand + 1,
+                                                exponent);
+
+                if (next.Significand != binary.Significand || next.Exponent != binary.Exponent) {
+                    LongDecimal decimal {};
+                    std::int64_t point = 0;
+
+                    auto append = [&decimal, &point] (char symbol, bool fraction) -> void {
+                        auto digit = static_cast<std::uint8_t>(symbol - '0');
+
+                        if (decimal.Count == 0 && digit == 0) {
+                            point -= fraction ? 1 : 0;
+
+                            return;
+                        }
+
+                        if (decimal.Count < LongDecimal::MaxDigitsValue) {
+                            decimal.Digits[decimal.Count++] = digit;
+                        } else if (digit != 0) {
+                            decimal.Truncated = true;
+                        }
+
+                        point += fraction ? 0 : 1;
+                    };
+
+                    for (auto position = integerStart; position < integerEnd; ++position) {
+                        append(data[position], false);
+                    }
+
+                    for (auto position = fractionStart; position < fractionEnd; ++position) {
+                        append(data[position], true);
+                    }
+
+                    point += explicitExponent;
+                    decimal.Point = static_cast<std::int32_t>(point < -100000 ? -100000 : (point > 100000 ? 100000 : point));
+                    decimal.Trim();
+
+                    binary = DecimalToBinary<FloatT>(decimal);
+                }
+            }
+
+            if (binary.Exponent == Traits::InfinitePowerValue) {
+                return MakeErr(ParseError::OutOfRange);
+            }
+
+            auto bits = static_cast<BitsType>(binary.Significand)
+                        | (static_cast<BitsType>(binary.Exponent) << Traits::SignificandBitsValue);
+
+            return MakeOk(Parsed<FloatT> {
+                sign(std::bit_cast<FloatT>(bits)),
+                index
+            });
+        }
+
+    }
+
+    /**
+     * Parsing value from start of string. Characters after value are not consumed, so it can be used in tokenizers<br>
+     * Integers are parsed 8 digits per step, floating point numbers are rounded correctly with Eisel-Lemire algorithm.
+     * Parsing is independent of locale, doesn`t allocate and doesn`t throw<br>
+     * Grammar: integers `[+-]digits`, floating point numbers `[+-]digits[.digits][(e|E)[+-]digits]` with optional
+     * integer or fraction part, `inf`, `infinity` and `nan` in any case, booleans `true` and `false`.
+     * Too small floating point numbers are rounded to zero
+     * @tparam ValueT Value type
+     * @param string String
+     * @return Value and count of consumed characters or `ParseError::Empty` if string is empty,
+     * `ParseError::InvalidCharacter` if string doesn`t start with value, `ParseError::OutOfRange` if value doesn`t fit into type
+     */
+    template<typename ValueT>
+    GSTD_CONSTEXPR auto ParsePrefix(StringRef string) GSTD_NOEXCEPT -> Result<Parsed<ValueT>,
+                                                                              ParseError> {
+        static_assert(std::is_arithmetic_v<ValueT> && !std::is_same_v<ValueT, long double>,
+                      "`Parse` is available only for integers, booleans, `float` and `double`!");
+
+        if GSTD_CONSTEXPR (std::is_same_v<ValueT, bool>) {
+            if (string.StartsWith("true")) {
+                return MakeOk(Parsed<bool> {true, 4});
+            }
+
+            if (string.StartsWith("false")) {
+                return MakeOk(Parsed<bool> {false, 5});
+            }
+
+            return MakeErr(string.Empty() ? ParseError::Empty : ParseError::InvalidCharacter);
+        } else if GSTD_CONSTEXPR (std::is_integral_v<ValueT>) {
+            return detail::ParseIntegerPrefix<ValueT>(string,
+                                                      false);
+        } else {
+            return detail::ParseFloatPrefix<ValueT>(string);
+        }
+    }
+
+    /**
+     * Parsing value from whole string
+     * @tparam ValueT Value type
+     * @param string String
+     * @return Value or error. If string has characters after value, error is `ParseError::InvalidCharacter`
+     */
+    template<typename ValueT>
+    GSTD_CONSTEXPR auto Parse(StringRef string) GSTD_NOEXCEPT -> Result<ValueT,
+                                                                        ParseError> {
+        auto result = ParsePrefix<ValueT>(string);
+
+        if (result.IsErr()) {
+            return MakeErr(std::move(result).UnwrapErr());
+        }
+
+        auto parsed = std::move(result).Unwrap();
+
+        if (parsed.Consumed != string.Size()) {
+            return MakeErr(ParseError::InvalidCharacter);
+        }
+
+        return MakeOk(std::move(parsed.Value));
+    }
+
+    /**
+     * Parsing hexadecimal integer `[+-]hexdigits` without `0x` prefix from start of string
+     * @tparam ValueT Integer type
+     * @param string String
+     * @return Value and count of consumed characters or error like in `ParsePrefix`
+     */
+    template<typename ValueT>
+    GSTD_CONSTEXPR auto ParseHexPrefix(StringRef string) GSTD_NOEXCEPT -> Result<Parsed<ValueT>,
+                                                                                 ParseError> {
+        static_assert(std::is_integral_v<ValueT> && !std::is_same_v<ValueT, bool>,
+                      "`ParseHex` is available only for integers!");
+
+        return detail::ParseIntegerPrefix<ValueT>(string,
+                                                  true);
+    }
+
+    /**
+     * Parsing hexadecimal integer from whole string
+     * @tparam ValueT Integer type
+     * @param string String
+     * @return Value or error like in `Parse`
+     */
+    template<typename ValueT>
+    GSTD_CONSTEXPR auto ParseHex(StringRef string) GSTD_NOEXCEPT -> Result<ValueT,
+                                                                           ParseError> {
+        auto result = ParseHexPrefix<ValueT>(string);
+
+        if (result.IsErr()) {
+            return MakeErr(std::move(result).UnwrapErr());
+        }
+
+        auto parsed = std::move(result).Unwrap();
+
+        if (parsed.Consumed != string.Size()) {
+            return MakeErr(ParseError::InvalidCharacter);
+        }
+
+        return MakeOk(std::move(parsed.Value));
+    }
+
+}
+
+#endif //GSTD_PARSE_H
@@ -0,0 +1,696 @@
+#ifndef GSTD_ROPE_H
+#define GSTD_ROPE_H
+
+#include <atomic>
+#include <cstring>
+#include <new>
+
+#include <gstd/Containers/String.h>
+#include <gstd/Memory/Allocator.h>
+#include <gstd/Memory/RawPtr.h>
+
+namespace gstd {
+
+    namespace detail {
+
+        /**
+         * Immutable node of rope. Leaf has zero height and stores bytes after node, concatenation stores two children
+         */
+        struct RopeNode {
+
+            auto Data() GSTD_NOEXCEPT -> char * {
+                return reinterpret_cast<char *>(this + 1);
+            }
+
+            auto IsLeaf() const GSTD_NOEXCEPT -> bool {
+                return Height == 0;
+            }
+
+            std::atomic<std::uint32_t> References;
+
+            std::uint32_t Height;
+
+            std::uint64_t Size;
+
+            RawPtr<Allocator> Source;
+
+            RopeNode *Left;
+
+            RopeNode *Right;
+        };
+
+        /**
+         * Counted reference to rope node
+         */
+        class RopeNodeRef {
+        public:
+
+            RopeNodeRef() GSTD_NOEXCEPT
+                    : _node(nullptr) {}
+
+            /**
+             * Taking ownership of one reference of node
+             */
+            GSTD_EXPLICIT RopeNodeRef(RopeNode *node) GSTD_NOEXCEPT
+                    : _node(node) {}
+
+            RopeNodeRef(const RopeNodeRef &nodeRef) GSTD_NOEXCEPT
+                    : _node(Retain(nodeRef._node)) {}
+
+            RopeNodeRef(RopeNodeRef &&nodeRef) GSTD_NOEXCEPT
+                    : _node(nodeRef._node) {
+                nodeRef._node = nullptr;
+            }
+
+        public:
+
+            ~RopeNodeRef() GSTD_NOEXCEPT {
+                Release(_node);
+            }
+
+        public:
+
+            /**
+             * Sharing node, that is owned by other node
+             */
+            static auto Share(RopeNode *node) GSTD_NOEXCEPT -> RopeNodeRef {
+                return RopeNodeRef(Retain(node));
+            }
+
+        public:
+
+            auto Get() const GSTD_NOEXCEPT -> RopeNode * {
+                return _node;
+            }
+
+            auto Leak() GSTD_NOEXCEPT -> RopeNode * {
+                auto node = _node;
+
+                _node = nullptr;
+
+                return node;
+            }
+
+            auto Height() const GSTD_NOEXCEPT -> std::uint32_t {
+                return _node != nullptr ? _node->Height : 0;
+            }
+
+            auto Size() const GSTD_NOEXCEPT -> std::uint64_t {
+                return _node != nullptr ? _node->Size : 0;
+            }
+
+        public:
+
+            auto operator=(RopeNodeRef nodeRef) GSTD_NOEXCEPT -> RopeNodeRef & {
+                auto node = _node;
+
+                _node = nodeRef._node;
+                nodeRef._node = node;
+
+                return *this;
+            }
+
+            auto operator->() const GSTD_NOEXCEPT -> RopeNode * {
+                return _node;
+            }
+
+            GSTD_EXPLICIT operator bool() const GSTD_NOEXCEPT {
+                return _node != nullptr;
+            }
+
+        private:
+
+            static auto Retain(RopeNode *node) GSTD_NOEXCEPT -> RopeNode * {
+                if (node != nullptr) {
+                    node->References.fetch_add(1,
+                                               std::memory_order_relaxed);
+                }
+
+                return node;
+            }
+
+            static auto Release(RopeNode *node) GSTD_NOEXCEPT -> void {
+                if (node == nullptr || node->References.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                    return;
+                }
+
+                auto source = node->Source;
+                auto bytes = sizeof(RopeNode);
+
+                if (node->IsLeaf()) {
+                    bytes += node->Size;
+                } else {
+                    Release(node->Left);
+                    Release(node->Right);
+                }
+
+                node->~RopeNode();
+
+                source->Deallocate(reinterpret_cast<Byte *>(node),
+                                   bytes,
+                                   alignof(RopeNode));
+            }
+
+        private:
+
+            RopeNode *_node;
+        };
+
+    }
+
+    /**
+     * Persistent string for large texts. Text is stored in leaves, that are joined into AVL-balanced tree,
+     * so insertion, erasing, concatenation and getting of substring take O(log n) time<br>
+     * Nodes are immutable and shared between copies and edits, so copying of rope is O(1)
+     */
+    class Rope {
+    public:
+
+        using SizeType = std::uint64_t;
+
+        using IndexType = std::uint64_t;
+
+    public:
+
+        Rope(RawPtr<Allocator> allocator = DefaultAllocator()) GSTD_NOEXCEPT
+                : _allocator(allocator),
+                  _root() {}
+
+        Rope(StringRef string,
+             RawPtr<Allocator> allocator = DefaultAllocator())
+                : _allocator(allocator),
+                  _root(Build(string.Data(),
+                              string.Size())) {}
+
+    public:
+
+        static auto New(StringRef string,
+                        RawPtr<Allocator> allocator = DefaultAllocator()) -> Rope {
+            return Rope(string,
+                        allocator);
+        }
+
+    public:
+
+        auto Size() const GSTD_NOEXCEPT -> SizeType {
+            return _root.Size();
+        }
+
+        auto Empty() const GSTD_NOEXCEPT -> bool {
+            return Size() == 0;
+        }
+
+        auto At(const IndexType &index) const GSTD_NOEXCEPT -> Optional<char> {
+            if (index >= Size()) {
+                return MakeNone();
+            }
+
+            auto node = _root.Get();
+            auto offset = index;
+
+            while (!node->IsLeaf()) {
+                if (offset < node->Left->Size) {
+                    node = node->Left;
+                } else {
+                    offset -= node->Left->Size;
+                    node = node->Right;
+                }
+            }
+
+            return MakeSome(static_cast<char>(node->Data()[offset]));
+        }
+
+        /**
+         * Inserting string before index
+         * @param index Index, must not be greater than size
+         * @param string String
+         */
+        auto Insert(IndexType index,
+                    StringRef string) -> void {
+            Insert(index,
+                   Build(string.Data(),
+                         string.Size()));
+        }
+
+        auto Insert(IndexType index,
+                    const Rope &rope) -> void {
+            Insert(index,
+                   rope._root);
+        }
+
+        /**
+         * Erasing part of rope. Count is clamped by size
+         * @param index Index of first erased byte, must not be greater than size
+         * @param count Count of erased bytes
+         */
+        auto Erase(IndexType index,
+                   SizeType count) -> void {
+            CheckIndex(index);
+
+            count = count < Size() - index ? count : Size() - index;
+
+            detail::RopeNodeRef left, middle, right, rest;
+
+            Split(_root, index, left, rest);
+            Split(rest, count, middle, right);
+
+            _root = Join(std::move(left),
+                         std::move(right));
+        }
+
+        /**
+         * Getting part of rope. Result shares nodes with this rope
+         * @param index Index of first byte, must not be greater than size
+         * @param count Count of bytes, is clamped by size
+         * @return Part of rope
+         */
+        auto Substring(IndexType index,
+                       SizeType count = ~static_cast<SizeType>(0)) const -> Rope {
+            CheckIndex(index);
+
+            count = count < Size() - index ? count : Size() - index;
+
+            detail::RopeNodeRef left, middle, right, rest;
+
+            Split(_root, index, left, rest);
+            Split(rest, count, middle, right);
+
+            return Rope(std::move(middle),
+                        _allocator);
+        }
+
+        auto Append(StringRef string) -> void {
+            _root = Join(std::move(_root),
+                         Build(string.Data(),
+                               string.Size()));
+        }
+
+        auto Append(const Rope &rope) -> void {
+            _root = Join(std::move(_root),
+                         rope._root);
+        }
+
+        /**
+         * Calling function for each leaf of rope in order
+         * @tparam FunctionT Function type
+         * @param function Function, that takes `StringRef`
+         */
+        template<typename FunctionT>
+        auto ForEachChunk(FunctionT &&function) const -> void {
+            if (_root) {
+                VisitLeaves(_root.Get(),
+                            function);
+            }
+        }
+
+        /**
+         * Copying rope into buffer
+         * @param output Buffer, must have at least `Size()` bytes
+         * @return Count of copied bytes
+         */
+        auto CopyTo(Span<char> output) const -> SizeType {
+            if (output.Size() < Size()) {
+                Panic("Output buffer is too small!");
+            }
+
+            auto data = output.Data();
+
+            ForEachChunk([&data] (StringRef chunk) {
+                std::memcpy(data,
+                            chunk.Data(),
+                            chunk.Size());
+
+                data += chunk.Size();
+            });
+
+            return Size();
+        }
+
+        /**
+         * Assembling string with one allocation of exact size
+         * @return String
+         */
+        auto ToString() const -> String {
+            String result(_allocator);
+
+            result.ResizeUninitialized(Size());
+
+            CopyTo(result.AsSpan());
+
+            return result;
+        }
+
+    public:
+
+        auto operator+=(StringRef string) -> Rope & {
+            Append(string);
+
+            return *this;
+        }
+
+        auto operator+=(const Rope &rope) -> Rope & {
+            Append(rope);
+
+            return *this;
+        }
+
+        auto operator[](const IndexType &index) const -> char {
+            if (index >= Size()) {
+                Panic("Index out of range!");
+            }
+
+            return At(index).Unwrap();
+        }
+
+    private:
+
+        /**
+         * Maximal size of leaf. Small neighbouring leaves are merged up to this size
+         */
+        static constexpr SizeType LeafSizeValue = 512;
+
+    private:
+
+        Rope(detail::RopeNodeRef root,
+             RawPtr<Allocator> allocator) GSTD_NOEXCEPT
+                : _allocator(allocator),
+                  _root(std::move(root)) {}
+
+    private:
+
+        auto CheckIndex(IndexType index) const -> void {
+            if (index > Size()) {
+                Panic("Index out of range!");
+            }
+        }
+
+        auto Insert(IndexType index,
+                    detail::RopeNodeRef node) -> void {
+            CheckIndex(index);
+
+            detail::RopeNodeRef left, right;
+
+            Split(_root, index, left, right);
+
+            _root = Join(Join(std::move(left),
+                              std::move(node)),
+                         std::move(right));
+        }
+
+        auto NewNode(std::uint32_t height,
+                     SizeType size,
+                     SizeType bytes,
+                     detail::RopeNode *left,
+                     detail::RopeNode *right) const -> detail::RopeNodeRef {
+            auto allocator = _allocator;
+            auto node = new (allocator->template Allocate<Byte>(sizeof(detail::RopeNode) + bytes,
+                                                                alignof(detail::RopeNode))) detail::RopeNode {
+                {1},
+                height,
+                size,
+                _allocator,
+                left,
+                right
+            };
+
+            return detail::RopeNodeRef(node);
+        }
+
+        /**
+         * Creating leaf from two pieces
+         */
+        auto MakeLeaf(const char *first,
+                      SizeType firstSize,
+                      const char *second = nullptr,
+                      SizeType secondSize = 0) const -> detail::RopeNodeRef {
+            if (firstSize + secondSize == 0) {
+                return detail::RopeNodeRef();
+            }
+
+            auto node = NewNode(0,
+                                firstSize + secondSize,
+                                firstSize + secondSize,
+                                nullptr,
+                                nullptr);
+
+            if (firstSize != 0) {
+                std::memcpy(node->Data(),
+                            first,
+                            firstSize);
+            }
+
+            if (secondSize != 0) {
+                std::memcpy(node->Data() + firstSize,
+                            second,
+                            secondSize);
+            }
+
+            return node;
+        }
+
+        auto MakeConcat(detail::RopeNodeRef left,
+                        detail::RopeNodeRef right) const -> detail::RopeNodeRef {
+            auto height = (left.Height() > right.Height() ? left.Height() : right.Height()) + 1;
+            auto size = left.Size() + right.Size();
+
+            return NewNode(height,
+                           size,
+                           0,
+                           left.Leak(),
+                           right.Leak());
+        }
+
+        /**
+         * Building balanced tree from string by halving
+         */
+        auto Build(const char *data,
+                   SizeType size) const -> detail::RopeNodeRef {
+            if (size <= LeafSizeValue) {
+                return MakeLeaf(data,
+                                size);
+            }
+
+            auto half = size / 2;
+
+            return MakeConcat(Build(data, half),
+                              Build(data + half, size - half));
+        }
+
+        auto RotateLeft(detail::RopeNodeRef node) const -> detail::RopeNodeRef {
+            auto right = node->Right;
+
+            return MakeConcat(MakeConcat(detail::RopeNodeRef::Share(node->Left),
+                                         detail::RopeNodeRef::Share(right->Left)),
+                              detail::RopeNodeRef::Share(right->Right));
+        }
+
+        auto RotateRight(detail::RopeNodeRef node) const -> detail::RopeNodeRef {
+            auto left = node->Left;
+
+            return MakeConcat(detail::RopeNodeRef::Share(left->Left),
+                              MakeConcat(detail::RopeNodeRef::Share(left->Right),
+                                         detail::RopeNodeRef::Share(node->Right)));
+        }
+
+        /**
+         * Joining trees, when left tree is higher. New nodes are created only on right spine of left tree
+         */
+        auto JoinRight(const detail::RopeNodeRef &left,
+                       detail::RopeNodeRef right) const -> detail::RopeNodeRef {
+            auto outer = detail::RopeNodeRef::Share(left->Left);
+            auto inner = detail::RopeNodeRef::Share(left->Right);
+
+            if (inner.Height() <= right.Height() + 1) {
+                auto joined = MakeConcat(std::move(inner),
+                                         std::move(right));
+
+                if (joined.Height() <= outer.Height() + 1) {
+                    return MakeConcat(std::move(outer),
+                                      std::move(joined));
+                }
+
+                return RotateLeft(MakeConcat(std::move(outer),
+                                             RotateRight(std::move(joined))));
+            }
+
+            auto joined = JoinRight(inner,
+                                    std::move(right));
+
+            if (joined.Height() <= outer.Height() + 1) {
+                return MakeConcat(std::move(outer),
+                                  std::move(joined));
+            }
+
+            return RotateLeft(MakeConcat(std::move(outer),
+                                         std::move(joined)));
+        }
+
+        auto JoinLeft(detail::RopeNodeRef left,
+                      const detail::RopeNodeRef &right) const -> detail::RopeNodeRef {
+            auto outer = detail::RopeNodeRef::Share(right->Right);
+            auto inner = detail::RopeNodeRef::Share(right->Left);
+
+            if (inner.Height() <= left.Height() + 1) {
+                auto joined = MakeConcat(std::move(left),
+                                         std::move(inner));
+
+                if (joined.Height() <= outer.Height() + 1) {
+                    return MakeConcat(std::move(joined),
+                                      std::move(outer));
+                }
+
+                return RotateRight(MakeConcat(RotateLeft(std::move(joined)),
+                                              std::move(outer)));
+            }
+
+            auto joined = JoinLeft(std::move(left),
+                                   inner);
+
+            if (joined.Height() <= outer.Height() + 1) {
+                return MakeConcat(std::move(joined),
+                                  std::move(outer));
+            }
+
+            return RotateRight(MakeConcat(std::move(joined),
+                                          std::move(outer)));
+        }
+
+        /**
+         * Appending small leaf to rightmost leaf of tree. Path is copied, heights are not changed
+         */
+        auto MergeRightmost(const detail::RopeNodeRef &node,
+                            detail::RopeNode *leaf) const -> detail::RopeNodeRef {
+            if (node->IsLeaf()) {
+                return MakeLeaf(node->Data(),
+                                node->Size,
+                                leaf->Data(),
+                                leaf->Size);
+            }
+
+            return MakeConcat(detail::RopeNodeRef::Share(node->Left),
+                              MergeRightmost(detail::RopeNodeRef::Share(node->Right),
+                                             leaf));
+        }
+
+        auto MergeLeftmost(detail::RopeNode *leaf,
+                           const detail::RopeNodeRef &node) const -> detail::RopeNodeRef {
+            if (node->IsLeaf()) {
+                return MakeLeaf(leaf->Data(),
+                                leaf->Size,
+                                node->Data(),
+                                node->Size);
+            }
+
+            return MakeConcat(MergeLeftmost(leaf,
+                                            detail::RopeNodeRef::Share(node->Left)),
+                              detail::RopeNodeRef::Share(node->Right));
+        }
+
+        /**
+         * Joining trees by AVL join. Small leaves on boundary are merged, so appending by small pieces
+         * doesn`t create tiny leaves
+         */
+        auto Join(detail::RopeNodeRef left,
+                  detail::RopeNodeRef right) const -> detail::RopeNodeRef {
+            if (!left) {
+                return right;
+            }
+
+            if (!right) {
+                return left;
+            }
+
+            if (right->IsLeaf()) {
+                auto node = left.Get();
+
+                for (; !node->IsLeaf(); node = node->Right) {}
+
+                if (node->Size + right->Size <= LeafSizeValue) {
+                    return MergeRightmost(left,
+                                          right.Get());
+                }
+            } else if (left->IsLeaf()) {
+                auto node = right.Get();
+
+                for (; !node->IsLeaf(); node = node->Left) {}
+
+                if (node->Size + left->Size <= LeafSizeValue) {
+                    return MergeLeftmost(left.Get(),
+                                         right);
+                }
+            }
+
+            if (left.Height() > right.Height() + 1) {
+                return JoinRight(left,
+                                 std::move(right));
+            }
+
+            if (right.Height() > left.Height() + 1) {
+                return JoinLeft(std::move(left),
+                                right);
+            }
+
+            return MakeConcat(std::move(left),
+                              std::move(right));
+        }
+
+        /**
+         * Splitting tree at index into two trees
+         */
+        auto Split(const detail::RopeNodeRef &node,
+                   IndexType index,
+                   detail::RopeNodeRef &left,
+                   detail::RopeNodeRef &right) const -> void {
+            if (index == 0) {
+                left = detail::RopeNodeRef();
+                right = node;
+            } else if (index >= node.Size()) {
+                left = node;
+                right = detail::RopeNodeRef();
+            } else if (node->IsLeaf()) {
+                left = MakeLeaf(node->Data(),
+                                index);
+                right = MakeLeaf(node->Data() + index,
+                                 node->Size - index);
+            } else if (index < node->Left->Size) {
+                detail::RopeNodeRef rest;
+
+                Split(detail::RopeNodeRef::Share(node->Left), index, left, rest);
+
+                right = Join(std::move(rest),
+                             detail::RopeNodeRef::Share(node->Right));
+            } else if (index > node->Left->Size) {
+                detail::RopeNodeRef rest;
+
+                Split(detail::RopeNodeRef::Share(node->Right), index - node->Left->Size, rest, right);
+
+                left = Join(detail::RopeNodeRef::Share(node->Left),
+                            std::move(rest));
+            } else {
+                left = detail::RopeNodeRef::Share(node->Left);
+                right = detail::RopeNodeRef::Share(node->Right);
+            }
+        }
+
+        template<typename FunctionT>
+        static auto VisitLeaves(detail::RopeNode *node,
+                                FunctionT &function) -> void {
+            for (; !node->IsLeaf(); node = node->Right) {
+                VisitLeaves(node->Left,
+                            function);
+            }
+
+            function(StringRef(node->Data(),
+                               node->Size));
+        }
+
+    private:
+
+        RawPtr<Allocator> _allocator;
+
+        detail::RopeNodeRef _root;
+    };
+
+}
+
+#endif //GSTD_ROPE_H
@@ -1,6 +1,9 @@
 #ifndef GSTD_SLICE_H
 #define GSTD_SLICE_H
 
+#include <limits>
+
+#include <gstd/Diagnostic/Panic.h>
 #include <gstd/Type/Types.h>
 
 namespace gstd {
@@ -16,6 +19,54 @@ namespace gstd {
      */
     inline constexpr Position NoPos = std::numeric_limits<Position>::max();
 
+    /**
+     * Resolved bounds of `Slice` for container with concrete size
+     */
+    class SliceBounds {
+    public:
+
+        GSTD_CONSTEXPR SliceBounds(Position start,
+                                   Position step,
+                                   std::uint64_t count) GSTD_NOEXCEPT
+                : _start(start),
+                  _step(step),
+                  _count(count) {}
+
+    public:
+
+        /**
+         * Getting index of first element
+         * @return Index of first element
+         */
+        GSTD_CONSTEXPR auto GetStart() const GSTD_NOEXCEPT -> Position {
+            return _start;
+        }
+
+        /**
+         * Getting step between elements (never zero, may be negative)
+         * @return Step
+         */
+        GSTD_CONSTEXPR auto GetStep() const GSTD_NOEXCEPT -> Position {
+            return _step;
+        }
+
+        /**
+         * Getting count of elements in slice
+         * @return Count of elements
+         */
+        GSTD_CONSTEXPR auto GetCount() const GSTD_NOEXCEPT -> std::uint64_t {
+            return _count;
+        }
+
+    private:
+
+        Position _start;
+
+        Position _step;
+
+        std::uint64_t _count;
+    };
+
     /**
      * Class for making slices from data by start and stop position and step<br>
      * For example
@@ -120,6 +171,53 @@ namespace gstd {
             return _step;
         }
 
+        /**
+         * Resolving slice for container with `size` elements<br>
+         * Negative positions are counted from end, out of range positions are clamped, `NoPos` step means 1 step
+         * @param size Size of container
+         * @return Resolved bounds
+         */
+        GSTD_CONSTEXPR auto Resolve(std::uint64_t size) const -> SliceBounds {
+            auto signedSize = static_cast<Position>(size);
+            auto step = _step == NoPos ? 1 : _step;
+
+            if (step == 0) {
+                Panic("Step in `Slice` can`t be zero!");
+            }
+
+            auto clamp = [signedSize] (Position position,
+                                       Position lower,
+                                       Position upper) -> Position {
+                if (position < 0) {
+                    position += signedSize;
+                }
+
+                return position < lower ? lower : (position > upper ? upper : position);
+            };
+
+            if (step > 0) {
+                auto start = _start == NoPos ? 0 : clamp(_start, 0, signedSize);
+                auto stop = _stop == NoPos ? signedSize : clamp(_stop, 0, signedSize);
+                auto count = stop > start ? (stop - start + step - 1) / step : 0;
+
+                return SliceBounds {
+                    start,
+                    step,
+                    static_cast<std::uint64_t>(count)
+                };
+            }
+
+            auto start = _start == NoPos ? signedSize - 1 : clamp(_start, -1, signedSize - 1);
+            auto stop = _stop == NoPos ? -1 : clamp(_stop, -1, signedSize - 1);
+            auto count = start > stop ? (start - stop - step - 1) / -step : 0;
+
+            return SliceBounds {
+                start,
+                step,
+                static_cast<std::uint64_t>(count)
+            };
+        }
+
     private:
 
         /*
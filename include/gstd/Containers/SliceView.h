@@ -0,0 +1,339 @@
+#ifndef GSTD_SLICEVIEW_H
+#define GSTD_SLICEVIEW_H
+
+#include <gstd/Containers/Slice.h>
+#include <gstd/Containers/Span.h>
+#include <gstd/Type/Iterator.h>
+
+namespace gstd {
+
+    /**
+     * Iterator for `SliceView`
+     * @tparam ValueT Value type
+     */
+    template<typename ValueT>
+    class SliceViewIterator : public Iterator<ValueT> {
+    public:
+
+        using ValueType = typename Iterator<ValueT>::ValueType;
+
+        using Pointer = ValueType *;
+
+        using SizeType = std::uint64_t;
+
+    public:
+
+        GSTD_CONSTEXPR SliceViewIterator(Pointer pointer,
+                                         Position stride,
+                                         SizeType size) GSTD_NOEXCEPT
+                : _pointer(pointer),
+                  _stride(stride),
+                  _size(size) {}
+
+    protected:
+
+        GSTD_CONSTEXPR auto DoNext() -> Optional<Ref<ValueType>> override {
+            if (_size == 0) {
+                return MakeNone();
+            }
+
+            auto &value = *_pointer;
+
+            --_size;
+
+            if (_size != 0) {
+                _pointer += _stride;
+            }
+
+            return MakeSome(MakeRef(value));
+        }
+
+    private:
+
+        Pointer _pointer;
+
+        Position _stride;
+
+        SizeType _size;
+    };
+
+    /**
+     * Lightweight strided cursor for range-based `for` over `SliceView`<br>
+     * Holds element index instead of moving pointer, so end cursor never points outside of viewed memory
+     * @tparam ValueT Value type
+     */
+    template<typename ValueT>
+    class StridedCursor {
+    public:
+
+        using ValueType = ValueT;
+
+        using Pointer = ValueType *;
+
+        using Reference = ValueType &;
+
+        using IndexType = std::uint64_t;
+
+    public:
+
+        GSTD_CONSTEXPR StridedCursor(Pointer pointer,
+                                     Position stride,
+                                     IndexType index) GSTD_NOEXCEPT
+                : _pointer(pointer),
+                  _stride(stride),
+                  _index(index) {}
+
+    public:
+
+        GSTD_CONSTEXPR auto operator*() const GSTD_NOEXCEPT -> Reference {
+            return _pointer[static_cast<Position>(_index) * _stride];
+        }
+
+        GSTD_CONSTEXPR auto operator++() GSTD_NOEXCEPT -> StridedCursor & {
+            ++_index;
+
+            return *this;
+        }
+
+        GSTD_CONSTEXPR auto operator==(const StridedCursor &cursor) const GSTD_NOEXCEPT -> bool {
+            return _index == cursor._index;
+        }
+
+        GSTD_CONSTEXPR auto operator!=(const StridedCursor &cursor) const GSTD_NOEXCEPT -> bool {
+            return _index != cursor._index;
+        }
+
+    private:
+
+        Pointer _pointer;
+
+        Position _stride;
+
+        IndexType _index;
+    };
+
+    /**
+     * Non-owning strided view over contiguous memory<br>
+     * Unlike `Span` supports any step of `Slice`, including negative one. Slicing of view returns new view without copying data
+     * @code
+     * Vector<int> vector({1, 2, 3, 4, 5, 6});
+     * auto view = vector.View(Slice::New(NoPos, NoPos, -1)); // [6, 5, 4, 3, 2, 1]
+     * view[Slice::New(NoPos, NoPos, 2)]; // [6, 4, 2]
+     * @endcode
+     * @tparam ValueT Value type
+     */
+    template<typename ValueT>
+    class SliceView {
+    public:
+
+        using ValueType = ValueT;
+
+        using SizeType = std::uint64_t;
+
+        using Pointer = ValueType *;
+
+        using Reference = ValueType &;
+
+        using Iterator = SliceViewIterator<ValueType>;
+
+        using IndexType = std::uint64_t;
+
+    public:
+
+        GSTD_CONSTEXPR SliceView() GSTD_NOEXCEPT
+                : _pointer(nullptr),
+                  _stride(1),
+                  _size(0) {}
+
+        /**
+         * Main constructor for `SliceView`
+         * @param pointer Pointer to first element of view
+         * @param stride Distance in elements between neighbour elements of view, may be negative
+         * @param size Count of elements in view
+         */
+        GSTD_CONSTEXPR SliceView(Pointer pointer,
+                                 Position stride,
+                                 SizeType size) GSTD_NOEXCEPT
+                : _pointer(pointer),
+                  _stride(stride),
+                  _size(size) {}
+
+        GSTD_CONSTEXPR SliceView(Span<ValueType> span) GSTD_NOEXCEPT
+                : SliceView(span.Data(),
+                            1,
+                            span.Size()) {}
+
+        template<typename InputValueT,
+                 typename = std::enable_if_t<std::is_convertible_v<InputValueT *,
+                                                                   Pointer>>>
+        GSTD_CONSTEXPR SliceView(SliceView<InputValueT> view) GSTD_NOEXCEPT
+                : SliceView(view.Data(),
+                            view.Stride(),
+                            view.Size()) {}
+
+    public:
+
+        /**
+         * Creating `SliceView` from `Span` by `Slice`
+         * @param span Viewed span
+         * @param slice Slice
+         * @return `SliceView`
+         */
+        static GSTD_CONSTEXPR auto New(Span<ValueType> span,
+                                       const Slice &slice) -> SliceView {
+            return SliceView(span)[slice];
+        }
+
+    public:
+
+        /**
+         * Getting pointer to first element of view
+         * @return Pointer to first element
+         */
+        GSTD_CONSTEXPR auto Data() const GSTD_NOEXCEPT -> Pointer {
+            return _pointer;
+        }
+
+        /**
+         * Getting distance in elements between neighbour elements of view
+         * @return Stride
+         */
+        GSTD_CONSTEXPR auto Stride() const GSTD_NOEXCEPT -> Position {
+            return _stride;
+        }
+
+        GSTD_CONSTEXPR auto Size() const GSTD_NOEXCEPT -> SizeType {
+            return _size;
+        }
+
+        GSTD_CONSTEXPR auto Empty() const GSTD_NOEXCEPT -> bool {
+            return _size == 0;
+        }
+
+        /**
+         * Checking if elements of view are adjacent in memory and view can be represented as `Span`
+         * @return Is view contiguous
+         */
+        GSTD_CONSTEXPR auto IsContiguous() const GSTD_NOEXCEPT -> bool {
+            return _stride == 1 || _size <= 1;
+        }
+
+        /**
+         * Getting view as `Span`, if it is contiguous
+         * @return `Span` over viewed elements or `None`
+         */
+        GSTD_CONSTEXPR auto AsSpan() const GSTD_NOEXCEPT -> Optional<Span<ValueType>> {
+            if (!IsContiguous()) {
+                return MakeNone();
+            }
+
+            return MakeSome(Span<ValueType> {
+                _pointer,
+                _size
+            });
+        }
+
+        GSTD_CONSTEXPR auto AsConst() const GSTD_NOEXCEPT -> SliceView<const ValueType> {
+            return SliceView<const ValueType> {
+                _pointer,
+                _stride,
+                _size
+            };
+        }
+
+        GSTD_CONSTEXPR auto At(const IndexType &index) const GSTD_NOEXCEPT -> Optional<Ref<ValueType>> {
+            if (index >= _size) {
+                return MakeNone();
+            }
+
+            return MakeSome(MakeRef(_pointer[static_cast<Position>(index) * _stride]));
+        }
+
+        GSTD_CONSTEXPR auto Iter() const GSTD_NOEXCEPT -> Iterator {
+            return Iterator {
+                _pointer,
+                _stride,
+                _size
+            };
+        }
+
+    public:
+
+        GSTD_CONSTEXPR auto begin() const GSTD_NOEXCEPT -> StridedCursor<ValueType> {
+            return StridedCursor<ValueType> {
+                _pointer,
+                _stride,
+                0
+            };
+        }
+
+        GSTD_CONSTEXPR auto end() const GSTD_NOEXCEPT -> StridedCursor<ValueType> {
+            return StridedCursor<ValueType> {
+                _pointer,
+                _stride,
+                _size
+            };
+        }
+
+    public:
+
+        GSTD_CONSTEXPR auto operator[](const IndexType &index) const -> Reference {
+            if (index >= _size) {
+                Panic("Index out of range!");
+            }
+
+            return _pointer[static_cast<Position>(index) * _stride];
+        }
+
+        /**
+         * Slicing view. Resulting view points into the same memory, strides of views are multiplied
+         * @param slice Slice
+         * @return New `SliceView`
+         */
+        GSTD_CONSTEXPR auto operator[](const Slice &slice) const -> SliceView {
+            auto bounds = slice.Resolve(_size);
+
+            if (bounds.GetCount() == 0) {
+                return SliceView {
+                    _pointer,
+                    _stride * bounds.GetStep(),
+                    0
+                };
+            }
+
+            return SliceView {
+                _pointer + bounds.GetStart() * _stride,
+                _stride * bounds.GetStep(),
+                bounds.GetCount()
+            };
+        }
+
+    private:
+
+        Pointer _pointer;
+
+        Position _stride;
+
+        SizeType _size;
+    };
+
+    template<typename ValueT>
+    SliceView(Span<ValueT> span) -> SliceView<ValueT>;
+
+    /**
+     * Smart creating of `SliceView` from `Span` by `Slice`
+     * @tparam ValueT Value type
+     * @param span Viewed span
+     * @param slice Slice
+     * @return `SliceView`
+     */
+    template<typename ValueT>
+    GSTD_CONSTEXPR auto MakeSliceView(Span<ValueT> span,
+                                      const Slice &slice) -> SliceView<ValueT> {
+        return SliceView<ValueT>::New(span,
+                                      slice);
+    }
+
+}
+
+#endif //GSTD_SLICEVIEW_H
@@ -46,13 +46,11 @@ namespace gstd {
                   _size(size) {}
 
         template<typename InputValueT,
-                 typename = std::enable_if_t<std::is_convertible_v<InputValueT,
-                                                                   ValueType>>>
-        GSTD_CONSTEXPR Span(Span<InputValueT> span)
-        GSTD_NOEXCEPT(std::is_nothrow_convertible_v<InputValueT,
-                                                    ValueType>)
-                : _pointer(static_cast<Pointer>(span._pointer)),
-                  _size(span._size) {}
+                 typename = std::enable_if_t<std::is_convertible_v<InputValueT (*)[],
+                                                                   ValueType (*)[]>>>
+        GSTD_CONSTEXPR Span(Span<InputValueT> span) GSTD_NOEXCEPT
+                : _pointer(span.Data()),
+                  _size(span.Size()) {}
 
         template<SizeType SizeV>
         GSTD_CONSTEXPR Span(ValueType (&array)[SizeV]) GSTD_NOEXCEPT
@@ -1,6 +1,7 @@
 #ifndef GSTD_STACK_H
 #define GSTD_STACK_H
 
+#include <gstd/Containers/Vector.h>
 #include <gstd/Utils/Match.h>
 
 namespace gstd {
@@ -23,39 +24,30 @@ namespace gstd {
         public:
 
             GSTD_CONSTEXPR StaticStackStorage() GSTD_NOEXCEPT
-                    : _buffer(),
-                      _cursorIndex(0) {}
+                    : _buffer() {}
 
         public:
 
             GSTD_CONSTEXPR auto Push(ValueType &&value) -> void {
-                ++_cursorIndex;
-
-                _buffer[_cursorIndex] = std::move(value);
+                _buffer.Append(std::move(value)).Unwrap();
             }
 
             GSTD_CONSTEXPR auto Top() const -> const ValueType & {
-                return _buffer[_cursorIndex];
+                return _buffer[_buffer.Size() - 1];
             }
 
             GSTD_CONSTEXPR auto Pop() -> ValueType {
-                auto &&value = std::move(_buffer[_cursorIndex]);
-
-                --_cursorIndex;
-
-                return std::move(value);
+                return _buffer.Pop().Unwrap();
             }
 
             GSTD_CONSTEXPR auto Size() const GSTD_NOEXCEPT {
-                return _cursorIndex;
+                return _buffer.Size();
             }
 
         private:
 
-            std::array<ValueT,
-                       MaxSizeValue> _buffer;
-
-            std::uint64_t _cursorIndex;
+            StaticVector<ValueT,
+                         MaxSizeValue> _buffer;
         };
 
         template<typename ValueT>
@@ -0,0 +1,223 @@
+#ifndef GSTD_STATICSTRING_H
+#define GSTD_STATICSTRING_H
+
+#include <compare>
+
+#include <gstd/Algorithm/Hash.h>
+#include <gstd/Diagnostic/Panic.h>
+#include <gstd/Type/Optional.h>
+#include <gstd/Type/Ref.h>
+#include <gstd/Type/Types.h>
+
+namespace gstd {
+
+    class StringRef;
+
+    /**
+     * String with fixed capacity, that can be created, concatenated, compared and hashed at compile time<br>
+     * String is structural type, so it can be used as non-type template parameter: `Route<"/books">`<br>
+     * Header doesn`t depend on `StringRef`, because `Formatter` of `StringRef` uses static strings as format strings,
+     * so members with `StringRef` in signature are defined in StringRef.h
+     * @tparam CapacityV Maximal size of string
+     */
+    template<std::uint64_t CapacityV>
+    class StaticString {
+    public:
+
+        using ValueType = char;
+
+        using SizeType = std::uint64_t;
+
+        using IndexType = std::uint64_t;
+
+    public:
+
+        GSTD_CONSTEXPR StaticString() GSTD_NOEXCEPT
+                : Characters(),
+                  Count(0) {}
+
+        template<std::uint64_t SizeV>
+        GSTD_CONSTEXPR StaticString(const char (&string)[SizeV]) GSTD_NOEXCEPT
+                : Characters(),
+                  Count(SizeV - 1) {
+            static_assert(SizeV - 1 <= CapacityV,
+                          "String is too long for StaticString!");
+
+            for (SizeType index = 0; index < SizeV - 1; ++index) {
+                Characters[index] = string[index];
+            }
+        }
+
+        GSTD_CONSTEXPR GSTD_EXPLICIT StaticString(StringRef string);
+
+    public:
+
+        GSTD_CONSTEXPR auto Data() const GSTD_NOEXCEPT -> const char * {
+            return Characters;
+        }
+
+        /**
+         * Getting null-terminated string
+         * @return Null-terminated string
+         */
+        GSTD_CONSTEXPR auto CStr() const GSTD_NOEXCEPT -> const char * {
+            return Characters;
+        }
+
+        GSTD_CONSTEXPR auto Size() const GSTD_NOEXCEPT -> SizeType {
+            return Count;
+        }
+
+        static GSTD_CONSTEXPR auto Capacity() GSTD_NOEXCEPT -> SizeType {
+            return CapacityV;
+        }
+
+        GSTD_CONSTEXPR auto Empty() const GSTD_NOEXCEPT -> bool {
+            return Count == 0;
+        }
+
+        GSTD_CONSTEXPR auto At(const IndexType &index) const GSTD_NOEXCEPT -> Optional<Ref<const char>> {
+            if (index >= Count) {
+                return MakeNone();
+            }
+
+            return MakeSome(MakeCRef(Characters[index]));
+        }
+
+        GSTD_CONSTEXPR auto AsRef() const GSTD_NOEXCEPT -> StringRef;
+
+        /**
+         * Hashing string. Hash is equal to `Hash` of same `StringRef`, so it can be computed at compile time
+         * and compared with hashes of runtime strings
+         * @return Hash of string
+         */
+        GSTD_CONSTEXPR auto Hash() const GSTD_NOEXCEPT -> std::uint64_t {
+            return detail::HashBytes(Characters,
+                                     Count);
+        }
+
+        /**
+         * Appending characters. Capacity is not changed, so characters must fit into it
+         * @param data Characters
+         * @param size Count of characters
+         */
+        GSTD_CONSTEXPR auto Append(const char *data,
+                                   SizeType size) -> void {
+            if (size > CapacityV - Count) {
+                Panic("String is too long for StaticString!");
+            }
+
+            for (SizeType index = 0; index < size; ++index) {
+                Characters[Count + index] = data[index];
+            }
+
+            Count += size;
+            Characters[Count] = '\0';
+        }
+
+        GSTD_CONSTEXPR auto Append(StringRef string) -> void;
+
+        GSTD_CONSTEXPR auto begin() const GSTD_NOEXCEPT -> const char * {
+            return Characters;
+        }
+
+        GSTD_CONSTEXPR auto end() const GSTD_NOEXCEPT -> const char * {
+            return Characters + Count;
+        }
+
+    public:
+
+        GSTD_CONSTEXPR auto operator[](const IndexType &index) const -> char {
+            if (index >= Count) {
+                Panic("Index out of range!");
+            }
+
+            return Characters[index];
+        }
+
+        GSTD_CONSTEXPR operator StringRef() const GSTD_NOEXCEPT;
+
+        template<std::uint64_t OtherCapacityV>
+        GSTD_CONSTEXPR auto operator==(const StaticString<OtherCapacityV> &string) const GSTD_NOEXCEPT -> bool {
+            return (*this <=> string) == 0;
+        }
+
+        GSTD_CONSTEXPR auto operator==(StringRef string) const GSTD_NOEXCEPT -> bool;
+
+        template<std::uint64_t OtherCapacityV>
+        GSTD_CONSTEXPR auto operator<=>(const StaticString<OtherCapacityV> &string) const GSTD_NOEXCEPT -> std::strong_ordering {
+            auto size = Count < string.Count ? Count : string.Count;
+
+            for (SizeType index = 0; index < size; ++index) {
+                if (Characters[index] != string.Characters[index]) {
+                    return static_cast<unsigned char>(Characters[index]) <=> static_cast<unsigned char>(string.Characters[index]);
+                }
+            }
+
+            return Count <=> string.Count;
+        }
+
+        GSTD_CONSTEXPR auto operator<=>(StringRef string) const GSTD_NOEXCEPT -> std::strong_ordering;
+
+    public:
+
+        /*
+         * Members are public, because structural types can`t have private members.
+         * Unused characters are zero, so equal strings are same template arguments
+         */
+
+        char Characters[CapacityV + 1];
+
+        SizeType Count;
+    };
+
+    template<std::uint64_t SizeV>
+    StaticString(const char (&)[SizeV]) -> StaticString<SizeV - 1>;
+
+    /**
+     * Concatenating strings at compile time. Capacity of result is sum of capacities
+     * @return Concatenated string
+     */
+    template<std::uint64_t FirstCapacityV,
+             std::uint64_t SecondCapacityV>
+    GSTD_CONSTEXPR auto operator+(const StaticString<FirstCapacityV> &first,
+                                  const StaticString<SecondCapacityV> &second) -> StaticString<FirstCapacityV + SecondCapacityV> {
+        StaticString<FirstCapacityV + SecondCapacityV> result;
+
+        result.Append(first.Data(),
+                      first.Size());
+        result.Append(second.Data(),
+                      second.Size());
+
+        return result;
+    }
+
+    template<std::uint64_t CapacityV,
+             std::uint64_t SizeV>
+    GSTD_CONSTEXPR auto operator+(const StaticString<CapacityV> &first,
+                                  const char (&second)[SizeV]) -> StaticString<CapacityV + SizeV - 1> {
+        return first + StaticString<SizeV - 1>(second);
+    }
+
+    template<std::uint64_t SizeV,
+             std::uint64_t CapacityV>
+    GSTD_CONSTEXPR auto operator+(const char (&first)[SizeV],
+                                  const StaticString<CapacityV> &second) -> StaticString<SizeV - 1 + CapacityV> {
+        return StaticString<SizeV - 1>(first) + second;
+    }
+
+    inline namespace literals {
+
+        /**
+         * Creating static string from literal: `"/books"_static`
+         */
+        template<StaticString StringV>
+        GSTD_CONSTEVAL auto operator""_static() GSTD_NOEXCEPT -> decltype(StringV) {
+            return StringV;
+        }
+
+    }
+
+}
+
+#endif //GSTD_STATICSTRING_H
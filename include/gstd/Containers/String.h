@@ -1,161 +1,724 @@
 #ifndef GSTD_STRING_H
 #define GSTD_STRING_H
 
+#include <bit>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <string_view>
+
 #include <gstd/Containers/Span.h>
+#include <gstd/Containers/StaticString.h>
+#include <gstd/Containers/StringRef.h>
+#include <gstd/Containers/Transcode.h>
+#include <gstd/Containers/Utf8.h>
+#include <gstd/Memory/Allocator.h>
+#include <gstd/Memory/MemoryOperations.h>
+#include <gstd/Memory/RawPtr.h>
+#include <gstd/Type/Trait.h>
 
 namespace gstd {
 
-    using CodePoint = std::uint32_t;
-
-    class Symbol {
+    /**
+     * Owning UTF-8 string with small string optimization<br>
+     * Strings up to `InlineCapacityValue` bytes are stored inside object. Object has no pointers to itself,
+     * so it stays trivially relocatable. String is always null-terminated
+     */
+    class String {
     public:
 
-        Symbol(CodePoint codePoint);
+        using ValueType = char;
 
-    public:
+        using SizeType = std::uint64_t;
 
-        static Symbol New(CodePoint codePoint);
+        using IndexType = std::uint64_t;
 
-    private:
+        using Iterator = char *;
 
-        CodePoint _codePoint;
-    };
+        using ConstIterator = const char *;
+
+        using value_type = ValueType;
 
-    constexpr auto Size(const char *string) -> size_t {
-        size_t size = 0;
+        using pointer = ValueType *;
 
-        for (size_t index = 0; string[index] != '\0'; ++index, ++size) {}
+        using const_pointer = const ValueType *;
 
-        return size;
-    }
+        using reference = ValueType &;
 
-    class StringIterator;
+        using const_reference = const ValueType &;
+
+        using iterator = Iterator;
+
+        using const_iterator = ConstIterator;
 
-    class String {
     public:
 
-        using ValueType = std::uint8_t;
+        /**
+         * Count of bytes, that stored without allocation
+         */
+        inline static constexpr SizeType InlineCapacityValue = 23;
 
-        using Iterator = StringIterator;
+    private:
 
-        using ConstIterator = const StringIterator;
+        struct HeapStorage {
+            char *Data;
 
-        using value_type = ValueType;
+            SizeType Size;
 
-        using pointer = ValueType *;
+            /**
+             * Capacity with heap flag in byte, that overlaps last inline byte
+             */
+            SizeType EncodedCapacity;
+        };
 
-        using const_pointer = const ValueType *;
+        /**
+         * Bit of `HeapStorage::EncodedCapacity`, that lies in highest bit of last inline byte
+         */
+        inline static constexpr SizeType HeapFlagValue = std::endian::native == std::endian::little
+                                                         ? SizeType(1) << 63
+                                                         : SizeType(1) << 7;
 
-        using reference = ValueType &;
+        static_assert(sizeof(HeapStorage) == InlineCapacityValue + 1,
+                      "Inline storage must overlap heap storage exactly!");
 
-        using const_reference = const ValueType &;
+    public:
 
-        using iterator = Iterator;
+        String(RawPtr<Allocator> allocator = DefaultAllocator()) GSTD_NOEXCEPT
+                : _storage(),
+                  _allocator(allocator) {
+            SetInlineSize(0);
+        }
 
-        using const_iterator = ConstIterator;
+        String(StringRef string,
+               RawPtr<Allocator> allocator = DefaultAllocator())
+                : String(allocator) {
+            Append(string);
+        }
+
+        GSTD_EXPLICIT String(const char *string,
+                             RawPtr<Allocator> allocator = DefaultAllocator())
+                : String(StringRef(string),
+                         allocator) {}
+
+        String(const String &string)
+                : String(string.AsRef(),
+                         string._allocator) {}
+
+        String(String &&string) GSTD_NOEXCEPT
+                : _storage(string._storage),
+                  _allocator(string._allocator) {
+            string.SetInlineSize(0);
+        }
 
     public:
 
-        GSTD_CONSTEXPR GSTD_EXPLICIT String(const char *string)
-                : _buffer(const_cast<char *>(string),
-                          Size(string)) {}
+        ~String() GSTD_NOEXCEPT {
+            Release();
+        }
 
     public:
 
-        static GSTD_CONSTEXPR auto New(const char *string) -> String {
+        static auto New(const char *string) -> String {
+            return String {
+                string
+            };
+        }
+
+        static auto New(StringRef string) -> String {
             return String {
                 string
             };
         }
 
-        static GSTD_CONSTEXPR auto New(const std::string &string) -> String {
-            return String::New(string.data());
+        static auto New(const std::string &string) -> String {
+            return String::New(StringRef(string));
         }
 
-        static GSTD_CONSTEXPR auto New(const char8_t *string) -> String;
+        static auto New(const char8_t *string) -> String {
+            return String::New(reinterpret_cast<const char *>(string));
+        }
 
-//        static GSTD_CONSTEXPR auto New(const std::u8string &string) -> String {
-//            return String::New(string.data());
-//        } TODO
+        static auto New(const std::u8string &string) -> String {
+            return String::New(StringRef(reinterpret_cast<const char *>(string.data()),
+                                         string.size()));
+        }
 
-        static GSTD_CONSTEXPR auto New(const char16_t *string) -> String;
+        static auto New(const char16_t *string) -> String {
+            return String::New(Span<const char16_t>(string,
+                                                    std::char_traits<char16_t>::length(string)));
+        }
 
-        static GSTD_CONSTEXPR auto New(const std::u16string &string) -> String {
-            return String::New(string.data());
+        static auto New(const std::u16string &string) -> String {
+            return String::New(Span<const char16_t>(string.data(),
+                                                    string.size()));
         }
 
-        static GSTD_CONSTEXPR auto New(const char32_t *string) -> String;
+        /**
+         * Converting UTF-16 string to UTF-8 with one exact-size allocation. Unpaired surrogates are replaced
+         * @param string UTF-16 string
+         * @return String
+         */
+        static auto New(Span<const char16_t> string) -> String {
+            String result;
 
-        static GSTD_CONSTEXPR auto New(const std::u32string &string) -> String {
-            return String::New(string.data());
+            result.ResizeUninitialized(Utf8SizeOfUtf16(string));
+
+            detail::Utf16ToUtf8(string.Data(),
+                                string.Size(),
+                                result.Data());
+
+            return result;
         }
 
-        static GSTD_CONSTEXPR auto New(const wchar_t *string) -> String;
+        static auto New(const char32_t *string) -> String {
+            return String::New(Span<const char32_t>(string,
+                                                    std::char_traits<char32_t>::length(string)));
+        }
 
-        static GSTD_CONSTEXPR auto New(const std::wstring &string) -> String {
-            return String::New(string.data());
+        static auto New(const std::u32string &string) -> String {
+            return String::New(Span<const char32_t>(string.data(),
+                                                    string.size()));
         }
 
-    public:
+        /**
+         * Converting UTF-32 string to UTF-8 with one exact-size allocation. Invalid code points are replaced
+         * @param string UTF-32 string
+         * @return String
+         */
+        static auto New(Span<const char32_t> string) -> String {
+            String result;
 
-        Optional<Ref<char>> At(const size_t &index) {
-            return _buffer.At(index);
+            result.ResizeUninitialized(Utf8SizeOfUtf32(string));
+
+            detail::Utf32ToUtf8(string.Data(),
+                                string.Size(),
+                                result.Data());
+
+            return result;
+        }
+
+        /**
+         * Converting wide string to UTF-8. Wide string is UTF-16 or UTF-32 by size of `wchar_t`
+         * @param string Wide string
+         * @return String
+         */
+        static auto New(const wchar_t *string) -> String {
+            return String::New(std::wstring_view(string));
+        }
+
+        static auto New(const std::wstring &string) -> String {
+            return String::New(std::wstring_view(string));
+        }
+
+        static auto New(std::wstring_view string) -> String {
+            static_assert(sizeof(wchar_t) == 2 || sizeof(wchar_t) == 4,
+                          "`wchar_t` must be 2 or 4 bytes!");
+
+            String result;
+
+            if GSTD_CONSTEXPR (sizeof(wchar_t) == 2) {
+                result.ResizeUninitialized(detail::Utf8SizeOfUtf16(string.data(),
+                                                                   string.size()));
+
+                detail::Utf16ToUtf8(string.data(),
+                                    string.size(),
+                                    result.Data());
+            } else {
+                result.ResizeUninitialized(detail::Utf8SizeOfUtf32(string.data(),
+                                                                   string.size()));
+
+                detail::Utf32ToUtf8(string.data(),
+                                    string.size(),
+                                    result.Data());
+            }
+
+            return result;
         }
 
     public:
 
-        GSTD_CONSTEXPR auto operator[](const size_t &index) -> char {
-            return _buffer[index];
+        auto Data() GSTD_NOEXCEPT -> char * {
+            return IsInline() ? _storage.Inline : _storage.Heap.Data;
         }
 
-        GSTD_CONSTEXPR auto operator[](const size_t &index) const -> const char {
-            return _buffer[index];
+        auto Data() const GSTD_NOEXCEPT -> const char * {
+            return IsInline() ? _storage.Inline : _storage.Heap.Data;
         }
 
-    private:
+        /**
+         * Getting null-terminated string
+         * @return Null-terminated string
+         */
+        auto CStr() const GSTD_NOEXCEPT -> const char * {
+            return Data();
+        }
 
-        Span<char> _buffer;
-    };
+        auto Size() const GSTD_NOEXCEPT -> SizeType {
+            return IsInline() ? InlineCapacityValue - static_cast<std::uint8_t>(_storage.Inline[InlineCapacityValue]) : _storage.Heap.Size;
+        }
 
-    class StringIterator {
-    public:
+        /**
+         * Getting count of bytes, that can be stored without reallocation (excluding null terminator)
+         * @return Capacity
+         */
+        auto Capacity() const GSTD_NOEXCEPT -> SizeType {
+            return IsInline() ? InlineCapacityValue : DecodeCapacity(_storage.Heap.EncodedCapacity);
+        }
+
+        auto Empty() const GSTD_NOEXCEPT -> bool {
+            return Size() == 0;
+        }
+
+        /**
+         * Checking, if string is stored inside object
+         * @return Is string inline
+         */
+        auto IsInline() const GSTD_NOEXCEPT -> bool {
+            return (static_cast<std::uint8_t>(_storage.Inline[InlineCapacityValue]) & 0x80) == 0;
+        }
+
+        auto At(const IndexType &index) -> Optional<Ref<char>> {
+            if (index >= Size()) {
+                return MakeNone();
+            }
+
+            return MakeSome(MakeRef(Data()[index]));
+        }
+
+        auto At(const IndexType &index) const -> Optional<Ref<const char>> {
+            if (index >= Size()) {
+                return MakeNone();
+            }
+
+            return MakeSome(MakeCRef(Data()[index]));
+        }
+
+        auto AsRef() const GSTD_NOEXCEPT -> StringRef {
+            return StringRef(Data(),
+                             Size());
+        }
+
+        auto AsSpan() GSTD_NOEXCEPT -> Span<char> {
+            return Span<char>(Data(),
+                              Size());
+        }
+
+        auto AsSpan() const GSTD_NOEXCEPT -> Span<const char> {
+            return Span<const char>(Data(),
+                                    Size());
+        }
+
+        /**
+         * Getting iterator over code points
+         * @return Iterator over code points
+         */
+        auto Symbols() const GSTD_NOEXCEPT -> StringIterator {
+            return StringIterator(AsRef());
+        }
+
+        auto Find(char symbol,
+                  IndexType from = 0) const GSTD_NOEXCEPT -> Optional<IndexType> {
+            return AsRef().Find(symbol,
+                                from);
+        }
+
+        auto Find(StringRef string,
+                  IndexType from = 0) const GSTD_NOEXCEPT -> Optional<IndexType> {
+            return AsRef().Find(string,
+                                from);
+        }
+
+        auto RFind(char symbol) const GSTD_NOEXCEPT -> Optional<IndexType> {
+            return AsRef().RFind(symbol);
+        }
+
+        auto RFind(StringRef string) const GSTD_NOEXCEPT -> Optional<IndexType> {
+            return AsRef().RFind(string);
+        }
+
+        auto Contains(char symbol) const GSTD_NOEXCEPT -> bool {
+            return AsRef().Contains(symbol);
+        }
+
+        auto Contains(StringRef string) const GSTD_NOEXCEPT -> bool {
+            return AsRef().Contains(string);
+        }
+
+        auto StartsWith(StringRef string) const GSTD_NOEXCEPT -> bool {
+            return AsRef().StartsWith(string);
+        }
+
+        auto EndsWith(StringRef string) const GSTD_NOEXCEPT -> bool {
+            return AsRef().EndsWith(string);
+        }
+
+        auto Substring(IndexType offset,
+                       SizeType size = ~static_cast<SizeType>(0)) const GSTD_NOEXCEPT -> StringRef {
+            return AsRef().Substring(offset,
+                                     size);
+        }
+
+        /**
+         * Splitting string by separator lazily. Tokens are views of this string, so string must outlive them
+         * @param separator Separator
+         * @return Iterator of tokens
+         */
+        auto Split(char separator) const GSTD_NOEXCEPT -> SplitIterator {
+            return AsRef().Split(separator);
+        }
+
+        auto Split(StringRef separator) const GSTD_NOEXCEPT -> SplitIterator {
+            return AsRef().Split(separator);
+        }
+
+        auto GetAllocator() const GSTD_NOEXCEPT -> RawPtr<Allocator> {
+            return _allocator;
+        }
+
+        /**
+         * Reserving memory for at least `capacity` bytes
+         * @param capacity Capacity
+         */
+        auto Reserve(SizeType capacity) -> void {
+            if (capacity > Capacity()) {
+                Reallocate(capacity);
+            }
+        }
 
-        StringIterator(char *pointer);
+        auto Append(char symbol) -> void {
+            auto size = Size();
+
+            if (size == Capacity()) {
+                Grow(size + 1);
+            }
+
+            auto data = Data();
+
+            data[size] = symbol;
+
+            SetSize(size + 1);
+        }
+
+        auto Append(StringRef string) -> void {
+            auto size = Size();
+
+            if (string.Size() > std::numeric_limits<SizeType>::max() - size - 1) {
+                Panic("String is too long!");
+            }
+
+            if (size + string.Size() > Capacity()) {
+                auto offset = string.Data() - Data();
+                auto aliased = offset >= 0 && static_cast<SizeType>(offset) < size;
+
+                Grow(size + string.Size());
+
+                if (aliased) {
+                    string = StringRef(Data() + offset,
+                                       string.Size());
+                }
+            }
+
+            MemMove(Data() + size,
+                    string.Data(),
+                    string.Size());
+
+            SetSize(size + string.Size());
+        }
+
+        /**
+         * Changing size of string. New bytes are filled with `symbol`
+         * @param size Size
+         * @param symbol Filling symbol
+         */
+        auto Resize(SizeType size,
+                    char symbol = '\0') -> void {
+            auto oldSize = Size();
+
+            if (size > oldSize) {
+                Reserve(size);
+
+                MemFill(Data() + oldSize,
+                        static_cast<Byte>(symbol),
+                        size - oldSize);
+            }
+
+            SetSize(size);
+        }
+
+        /**
+         * Changing size of string without initialization of new bytes, for example before writing by producer
+         * @param size Size
+         */
+        auto ResizeUninitialized(SizeType size) -> void {
+            Reserve(size);
+            SetSize(size);
+        }
+
+        auto Clear() GSTD_NOEXCEPT -> void {
+            SetSize(0);
+        }
+
+        /**
+         * Releasing unused heap memory. Short strings are moved back to inline storage
+         */
+        auto ShrinkToFit() -> void {
+            if (IsInline() || Size() == Capacity()) {
+                return;
+            }
+
+            Reallocate(Size());
+        }
+
+        auto begin() GSTD_NOEXCEPT -> char * {
+            return Data();
+        }
+
+        auto begin() const GSTD_NOEXCEPT -> const char * {
+            return Data();
+        }
+
+        auto end() GSTD_NOEXCEPT -> char * {
+            return Data() + Size();
+        }
+
+        auto end() const GSTD_NOEXCEPT -> const char * {
+            return Data() + Size();
+        }
 
     public:
 
-        bool has_next() const;
+        auto operator=(const String &string) -> String & {
+            if (this != &string) {
+                Clear();
+                Append(string.AsRef());
+            }
+
+            return *this;
+        }
 
-        void next();
+        auto operator=(String &&string) GSTD_NOEXCEPT -> String & {
+            if (this != &string) {
+                Release();
 
-        Symbol current() const;
-    };
+                _storage = string._storage;
+                _allocator = string._allocator;
+
+                string.SetInlineSize(0);
+            }
+
+            return *this;
+        }
+
+        auto operator=(StringRef string) -> String & {
+            if (string.Data() >= Data() && string.Data() <= Data() + Size()) {
+                MemMove(Data(),
+                        string.Data(),
+                        string.Size());
+
+                SetSize(string.Size());
+
+                return *this;
+            }
+
+            Clear();
+            Append(string);
+
+            return *this;
+        }
+
+        auto operator+=(StringRef string) -> String & {
+            Append(string);
+
+            return *this;
+        }
+
+        auto operator+=(char symbol) -> String & {
+            Append(symbol);
+
+            return *this;
+        }
+
+        auto operator[](const IndexType &index) -> char & {
+            if (index >= Size()) {
+                Panic("Index out of range!");
+            }
+
+            return Data()[index];
+        }
+
+        auto operator[](const IndexType &index) const -> char {
+            if (index >= Size()) {
+                Panic("Index out of range!");
+            }
+
+            return Data()[index];
+        }
+
+        auto operator==(StringRef string) const GSTD_NOEXCEPT -> bool {
+            return AsRef() == string;
+        }
+
+        auto operator==(const String &string) const GSTD_NOEXCEPT -> bool {
+            return AsRef() == string.AsRef();
+        }
+
+        auto operator<=>(StringRef string) const GSTD_NOEXCEPT -> std::strong_ordering {
+            return AsRef() <=> string;
+        }
+
+        auto operator<=>(const String &string) const GSTD_NOEXCEPT -> std::strong_ordering {
+            return AsRef() <=> string.AsRef();
+        }
+
+        operator StringRef() const GSTD_NOEXCEPT {
+            return AsRef();
+        }
 
-    class StringRef {
     private:
 
-        const char *_data;
+        static auto EncodeCapacity(SizeType capacity) GSTD_NOEXCEPT -> SizeType {
+            if GSTD_CONSTEXPR (std::endian::native == std::endian::little) {
+                return capacity | HeapFlagValue;
+            } else {
+                return (capacity << 8) | HeapFlagValue;
+            }
+        }
 
-        std::uint64_t _size;
-    };
+        static auto DecodeCapacity(SizeType encodedCapacity) GSTD_NOEXCEPT -> SizeType {
+            if GSTD_CONSTEXPR (std::endian::native == std::endian::little) {
+                return encodedCapacity & ~HeapFlagValue;
+            } else {
+                return encodedCapacity >> 8;
+            }
+        }
 
-    class SmallString {
-    public:
+        auto SetInlineSize(SizeType size) GSTD_NOEXCEPT -> void {
+            _storage.Inline[size] = '\0';
+            _storage.Inline[InlineCapacityValue] = static_cast<char>(InlineCapacityValue - size);
+        }
+
+        auto SetSize(SizeType size) GSTD_NOEXCEPT -> void {
+            if (IsInline()) {
+                SetInlineSize(size);
+            } else {
+                _storage.Heap.Size = size;
+                _storage.Heap.Data[size] = '\0';
+            }
+        }
+
+        /**
+         * Growing storage for holding at least `size` bytes with geometric growth
+         * @param size Required count of bytes
+         */
+        auto Grow(SizeType size) -> void {
+            auto capacity = Capacity() * 2;
+
+            Reallocate(size > capacity ? size : capacity);
+        }
+
+        /**
+         * Moving string to storage with `capacity` bytes. Strings, that fit inline storage, are moved inside object
+         * @param capacity Capacity, not less than size
+         */
+        auto Reallocate(SizeType capacity) -> void {
+            auto size = Size();
+
+            if (capacity <= InlineCapacityValue) {
+                if (IsInline()) {
+                    return;
+                }
+
+                auto heap = _storage.Heap;
+
+                MemCopy(_storage.Inline,
+                        heap.Data,
+                        size);
 
+                SetInlineSize(size);
 
+                _allocator->Deallocate(heap.Data,
+                                       DecodeCapacity(heap.EncodedCapacity) + 1,
+                                       1);
+
+                return;
+            }
+
+            auto data = _allocator->template Allocate<char>(capacity + 1,
+                                                            1);
+
+            MemCopy(data,
+                    Data(),
+                    size);
+
+            data[size] = '\0';
+
+            Release();
+
+            _storage.Heap.Data = data;
+            _storage.Heap.Size = size;
+            _storage.Heap.EncodedCapacity = EncodeCapacity(capacity);
+        }
+
+        auto Release() GSTD_NOEXCEPT -> void {
+            if (!IsInline()) {
+                _allocator->Deallocate(_storage.Heap.Data,
+                                       DecodeCapacity(_storage.Heap.EncodedCapacity) + 1,
+                                       1);
+
+                SetInlineSize(0);
+            }
+        }
+
+    private:
+
+        union Storage {
+            HeapStorage Heap;
+
+            char Inline[InlineCapacityValue + 1];
+        } _storage;
+
+        RawPtr<Allocator> _allocator;
     };
 
-    class StaticString {
-    public:
+    template<>
+    struct IsTriviallyRelocatable<String> : TrueType {
+
+    };
 
+    template<>
+    struct Formatter<String> {
 
+        template<typename WriterT>
+        static auto Format(WriterT &writer,
+                           const String &value) -> void {
+            writer.Write(value.Data(),
+                         value.Size());
+        }
     };
 
     inline std::istream &operator>>(std::istream &stream,
-                                    const String &string);
+                                    String &string) {
+        std::string input;
+
+        stream >> input;
+
+        string = StringRef(input);
+
+        return stream;
+    }
+
+    inline std::ostream &operator<<(std::ostream &stream,
+                                    const String &string) {
+        return stream.write(string.Data(),
+                            static_cast<std::streamsize>(string.Size()));
+    }
 
     inline std::ostream &operator<<(std::ostream &stream,
-                                    const String &string);
+                                    StringRef string) {
+        return stream.write(string.Data(),
+                            static_cast<std::streamsize>(string.Size()));
+    }
 
 }
 
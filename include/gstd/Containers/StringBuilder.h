@@ -0,0 +1,317 @@
+#ifndef GSTD_STRINGBUILDER_H
+#define GSTD_STRINGBUILDER_H
+
+#include <cstring>
+#include <new>
+
+#include <gstd/Containers/FormatString.h>
+#include <gstd/Containers/String.h>
+#include <gstd/Memory/Allocator.h>
+#include <gstd/Memory/RawPtr.h>
+
+namespace gstd {
+
+    /**
+     * Builder of string from many pieces. Pieces are copied once into chunks, that are never reallocated,
+     * and result is assembled with one allocation of exact size
+     */
+    class StringBuilder {
+    public:
+
+        using SizeType = std::uint64_t;
+
+    public:
+
+        StringBuilder(RawPtr<Allocator> allocator = DefaultAllocator()) GSTD_NOEXCEPT
+                : _allocator(allocator),
+                  _first(nullptr),
+                  _last(nullptr),
+                  _size(0) {}
+
+        StringBuilder(const StringBuilder &stringBuilder) = delete;
+
+        StringBuilder(StringBuilder &&stringBuilder) GSTD_NOEXCEPT
+                : _allocator(stringBuilder._allocator),
+                  _first(stringBuilder._first),
+                  _last(stringBuilder._last),
+                  _size(stringBuilder._size) {
+            stringBuilder._first = nullptr;
+            stringBuilder._last = nullptr;
+            stringBuilder._size = 0;
+        }
+
+    public:
+
+        ~StringBuilder() GSTD_NOEXCEPT {
+            Release();
+        }
+
+    public:
+
+        static auto New(RawPtr<Allocator> allocator = DefaultAllocator()) GSTD_NOEXCEPT -> StringBuilder {
+            return StringBuilder(allocator);
+        }
+
+    public:
+
+        /**
+         * Appending piece. Piece fills rest of last chunk, remainder is copied into new chunk
+         * @param string Piece
+         * @return Builder
+         */
+        auto Append(StringRef string) -> StringBuilder & {
+            auto data = string.Data();
+            auto size = string.Size();
+
+            if (_last != nullptr) {
+                auto count = _last->Capacity - _last->Size < size ? _last->Capacity - _last->Size : size;
+
+                if (count != 0) {
+                    std::memcpy(_last->Data() + _last->Size,
+                                data,
+                                count);
+                }
+
+                _last->Size += count;
+                data += count;
+                size -= count;
+            }
+
+            if (size != 0) {
+                auto chunk = NewChunk(size);
+
+                std::memcpy(chunk->Data(),
+                            data,
+                            size);
+
+                chunk->Size = size;
+            }
+
+            _size += string.Size();
+
+            return *this;
+        }
+
+        auto Append(char symbol) -> StringBuilder & {
+            if (_last == nullptr || _last->Size == _last->Capacity) {
+                NewChunk(1);
+            }
+
+            _last->Data()[_last->Size++] = symbol;
+            ++_size;
+
+            return *this;
+        }
+
+        auto Size() const GSTD_NOEXCEPT -> SizeType {
+            return _size;
+        }
+
+        auto Empty() const GSTD_NOEXCEPT -> bool {
+            return _size == 0;
+        }
+
+        /**
+         * Calling function for each chunk of accumulated string in order
+         * @tparam FunctionT Function type
+         * @param function Function, that takes `StringRef`
+         */
+        template<typename FunctionT>
+        auto ForEachChunk(FunctionT &&function) const -> void {
+            for (auto chunk = _first; chunk != nullptr; chunk = chunk->Next) {
+                if (chunk->Size != 0) {
+                    function(StringRef(chunk->Data(),
+                                       chunk->Size));
+                }
+            }
+        }
+
+        /**
+         * Copying accumulated string into buffer
+         * @param output Buffer, must have at least `Size()` bytes
+         * @return Count of copied bytes
+         */
+        auto CopyTo(Span<char> output) const -> SizeType {
+            if (output.Size() < _size) {
+                Panic("Output buffer is too small!");
+            }
+
+            auto data = output.Data();
+
+            ForEachChunk([&data] (StringRef chunk) {
+                std::memcpy(data,
+                            chunk.Data(),
+                            chunk.Size());
+
+                data += chunk.Size();
+            });
+
+            return _size;
+        }
+
+        /**
+         * Assembling string with one allocation of exact size
+         * @return String
+         */
+        auto Build() const -> String {
+            String result(_allocator);
+
+            result.ResizeUninitialized(_size);
+
+            CopyTo(result.AsSpan());
+
+            return result;
+        }
+
+        auto Clear() GSTD_NOEXCEPT -> void {
+            Release();
+
+            _first = nullptr;
+            _last = nullptr;
+            _size = 0;
+        }
+
+    public:
+
+        auto operator=(const StringBuilder &stringBuilder) -> StringBuilder & = delete;
+
+        auto operator=(StringBuilder &&stringBuilder) GSTD_NOEXCEPT -> StringBuilder & {
+            if (this != &stringBuilder) {
+                Release();
+
+                _allocator = stringBuilder._allocator;
+                _first = stringBuilder._first;
+                _last = stringBuilder._last;
+                _size = stringBuilder._size;
+
+                stringBuilder._first = nullptr;
+                stringBuilder._last = nullptr;
+                stringBuilder._size = 0;
+            }
+
+            return *this;
+        }
+
+        auto operator+=(StringRef string) -> StringBuilder & {
+            return Append(string);
+        }
+
+        auto operator+=(char symbol) -> StringBuilder & {
+            return Append(symbol);
+        }
+
+    private:
+
+        struct Chunk {
+
+            auto Data() GSTD_NOEXCEPT -> char * {
+                return reinterpret_cast<char *>(this + 1);
+            }
+
+            Chunk *Next;
+
+            SizeType Capacity;
+
+            SizeType Size;
+        };
+
+    private:
+
+        static constexpr SizeType FirstChunkValue = 256;
+
+        static constexpr SizeType MaxChunkValue = 1024 * 1024;
+
+    private:
+
+        /**
+         * Allocating chunk. Chunks grow with accumulated size up to `MaxChunkValue`, but fit whole remainder of piece
+         */
+        auto NewChunk(SizeType required) -> Chunk * {
+            auto capacity = _size < FirstChunkValue ? FirstChunkValue : (_size < MaxChunkValue ? _size : MaxChunkValue);
+
+            capacity = capacity < required ? required : capacity;
+
+            auto chunk = new (_allocator->template Allocate<Byte>(sizeof(Chunk) + capacity,
+                                                                  alignof(Chunk))) Chunk {
+                nullptr,
+                capacity,
+                0
+            };
+
+            if (_last != nullptr) {
+                _last->Next = chunk;
+            } else {
+                _first = chunk;
+            }
+
+            _last = chunk;
+
+            return chunk;
+        }
+
+        auto Release() GSTD_NOEXCEPT -> void {
+            for (auto chunk = _first; chunk != nullptr; ) {
+                auto next = chunk->Next;
+
+                _allocator->Deallocate(reinterpret_cast<Byte *>(chunk),
+                                       sizeof(Chunk) + chunk->Capacity,
+                                       alignof(Chunk));
+
+                chunk = next;
+            }
+        }
+
+    private:
+
+        RawPtr<Allocator> _allocator;
+
+        Chunk *_first;
+
+        Chunk *_last;
+
+        SizeType _size;
+    };
+
+    namespace detail {
+
+        class StringBuilderFormatWriter {
+        public:
+
+            auto Write(const char *data,
+                       std::uint64_t size) -> void {
+                Builder.Append(StringRef(data,
+                                         size));
+            }
+
+        public:
+
+            StringBuilder &Builder;
+        };
+
+    }
+
+    /**
+     * Formatting text into builder: `FormatTo<"{}: {}">(builder, key, value)`. Format string is checked at compile time
+     * @tparam FormatV Format string
+     * @param builder Builder
+     * @param arguments Arguments, that have `Formatter`
+     * @return Count of appended characters
+     */
+    template<StaticString FormatV,
+             typename... ArgumentsT>
+    auto FormatTo(StringBuilder &builder,
+                  const ArgumentsT &...arguments) -> std::uint64_t {
+        auto size = builder.Size();
+        detail::StringBuilderFormatWriter writer {
+            builder
+        };
+
+        detail::FormatWith<FormatV>(writer,
+                                    arguments...);
+
+        return builder.Size() - size;
+    }
+
+}
+
+#endif //GSTD_STRINGBUILDER_H
@@ -0,0 +1,518 @@
+#ifndef GSTD_STRINGREF_H
+#define GSTD_STRINGREF_H
+
+#include <bit>
+#include <compare>
+#include <string>
+#include <string_view>
+
+#include <gstd/Algorithm/Hash.h>
+#include <gstd/Containers/FormatString.h>
+#include <gstd/Containers/Span.h>
+#include <gstd/Containers/StaticString.h>
+#include <gstd/Containers/StringSearch.h>
+#include <gstd/Memory/MemoryOperations.h>
+
+namespace gstd {
+
+    /**
+     * Counting length of null-terminated string. In constant evaluation string is counted by bytes,
+     * otherwise vectorized `Length` is used
+     * @param string Null-terminated string
+     * @return Length of string without null terminator
+     */
+    constexpr auto Size(const char *string) -> size_t {
+        if (!std::is_constant_evaluated()) {
+            return static_cast<size_t>(Length(string));
+        }
+
+        size_t size = 0;
+
+        for (size_t index = 0; string[index] != '\0'; ++index, ++size) {}
+
+        return size;
+    }
+
+    class SplitIterator;
+
+    /**
+     * Non-owning view of UTF-8 string. String is not required to be null-terminated
+     */
+    class StringRef {
+    public:
+
+        using ValueType = char;
+
+        using SizeType = std::uint64_t;
+
+        using IndexType = std::uint64_t;
+
+    public:
+
+        GSTD_CONSTEXPR StringRef() GSTD_NOEXCEPT
+                : _data(""),
+                  _size(0) {}
+
+        GSTD_CONSTEXPR StringRef(const char *data,
+                                 SizeType size) GSTD_NOEXCEPT
+                : _data(data),
+                  _size(size) {}
+
+        GSTD_CONSTEXPR StringRef(const char *string) GSTD_NOEXCEPT
+                : _data(string),
+                  _size(gstd::Size(string)) {}
+
+        GSTD_CONSTEXPR StringRef(std::string_view string) GSTD_NOEXCEPT
+                : _data(string.data()),
+                  _size(string.size()) {}
+
+        GSTD_CONSTEXPR StringRef(const std::string &string) GSTD_NOEXCEPT
+                : _data(string.data()),
+                  _size(string.size()) {}
+
+    public:
+
+        static GSTD_CONSTEXPR auto New(const char *data,
+                                       SizeType size) GSTD_NOEXCEPT -> StringRef {
+            return StringRef {
+                data,
+                size
+            };
+        }
+
+    public:
+
+        GSTD_CONSTEXPR auto Data() const GSTD_NOEXCEPT -> const char * {
+            return _data;
+        }
+
+        GSTD_CONSTEXPR auto Size() const GSTD_NOEXCEPT -> SizeType {
+            return _size;
+        }
+
+        GSTD_CONSTEXPR auto Empty() const GSTD_NOEXCEPT -> bool {
+            return _size == 0;
+        }
+
+        GSTD_CONSTEXPR auto At(const IndexType &index) const GSTD_NOEXCEPT -> Optional<Ref<const char>> {
+            if (index >= _size) {
+                return MakeNone();
+            }
+
+            return MakeSome(MakeCRef(_data[index]));
+        }
+
+        GSTD_CONSTEXPR auto AsSpan() const GSTD_NOEXCEPT -> Span<const char> {
+            return Span<const char>(_data,
+                                    _size);
+        }
+
+        GSTD_CONSTEXPR auto AsStringView() const GSTD_NOEXCEPT -> std::string_view {
+            return std::string_view(_data,
+                                    _size);
+        }
+
+        /**
+         * Comparing strings lexicographically by bytes
+         * @param string String
+         * @return Negative, zero or positive value
+         */
+        GSTD_CONSTEXPR auto Compare(StringRef string) const GSTD_NOEXCEPT -> int {
+            auto size = _size < string._size ? _size : string._size;
+
+            if (std::is_constant_evaluated()) {
+                for (SizeType index = 0; index < size; ++index) {
+                    auto first = static_cast<std::uint8_t>(_data[index]);
+                    auto second = static_cast<std::uint8_t>(string._data[index]);
+
+                    if (first != second) {
+                        return first < second ? -1 : 1;
+                    }
+                }
+            } else if (auto result = MemCompare(_data, string._data, size); result != 0) {
+                return result;
+            }
+
+            return _size == string._size ? 0 : (_size < string._size ? -1 : 1);
+        }
+
+        /**
+         * Getting part of string. Offset and size are clamped by size of string
+         * @param offset Offset of part
+         * @param size Size of part
+         * @return Part of string
+         */
+        GSTD_CONSTEXPR auto Substring(IndexType offset,
+                                      SizeType size = ~static_cast<SizeType>(0)) const GSTD_NOEXCEPT -> StringRef {
+            offset = offset < _size ? offset : _size;
+            size = size < _size - offset ? size : _size - offset;
+
+            return StringRef(_data + offset,
+                             size);
+        }
+
+        /**
+         * Finding byte in string
+         * @param symbol Byte
+         * @param from Index, from which searching starts
+         * @return Index of first found byte or `None`
+         */
+        GSTD_CONSTEXPR auto Find(char symbol,
+                                 IndexType from = 0) const GSTD_NOEXCEPT -> Optional<IndexType> {
+            if (from >= _size) {
+                return MakeNone();
+            }
+
+            return MakeResult(from,
+                              detail::FindByte(_data + from,
+                                               _size - from,
+                                               symbol));
+        }
+
+        /**
+         * Finding substring in string<br>
+         * With AVX2 candidates are filtered by first and last bytes of substring, 32 positions per step
+         * @param string Substring
+         * @param from Index, from which searching starts
+         * @return Index of first occurrence or `None`
+         */
+        GSTD_CONSTEXPR auto Find(StringRef string,
+                                 IndexType from = 0) const GSTD_NOEXCEPT -> Optional<IndexType> {
+            if (from > _size) {
+                return MakeNone();
+            }
+
+            return MakeResult(from,
+                              detail::FindSubstring(_data + from,
+                                                    _size - from,
+                                                    string._data,
+                                                    string._size));
+        }
+
+        /**
+         * Finding last occurrence of byte in string
+         * @param symbol Byte
+         * @return Index of last found byte or `None`
+         */
+        GSTD_CONSTEXPR auto RFind(char symbol) const GSTD_NOEXCEPT -> Optional<IndexType> {
+            return MakeResult(0,
+                              detail::RFindByte(_data,
+                                                _size,
+                                                symbol));
+        }
+
+        /**
+         * Finding last occurrence of substring in string
+         * @param string Substring
+         * @return Index of last occurrence or `None`
+         */
+        GSTD_CONSTEXPR auto RFind(StringRef string) const GSTD_NOEXCEPT -> Optional<IndexType> {
+            return MakeResult(0,
+                              detail::RFindSubstring(_data,
+                                                     _size,
+                                                     string._data,
+                                                     string._size));
+        }
+
+        GSTD_CONSTEXPR auto Contains(char symbol) const GSTD_NOEXCEPT -> bool {
+            return detail::FindByte(_data,
+                                    _size,
+                                    symbol) != detail::StringNotFoundValue;
+        }
+
+        GSTD_CONSTEXPR auto Contains(StringRef string) const GSTD_NOEXCEPT -> bool {
+            return detail::FindSubstring(_data,
+                                         _size,
+                                         string._data,
+                                         string._size) != detail::StringNotFoundValue;
+        }
+
+        GSTD_CONSTEXPR auto StartsWith(StringRef string) const GSTD_NOEXCEPT -> bool {
+            return string._size <= _size && StringRef(_data, string._size).Compare(string) == 0;
+        }
+
+        GSTD_CONSTEXPR auto EndsWith(StringRef string) const GSTD_NOEXCEPT -> bool {
+            return string._size <= _size && StringRef(_data + (_size - string._size), string._size).Compare(string) == 0;
+        }
+
+        /**
+         * Splitting string by separator lazily. Tokens are views of this string, empty tokens are kept
+         * @param separator Separator
+         * @return Iterator of tokens
+         */
+        GSTD_CONSTEXPR auto Split(char separator) const GSTD_NOEXCEPT -> SplitIterator;
+
+        /**
+         * Splitting string by substring separator lazily. Empty separator doesn`t split string
+         * @param separator Separator
+         * @return Iterator of tokens
+         */
+        GSTD_CONSTEXPR auto Split(StringRef separator) const GSTD_NOEXCEPT -> SplitIterator;
+
+        GSTD_CONSTEXPR auto begin() const GSTD_NOEXCEPT -> const char * {
+            return _data;
+        }
+
+        GSTD_CONSTEXPR auto end() const GSTD_NOEXCEPT -> const char * {
+            return _data + _size;
+        }
+
+    public:
+
+        GSTD_CONSTEXPR auto operator[](const IndexType &index) const -> char {
+            if (index >= _size) {
+                Panic("Index out of range!");
+            }
+
+            return _data[index];
+        }
+
+        GSTD_CONSTEXPR auto operator==(StringRef string) const GSTD_NOEXCEPT -> bool {
+            return _size == string._size && Compare(string) == 0;
+        }
+
+        GSTD_CONSTEXPR auto operator<=>(StringRef string) const GSTD_NOEXCEPT -> std::strong_ordering {
+            return Compare(string) <=> 0;
+        }
+
+    private:
+
+        static GSTD_CONSTEXPR auto MakeResult(IndexType from,
+                                              IndexType index) GSTD_NOEXCEPT -> Optional<IndexType> {
+            if (index == detail::StringNotFoundValue) {
+                return MakeNone();
+            }
+
+            return MakeSome(from + index);
+        }
+
+    private:
+
+        const char *_data;
+
+        SizeType _size;
+    };
+
+    /**
+     * Lazy iterator of tokens, that separated by byte or substring. Tokens are not copied
+     */
+    class SplitIterator {
+    public:
+
+        GSTD_CONSTEXPR SplitIterator(StringRef string,
+                                     StringRef separator) GSTD_NOEXCEPT
+                : _string(string),
+                  _separator(separator),
+                  _symbol(separator.Size() == 1 ? separator.Data()[0] : '\0'),
+                  _bySymbol(separator.Size() == 1),
+                  _position(0),
+                  _tokenEnd(0),
+                  _finished(false) {
+            FindToken();
+        }
+
+        GSTD_CONSTEXPR SplitIterator(StringRef string,
+                                     char separator) GSTD_NOEXCEPT
+                : _string(string),
+                  _separator(),
+                  _symbol(separator),
+                  _bySymbol(true),
+                  _position(0),
+                  _tokenEnd(0),
+                  _finished(false) {
+            FindToken();
+        }
+
+    public:
+
+        GSTD_CONSTEXPR auto has_next() const GSTD_NOEXCEPT -> bool {
+            return !_finished;
+        }
+
+        GSTD_CONSTEXPR auto next() GSTD_NOEXCEPT -> void {
+            if (_tokenEnd == _string.Size()) {
+                _finished = true;
+
+                return;
+            }
+
+            _position = _tokenEnd + SeparatorSize();
+
+            FindToken();
+        }
+
+        GSTD_CONSTEXPR auto current() const GSTD_NOEXCEPT -> StringRef {
+            return StringRef(_string.Data() + _position,
+                             _tokenEnd - _position);
+        }
+
+        /**
+         * Getting part of string, that is not split yet, including current token
+         * @return Remaining part of string
+         */
+        GSTD_CONSTEXPR auto Remaining() const GSTD_NOEXCEPT -> StringRef {
+            return _string.Substring(_position);
+        }
+
+    public:
+
+        /**
+         * Iterator for range-based loops over tokens
+         */
+        class Cursor {
+        public:
+
+            GSTD_CONSTEXPR explicit Cursor(SplitIterator *iterator) GSTD_NOEXCEPT
+                    : _iterator(iterator) {}
+
+        public:
+
+            GSTD_CONSTEXPR auto operator*() const GSTD_NOEXCEPT -> StringRef {
+                return _iterator->current();
+            }
+
+            GSTD_CONSTEXPR auto operator++() GSTD_NOEXCEPT -> Cursor & {
+                _iterator->next();
+
+                return *this;
+            }
+
+            GSTD_CONSTEXPR auto operator!=(const Cursor &cursor) const GSTD_NOEXCEPT -> bool {
+                return _iterator != cursor._iterator && _iterator->has_next();
+            }
+
+        private:
+
+            SplitIterator *_iterator;
+        };
+
+        GSTD_CONSTEXPR auto begin() GSTD_NOEXCEPT -> Cursor {
+            return Cursor(this);
+        }
+
+        GSTD_CONSTEXPR auto end() GSTD_NOEXCEPT -> Cursor {
+            return Cursor(nullptr);
+        }
+
+    private:
+
+        GSTD_CONSTEXPR auto SeparatorSize() const GSTD_NOEXCEPT -> StringRef::SizeType {
+            return _bySymbol ? 1 : _separator.Size();
+        }
+
+        GSTD_CONSTEXPR auto FindToken() GSTD_NOEXCEPT -> void {
+            auto data = _string.Data() + _position;
+            auto size = _string.Size() - _position;
+            auto found = detail::StringNotFoundValue;
+
+            if (_bySymbol) {
+                found = detail::FindByte(data,
+                                         size,
+                                         _symbol);
+            } else if (!_separator.Empty()) {
+                found = detail::FindSubstring(data,
+                                              size,
+                                              _separator.Data(),
+                                              _separator.Size());
+            }
+
+            _tokenEnd = found == detail::StringNotFoundValue ? _string.Size() : _position + found;
+        }
+
+    private:
+
+        StringRef _string;
+
+        StringRef _separator;
+
+        char _symbol;
+
+        bool _bySymbol;
+
+        StringRef::IndexType _position;
+
+        StringRef::IndexType _tokenEnd;
+
+        bool _finished;
+    };
+
+    /**
+     * Hashing bytes of string by words of 8 bytes. Hash is same in constant evaluation and at runtime
+     * @param string String
+     * @return Hash of string
+     */
+    GSTD_CONSTEXPR auto Hash(StringRef string) GSTD_NOEXCEPT -> std::uint64_t {
+        return detail::HashBytes(string.Data(),
+                                 string.Size());
+    }
+
+    template<>
+    struct Formatter<StringRef> {
+
+        template<typename WriterT>
+        static GSTD_CONSTEXPR auto Format(WriterT &writer,
+                                          const StringRef &value) -> void {
+            writer.Write(value.Data(),
+                         value.Size());
+        }
+    };
+
+    GSTD_CONSTEXPR auto StringRef::Split(char separator) const GSTD_NOEXCEPT -> SplitIterator {
+        return SplitIterator(*this,
+                             separator);
+    }
+
+    GSTD_CONSTEXPR auto StringRef::Split(StringRef separator) const GSTD_NOEXCEPT -> SplitIterator {
+        return SplitIterator(*this,
+                             separator);
+    }
+
+    /*
+     *
+     * StaticString members, that use StringRef
+     *
+     */
+
+    template<std::uint64_t CapacityV>
+    GSTD_CONSTEXPR StaticString<CapacityV>::StaticString(StringRef string)
+            : Characters(),
+              Count(string.Size()) {
+        if (string.Size() > CapacityV) {
+            Panic("String is too long for StaticString!");
+        }
+
+        for (SizeType index = 0; index < string.Size(); ++index) {
+            Characters[index] = string.Data()[index];
+        }
+    }
+
+    template<std::uint64_t CapacityV>
+    GSTD_CONSTEXPR auto StaticString<CapacityV>::AsRef() const GSTD_NOEXCEPT -> StringRef {
+        return StringRef(Characters,
+                         Count);
+    }
+
+    template<std::uint64_t CapacityV>
+    GSTD_CONSTEXPR auto StaticString<CapacityV>::Append(StringRef string) -> void {
+        Append(string.Data(),
+               string.Size());
+    }
+
+    template<std::uint64_t CapacityV>
+    GSTD_CONSTEXPR StaticString<CapacityV>::operator StringRef() const GSTD_NOEXCEPT {
+        return AsRef();
+    }
+
+    template<std::uint64_t CapacityV>
+    GSTD_CONSTEXPR auto StaticString<CapacityV>::operator==(StringRef string) const GSTD_NOEXCEPT -> bool {
+        return AsRef() == string;
+    }
+
+    template<std::uint64_t CapacityV>
+    GSTD_CONSTEXPR auto StaticString<CapacityV>::operator<=>(StringRef string) const GSTD_NOEXCEPT -> std::strong_ordering {
+        return AsRef() <=> string;
+    }
+
+}
+
+#endif //GSTD_STRINGREF_H
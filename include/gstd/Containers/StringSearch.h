@@ -0,0 +1,458 @@
+#ifndef GSTD_STRINGSEARCH_H
+#define GSTD_STRINGSEARCH_H
+
+#include <bit>
+#include <cstring>
+
+#include <gstd/Algorithm/Simd.h>
+
+#if defined(GSTD_ARCH_X86_64)
+    #include <immintrin.h>
+#endif
+
+namespace gstd {
+
+    namespace detail {
+
+        /**
+         * Result of string searching kernels, if nothing is found
+         */
+        inline constexpr std::uint64_t StringNotFoundValue = ~static_cast<std::uint64_t>(0);
+
+        /**
+         * Counting length of null-terminated string by words of 8 bytes. Words are aligned, so reading never crosses page
+         */
+        GSTD_NO_SANITIZE_ADDRESS
+        inline auto LengthScalar(const char *string) GSTD_NOEXCEPT -> std::uint64_t {
+            auto pointer = string;
+
+            for (; reinterpret_cast<std::uintptr_t>(pointer) % sizeof(std::uint64_t) != 0; ++pointer) {
+                if (*pointer == '\0') {
+                    return static_cast<std::uint64_t>(pointer - string);
+                }
+            }
+
+            for (;; pointer += sizeof(std::uint64_t)) {
+                std::uint64_t word;
+
+                std::memcpy(&word,
+                            pointer,
+                            sizeof(std::uint64_t));
+
+                if (((word - 0x0101010101010101ull) & ~word & 0x8080808080808080ull) != 0) {
+                    break;
+                }
+            }
+
+            for (; *pointer != '\0'; ++pointer) {}
+
+            return static_cast<std::uint64_t>(pointer - string);
+        }
+
+        inline auto FindByteScalar(const char *data,
+                                   std::uint64_t size,
+                                   char symbol) GSTD_NOEXCEPT -> std::uint64_t {
+            auto found = static_cast<const char *>(std::memchr(data,
+                                                               symbol,
+                                                               size));
+
+            return found != nullptr ? static_cast<std::uint64_t>(found - data) : StringNotFoundValue;
+        }
+
+        GSTD_CONSTEXPR auto RFindByteScalar(const char *data,
+                                            std::uint64_t size,
+                                            char symbol) GSTD_NOEXCEPT -> std::uint64_t {
+            for (auto index = size; index > 0; --index) {
+                if (data[index - 1] == symbol) {
+                    return index - 1;
+                }
+            }
+
+            return StringNotFoundValue;
+        }
+
+        /**
+         * Finding substring by candidates of first byte. Needle must have at least 2 bytes and not be longer than string
+         */
+        inline auto FindSubstringScalar(const char *data,
+                                        std::uint64_t size,
+                                        const char *needle,
+                                        std::uint64_t needleSize) GSTD_NOEXCEPT -> std::uint64_t {
+            auto last = data + (size - needleSize);
+
+            for (auto pointer = data; pointer <= last; ++pointer) {
+                pointer = static_cast<const char *>(std::memchr(pointer,
+                                                                needle[0],
+                                                                static_cast<std::uint64_t>(last - pointer) + 1));
+
+                if (pointer == nullptr) {
+                    break;
+                }
+
+                if (pointer[needleSize - 1] == needle[needleSize - 1]
+                    && std::memcmp(pointer + 1, needle + 1, needleSize - 2) == 0) {
+                    return static_cast<std::uint64_t>(pointer - data);
+                }
+            }
+
+            return StringNotFoundValue;
+        }
+
+        inline auto RFindSubstringScalar(const char *data,
+                                         std::uint64_t size,
+                                         const char *needle,
+                                         std::uint64_t needleSize) GSTD_NOEXCEPT -> std::uint64_t {
+            for (auto index = size - needleSize + 1; index > 0; --index) {
+                auto pointer = data + index - 1;
+
+                if (pointer[0] == needle[0]
+                    && pointer[needleSize - 1] == needle[needleSize - 1]
+                    && std::memcmp(pointer + 1, needle + 1, needleSize - 2) == 0) {
+                    return index - 1;
+                }
+            }
+
+            return StringNotFoundValue;
+        }
+
+#if defined(GSTD_ARCH_X86_64)
+
+        /**
+         * Counting length of null-terminated string by aligned blocks of 32 bytes
+         */
+        GSTD_TARGET("avx2,bmi") GSTD_NO_SANITIZE_ADDRESS
+        inline auto LengthAVX2(const char *string) GSTD_NOEXCEPT -> std::uint64_t {
+            auto address = reinterpret_cast<std::uintptr_t>(string);
+            auto block = reinterpret_cast<const char *>(address & ~static_cast<std::uintptr_t>(31));
+            auto zero = _mm256_setzero_si256();
+
+            auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i *>(block)),
+                                                                                         zero))) >> (address & 31);
+
+            if (mask != 0) {
+                return static_cast<std::uint64_t>(std::countr_zero(mask));
+            }
+
+            for (;;) {
+                block += 32;
+
+                mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i *>(block)),
+                                                                                        zero)));
+
+                if (mask != 0) {
+                    return static_cast<std::uint64_t>(block - string) + std::countr_zero(mask);
+                }
+            }
+        }
+
+        GSTD_TARGET("avx2,bmi")
+        inline auto FindByteAVX2(const char *data,
+                                 std::uint64_t size,
+                                 char symbol) GSTD_NOEXCEPT -> std::uint64_t {
+            auto needle = _mm256_set1_epi8(symbol);
+            std::uint64_t index = 0;
+
+            for (; index + 64 <= size; index += 64) {
+                auto first = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + index)),
+                                               needle);
+                auto second = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + index + 32)),
+                                                needle);
+
+                if (_mm256_testz_si256(_mm256_or_si256(first, second), _mm256_or_si256(first, second)) == 0) {
+                    auto mask = static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(first)))
+                                | static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(second))) << 32;
+
+                    return index + std::countr_zero(mask);
+                }
+            }
+
+            for (; index + 32 <= size; index += 32) {
+                auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + index)),
+                                                                                             needle)));
+
+                if (mask != 0) {
+                    return index + std::countr_zero(mask);
+                }
+            }
+
+            for (; index < size; ++index) {
+                if (data[index] == symbol) {
+                    return index;
+                }
+            }
+
+            return StringNotFoundValue;
+        }
+
+        GSTD_TARGET("avx2,bmi")
+        inline auto RFindByteAVX2(const char *data,
+                                  std::uint64_t size,
+                                  char symbol) GSTD_NOEXCEPT -> std::uint64_t {
+            auto needle = _mm256_set1_epi8(symbol);
+
+            for (; size >= 32; size -= 32) {
+                auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + size - 32)),
+                                                                                             needle)));
+
+                if (mask != 0) {
+                    return size - 1 - std::countl_zero(mask);
+                }
+            }
+
+            return RFindByteScalar(data,
+                                   size,
+                                   symbol);
+        }
+
+        /**
+         * Finding substring with filtering of candidates by first and last bytes of needle, 32 positions per step.
+         * Full comparison is done only for positions, where both bytes match
+         */
+        GSTD_TARGET("avx2,bmi")
+        inline auto FindSubstringAVX2(const char *data,
+                                      std::uint64_t size,
+                                      const char *needle,
+                                      std::uint64_t needleSize) GSTD_NOEXCEPT -> std::uint64_t {
+            auto first = _mm256_set1_epi8(needle[0]);
+            auto last = _mm256_set1_epi8(needle[needleSize - 1]);
+            std::uint64_t index = 0;
+
+            for (; index + needleSize - 1 + 32 <= size; index += 32) {
+                auto firstBlock = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + index));
+                auto lastBlock = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + index + needleSize - 1));
+
+                auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(firstBlock, first),
+                                                                                             _mm256_cmpeq_epi8(lastBlock, last))));
+
+                for (; mask != 0; mask &= mask - 1) {
+                    auto position = index + std::countr_zero(mask);
+
+                    if (std::memcmp(data + position + 1, needle + 1, needleSize - 2) == 0) {
+                        return position;
+                    }
+                }
+            }
+
+            if (index + needleSize > size) {
+                return StringNotFoundValue;
+            }
+
+            auto found = FindSubstringScalar(data + index,
+                                             size - index,
+                                             needle,
+                                             needleSize);
+
+            return found != StringNotFoundValue ? index + found : StringNotFoundValue;
+        }
+
+        GSTD_TARGET("avx2,bmi")
+        inline auto RFindSubstringAVX2(const char *data,
+                                       std::uint64_t size,
+                                       const char *needle,
+                                       std::uint64_t needleSize) GSTD_NOEXCEPT -> std::uint64_t {
+            auto first = _mm256_set1_epi8(needle[0]);
+            auto last = _mm256_set1_epi8(needle[needleSize - 1]);
+            auto positions = size - needleSize + 1;
+
+            for (; positions >= 32; positions -= 32) {
+                auto index = positions - 32;
+                auto firstBlock = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + index));
+                auto lastBlock = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + index + needleSize - 1));
+
+                auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(firstBlock, first),
+                                                                                             _mm256_cmpeq_epi8(lastBlock, last))));
+
+                while (mask != 0) {
+                    auto bit = 31 - std::countl_zero(mask);
+
+                    if (std::memcmp(data + index + bit + 1, needle + 1, needleSize - 2) == 0) {
+                        return index + bit;
+                    }
+
+                    mask &= ~(static_cast<std::uint32_t>(1) << bit);
+                }
+            }
+
+            if (positions == 0) {
+                return StringNotFoundValue;
+            }
+
+            return RFindSubstringScalar(data,
+                                        positions + needleSize - 1,
+                                        needle,
+                                        needleSize);
+        }
+
+#endif
+
+        /**
+         * Finding byte in string
+         * @return Index of first found byte or `StringNotFoundValue`
+         */
+        GSTD_CONSTEXPR auto FindByte(const char *data,
+                                     std::uint64_t size,
+                                     char symbol) GSTD_NOEXCEPT -> std::uint64_t {
+            if (std::is_constant_evaluated()) {
+                for (std::uint64_t index = 0; index < size; ++index) {
+                    if (data[index] == symbol) {
+                        return index;
+                    }
+                }
+
+                return StringNotFoundValue;
+            }
+
+#if defined(GSTD_ARCH_X86_64)
+            if (CurrentSimdLevel() >= SimdLevel::AVX2) {
+                return FindByteAVX2(data,
+                                    size,
+                                    symbol);
+            }
+#endif
+
+            return FindByteScalar(data,
+                                  size,
+                                  symbol);
+        }
+
+        /**
+         * Finding last occurrence of byte in string
+         * @return Index of last found byte or `StringNotFoundValue`
+         */
+        GSTD_CONSTEXPR auto RFindByte(const char *data,
+                                      std::uint64_t size,
+                                      char symbol) GSTD_NOEXCEPT -> std::uint64_t {
+            if (std::is_constant_evaluated()) {
+                return RFindByteScalar(data,
+                                       size,
+                                       symbol);
+            }
+
+#if defined(GSTD_ARCH_X86_64)
+            if (CurrentSimdLevel() >= SimdLevel::AVX2) {
+                return RFindByteAVX2(data,
+                                     size,
+                                     symbol);
+            }
+#endif
+
+            return RFindByteScalar(data,
+                                   size,
+                                   symbol);
+        }
+
+        /**
+         * Finding substring in string. Empty needle is found at start of string
+         * @return Index of first occurrence or `StringNotFoundValue`
+         */
+        GSTD_CONSTEXPR auto FindSubstring(const char *data,
+                                          std::uint64_t size,
+                                          const char *needle,
+                                          std::uint64_t needleSize) GSTD_NOEXCEPT -> std::uint64_t {
+            if (needleSize > size) {
+                return StringNotFoundValue;
+            }
+
+            if (needleSize <= 1) {
+                return needleSize == 0 ? 0 : FindByte(data,
+                                                      size,
+                                                      needle[0]);
+            }
+
+            if (std::is_constant_evaluated()) {
+                for (std::uint64_t index = 0; index + needleSize <= size; ++index) {
+                    std::uint64_t offset = 0;
+
+                    for (; offset < needleSize && data[index + offset] == needle[offset]; ++offset) {}
+
+                    if (offset == needleSize) {
+                        return index;
+                    }
+                }
+
+                return StringNotFoundValue;
+            }
+
+#if defined(GSTD_ARCH_X86_64)
+            if (CurrentSimdLevel() >= SimdLevel::AVX2) {
+                return FindSubstringAVX2(data,
+                                         size,
+                                         needle,
+                                         needleSize);
+            }
+#endif
+
+            return FindSubstringScalar(data,
+                                       size,
+                                       needle,
+                                       needleSize);
+        }
+
+        /**
+         * Finding last occurrence of substring in string. Empty needle is found at end of string
+         * @return Index of last occurrence or `StringNotFoundValue`
+         */
+        GSTD_CONSTEXPR auto RFindSubstring(const char *data,
+                                           std::uint64_t size,
+                                           const char *needle,
+                                           std::uint64_t needleSize) GSTD_NOEXCEPT -> std::uint64_t {
+            if (needleSize > size) {
+                return StringNotFoundValue;
+            }
+
+            if (needleSize <= 1) {
+                return needleSize == 0 ? size : RFindByte(data,
+                                                          size,
+                                                          needle[0]);
+            }
+
+            if (std::is_constant_evaluated()) {
+                for (auto index = size - needleSize + 1; index > 0; --index) {
+                    std::uint64_t offset = 0;
+
+                    for (; offset < needleSize && data[index - 1 + offset] == needle[offset]; ++offset) {}
+
+                    if (offset == needleSize) {
+                        return index - 1;
+                    }
+                }
+
+                return StringNotFoundValue;
+            }
+
+#if defined(GSTD_ARCH_X86_64)
+            if (CurrentSimdLevel() >= SimdLevel::AVX2) {
+                return RFindSubstringAVX2(data,
+                                          size,
+                                          needle,
+                                          needleSize);
+            }
+#endif
+
+            return RFindSubstringScalar(data,
+                                        size,
+                                        needle,
+                                        needleSize);
+        }
+
+    }
+
+    /**
+     * Counting length of null-terminated string<br>
+     * With AVX2 string is scanned by aligned blocks of 32 bytes, otherwise by aligned words of 8 bytes
+     * @param string Null-terminated string
+     * @return Length of string without null terminator
+     */
+    GSTD_INLINE auto Length(const char *string) GSTD_NOEXCEPT -> std::uint64_t {
+#if defined(GSTD_ARCH_X86_64)
+        if (CurrentSimdLevel() >= SimdLevel::AVX2) {
+            return detail::LengthAVX2(string);
+        }
+#endif
+
+        return detail::LengthScalar(string);
+    }
+
+}
+
+#endif //GSTD_STRINGSEARCH_H
@@ -0,0 +1,517 @@
+#ifndef GSTD_SYMBOLTABLE_H
+#define GSTD_SYMBOLTABLE_H
+
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <new>
+
+#include <gstd/Containers/StringRef.h>
+#include <gstd/Memory/Allocator.h>
+#include <gstd/Memory/RawPtr.h>
+
+namespace gstd {
+
+    /**
+     * Identifier of interned string. Identifiers of one table are equal only for equal strings,
+     * so comparison and hashing are single integer operations
+     */
+    class SymbolId {
+    public:
+
+        using ValueType = std::uint32_t;
+
+    public:
+
+        GSTD_CONSTEXPR GSTD_EXPLICIT SymbolId(ValueType value) GSTD_NOEXCEPT
+                : _value(value) {}
+
+    public:
+
+        GSTD_CONSTEXPR auto Value() const GSTD_NOEXCEPT -> ValueType {
+            return _value;
+        }
+
+        /**
+         * Hashing identifier by one multiplication
+         * @return Hash of identifier
+         */
+        GSTD_CONSTEXPR auto Hash() const GSTD_NOEXCEPT -> std::uint64_t {
+            return static_cast<std::uint64_t>(_value) * detail::HashSeedValue;
+        }
+
+    public:
+
+        GSTD_CONSTEXPR auto operator==(const SymbolId &symbolId) const GSTD_NOEXCEPT -> bool = default;
+
+        GSTD_CONSTEXPR auto operator<=>(const SymbolId &symbolId) const GSTD_NOEXCEPT -> std::strong_ordering = default;
+
+    private:
+
+        ValueType _value;
+    };
+
+    /**
+     * Strings, that are interned first, so their identifiers are known at compile time<br>
+     * Hashes are computed at compile time and strings are not copied into table, so seeds must outlive table
+     * @tparam SizeV Count of strings
+     */
+    template<std::uint64_t SizeV>
+    class SymbolSeeds {
+    public:
+
+        using SizeType = std::uint64_t;
+
+    public:
+
+        GSTD_CONSTEXPR SymbolSeeds(const StringRef (&strings)[SizeV])
+                : _strings(),
+                  _hashes() {
+            for (SizeType index = 0; index < SizeV; ++index) {
+                for (SizeType previous = 0; previous < index; ++previous) {
+                    if (_strings[previous] == strings[index]) {
+                        Panic("Duplicated symbol seed!");
+                    }
+                }
+
+                _strings[index] = strings[index];
+                _hashes[index] = gstd::Hash(strings[index]);
+            }
+        }
+
+    public:
+
+        GSTD_CONSTEXPR auto Size() const GSTD_NOEXCEPT -> SizeType {
+            return SizeV;
+        }
+
+        GSTD_CONSTEXPR auto String(SizeType index) const GSTD_NOEXCEPT -> StringRef {
+            return _strings[index];
+        }
+
+        GSTD_CONSTEXPR auto HashOf(SizeType index) const GSTD_NOEXCEPT -> std::uint64_t {
+            return _hashes[index];
+        }
+
+        /**
+         * Getting identifier of seed. In constant evaluation missing seed is compilation error
+         * @param string Seed string
+         * @return Identifier of seed in table, that is created from these seeds
+         */
+        GSTD_CONSTEXPR auto Id(StringRef string) const -> SymbolId {
+            for (SizeType index = 0; index < SizeV; ++index) {
+                if (_strings[index] == string) {
+                    return SymbolId(static_cast<SymbolId::ValueType>(index));
+                }
+            }
+
+            Panic("Symbol is not seeded!");
+        }
+
+    private:
+
+        StringRef _strings[SizeV];
+
+        std::uint64_t _hashes[SizeV];
+    };
+
+    template<std::uint64_t SizeV>
+    SymbolSeeds(const StringRef (&)[SizeV]) -> SymbolSeeds<SizeV>;
+
+    /**
+     * Table of interned strings. Strings are deduplicated and copied into arena, identifiers are dense 32-bit indices<br>
+     * Searching and getting strings by identifiers are lock-free, only insertion of new strings takes lock
+     */
+    class SymbolTable {
+    public:
+
+        using SizeType = std::uint64_t;
+
+    public:
+
+        SymbolTable(RawPtr<Allocator> allocator = DefaultAllocator())
+                : _allocator(allocator),
+                  _segments(),
+                  _index(nullptr),
+                  _size(0),
+                  _chunks(nullptr),
+                  _cursor(nullptr),
+                  _cursorEnd(nullptr),
+                  _mutex() {
+            _index.store(NewIndex(InitialIndexCapacityValue, nullptr),
+                         std::memory_order_release);
+        }
+
+        template<std::uint64_t SizeV>
+        SymbolTable(const SymbolSeeds<SizeV> &seeds,
+                    RawPtr<Allocator> allocator = DefaultAllocator())
+                : SymbolTable(allocator) {
+            for (SizeType index = 0; index < seeds.Size(); ++index) {
+                Insert(seeds.String(index),
+                       seeds.HashOf(index),
+                       false);
+            }
+        }
+
+        SymbolTable(const SymbolTable &symbolTable) = delete;
+
+        SymbolTable(SymbolTable &&symbolTable) = delete;
+
+    public:
+
+        ~SymbolTable() {
+            for (auto index = _index.load(std::memory_order_relaxed); index != nullptr; ) {
+                auto previous = index->Previous;
+
+                _allocator->Deallocate(index->Slots,
+                                       index->Capacity,
+                                       alignof(std::atomic<std::uint64_t>));
+                _allocator->Deallocate(index,
+                                       1,
+                                       alignof(Index));
+
+                index = previous;
+            }
+
+            for (SizeType segment = 0; segment < SegmentCountValue; ++segment) {
+                if (auto entries = _segments[segment].load(std::memory_order_relaxed); entries != nullptr) {
+                    _allocator->Deallocate(entries,
+                                           SegmentSize(segment),
+                                           alignof(Entry));
+                }
+            }
+
+            for (auto chunk = _chunks; chunk != nullptr; ) {
+                auto previous = chunk->Previous;
+
+                _allocator->Deallocate(reinterpret_cast<Byte *>(chunk),
+                                       chunk->Size,
+                                       alignof(Chunk));
+
+                chunk = previous;
+            }
+        }
+
+    public:
+
+        static auto New(RawPtr<Allocator> allocator = DefaultAllocator()) -> SymbolTable {
+            return SymbolTable(allocator);
+        }
+
+        template<std::uint64_t SizeV>
+        static auto New(const SymbolSeeds<SizeV> &seeds,
+                        RawPtr<Allocator> allocator = DefaultAllocator()) -> SymbolTable {
+            return SymbolTable(seeds,
+                               allocator);
+        }
+
+    public:
+
+        /**
+         * Interning string. Known strings are found without lock, new strings are copied into arena under lock
+         * @param string String
+         * @return Identifier of string
+         */
+        auto Intern(StringRef string) -> SymbolId {
+            auto hash = gstd::Hash(string);
+
+            if (auto id = Lookup(string, hash); id != NotFoundValue) {
+                return SymbolId(id);
+            }
+
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            if (auto id = Lookup(string, hash); id != NotFoundValue) {
+                return SymbolId(id);
+            }
+
+            return SymbolId(Insert(string,
+                                   hash,
+                                   true));
+        }
+
+        /**
+         * Finding identifier of string without interning
+         * @param string String
+         * @return Identifier of string or `None`, if string is not interned
+         */
+        auto Find(StringRef string) const -> Optional<SymbolId> {
+            auto id = Lookup(string,
+                             gstd::Hash(string));
+
+            if (id == NotFoundValue) {
+                return MakeNone();
+            }
+
+            return MakeSome(SymbolId(id));
+        }
+
+        /**
+         * Getting interned string. String is null-terminated and lives as long as table
+         * @param symbolId Identifier of string
+         * @return String
+         */
+        auto Get(SymbolId symbolId) const -> StringRef {
+            if (symbolId.Value() >= Size()) {
+                Panic("Unknown symbol identifier!");
+            }
+
+            auto &entry = EntryOf(symbolId.Value());
+
+            return StringRef(entry.Data,
+                             entry.Size);
+        }
+
+        auto Size() const GSTD_NOEXCEPT -> SizeType {
+            return _size.load(std::memory_order_acquire);
+        }
+
+    private:
+
+        struct Entry {
+
+            const char *Data;
+
+            SizeType Size;
+
+            std::uint64_t Hash;
+        };
+
+        struct Index {
+
+            std::atomic<std::uint64_t> *Slots;
+
+            SizeType Capacity;
+
+            Index *Previous;
+        };
+
+        struct Chunk {
+
+            Chunk *Previous;
+
+            SizeType Size;
+        };
+
+    private:
+
+        /**
+         * Count of entries in first segment. Each next segment is twice larger, so entries are never moved
+         */
+        static constexpr SizeType FirstSegmentValue = 256;
+
+        static constexpr SizeType SegmentCountValue = 25;
+
+        static constexpr SizeType InitialIndexCapacityValue = 512;
+
+        static constexpr SizeType ChunkSizeValue = 64 * 1024;
+
+        static constexpr SymbolId::ValueType NotFoundValue = ~static_cast<SymbolId::ValueType>(0);
+
+        static constexpr SizeType MaxSizeValue = NotFoundValue - 1;
+
+    private:
+
+        static auto SegmentSize(SizeType segment) GSTD_NOEXCEPT -> SizeType {
+            return FirstSegmentValue << segment;
+        }
+
+        auto EntryOf(SymbolId::ValueType id) const GSTD_NOEXCEPT -> const Entry & {
+            auto segment = static_cast<SizeType>(std::bit_width(id / FirstSegmentValue + 1)) - 1;
+            auto offset = id - FirstSegmentValue * ((static_cast<SizeType>(1) << segment) - 1);
+
+            return _segments[segment].load(std::memory_order_acquire)[offset];
+        }
+
+        /**
+         * Probing index without lock. Slot stores high half of hash and identifier plus one, zero slot is empty
+         */
+        auto Lookup(StringRef string,
+                    std::uint64_t hash) const GSTD_NOEXCEPT -> SymbolId::ValueType {
+            auto index = _index.load(std::memory_order_acquire);
+            auto mask = index->Capacity - 1;
+            auto tag = hash >> 32;
+
+            for (auto slot = hash & mask; ; slot = (slot + 1) & mask) {
+                auto value = index->Slots[slot].load(std::memory_order_acquire);
+
+                if (value == 0) {
+                    return NotFoundValue;
+                }
+
+                if ((value >> 32) != tag) {
+                    continue;
+                }
+
+                auto id = static_cast<SymbolId::ValueType>(value) - 1;
+                auto &entry = EntryOf(id);
+
+                if (entry.Hash == hash && StringRef(entry.Data, entry.Size) == string) {
+                    return id;
+                }
+            }
+        }
+
+        /**
+         * Inserting new string. Must be called under lock
+         */
+        auto Insert(StringRef string,
+                    std::uint64_t hash,
+                    bool copy) -> SymbolId::ValueType {
+            auto id = _size.load(std::memory_order_relaxed);
+
+            if (id >= MaxSizeValue) {
+                Panic("Too many symbols!");
+            }
+
+            auto index = _index.load(std::memory_order_relaxed);
+
+            if ((id + 1) * 2 > index->Capacity) {
+                index = NewIndex(index->Capacity * 2,
+                                 index);
+
+                for (SymbolId::ValueType previous = 0; previous < id; ++previous) {
+                    InsertSlot(index,
+                               EntryOf(previous).Hash,
+                               previous);
+                }
+
+                _index.store(index,
+                             std::memory_order_release);
+            }
+
+            auto segment = static_cast<SizeType>(std::bit_width(id / FirstSegmentValue + 1)) - 1;
+            auto entries = _segments[segment].load(std::memory_order_relaxed);
+
+            if (entries == nullptr) {
+                entries = _allocator->template Allocate<Entry>(SegmentSize(segment),
+                                                               alignof(Entry));
+
+                _segments[segment].store(entries,
+                                         std::memory_order_release);
+            }
+
+            entries[id - FirstSegmentValue * ((static_cast<SizeType>(1) << segment) - 1)] = Entry {
+                copy ? CopyToArena(string) : string.Data(),
+                string.Size(),
+                hash
+            };
+
+            // Size is published before slot, so identifier, that lock-free `Lookup` finds, is already valid for `Get`
+            _size.store(id + 1,
+                        std::memory_order_release);
+
+            InsertSlot(index,
+                       hash,
+                       static_cast<SymbolId::ValueType>(id));
+
+            return static_cast<SymbolId::ValueType>(id);
+        }
+
+        static auto InsertSlot(Index *index,
+                               std::uint64_t hash,
+                               SymbolId::ValueType id) GSTD_NOEXCEPT -> void {
+            auto mask = index->Capacity - 1;
+            auto slot = hash & mask;
+
+            for (; index->Slots[slot].load(std::memory_order_relaxed) != 0; slot = (slot + 1) & mask) {}
+
+            index->Slots[slot].store((hash >> 32) << 32 | (static_cast<std::uint64_t>(id) + 1),
+                                     std::memory_order_release);
+        }
+
+        /**
+         * Creating empty index. Previous index is not freed, because lock-free readers may still probe it
+         */
+        auto NewIndex(SizeType capacity,
+                      Index *previous) -> Index * {
+            auto slots = _allocator->template Allocate<std::atomic<std::uint64_t>>(capacity,
+                                                                                   alignof(std::atomic<std::uint64_t>));
+
+            for (SizeType slot = 0; slot < capacity; ++slot) {
+                new (slots + slot) std::atomic<std::uint64_t>(0);
+            }
+
+            return new (_allocator->template Allocate<Index>(1, alignof(Index))) Index {
+                slots,
+                capacity,
+                previous
+            };
+        }
+
+        /**
+         * Copying string into arena with null terminator. Large strings get own chunks
+         */
+        auto CopyToArena(StringRef string) -> const char * {
+            auto size = string.Size() + 1;
+            char *data;
+
+            if (size <= static_cast<SizeType>(_cursorEnd - _cursor)) {
+                data = _cursor;
+                _cursor += size;
+            } else if (size > ChunkSizeValue / 4) {
+                data = NewChunk(size);
+            } else {
+                data = NewChunk(ChunkSizeValue);
+
+                _cursor = data + size;
+                _cursorEnd = data + ChunkSizeValue;
+            }
+
+            std::memcpy(data,
+                        string.Data(),
+                        string.Size());
+
+            data[string.Size()] = '\0';
+
+            return data;
+        }
+
+        auto NewChunk(SizeType size) -> char * {
+            auto bytes = _allocator->template Allocate<Byte>(sizeof(Chunk) + size,
+                                                             alignof(Chunk));
+
+            _chunks = new (bytes) Chunk {
+                _chunks,
+                sizeof(Chunk) + size
+            };
+
+            return reinterpret_cast<char *>(bytes + sizeof(Chunk));
+        }
+
+    private:
+
+        RawPtr<Allocator> _allocator;
+
+        std::atomic<Entry *> _segments[SegmentCountValue];
+
+        std::atomic<Index *> _index;
+
+        std::atomic<SizeType> _size;
+
+        Chunk *_chunks;
+
+        char *_cursor;
+
+        char *_cursorEnd;
+
+        std::mutex _mutex;
+    };
+
+}
+
+namespace std {
+
+    template<>
+    struct hash<gstd::SymbolId> {
+
+        auto operator()(const gstd::SymbolId &symbolId) const noexcept -> std::size_t {
+            return static_cast<std::size_t>(symbolId.Hash());
+        }
+    };
+
+}
+
+#endif //GSTD_SYMBOLTABLE_H
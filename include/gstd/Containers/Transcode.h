@@ -0,0 +1,506 @@
+#ifndef GSTD_TRANSCODE_H
+#define GSTD_TRANSCODE_H
+
+#include <gstd/Containers/Utf8.h>
+#include <gstd/Containers/Vector.h>
+
+namespace gstd {
+
+    namespace detail {
+
+        /**
+         * Count of code units, that checked at once by ASCII fast paths of transcoding
+         */
+        inline constexpr std::uint64_t TranscodeBlockValue = 16;
+
+        GSTD_CONSTEXPR auto IsHighSurrogate(std::uint32_t unit) GSTD_NOEXCEPT -> bool {
+            return unit >= 0xd800 && unit <= 0xdbff;
+        }
+
+        GSTD_CONSTEXPR auto IsLowSurrogate(std::uint32_t unit) GSTD_NOEXCEPT -> bool {
+            return unit >= 0xdc00 && unit <= 0xdfff;
+        }
+
+        /**
+         * Checking, if block of `TranscodeBlockValue` code units is ASCII, without branches
+         */
+        template<typename UnitT>
+        GSTD_FORCEINLINE auto IsAsciiBlock(const UnitT *data) GSTD_NOEXCEPT -> bool {
+            std::uint32_t bits = 0;
+
+            for (std::uint64_t index = 0; index < TranscodeBlockValue; ++index) {
+                bits |= static_cast<std::uint32_t>(data[index]);
+            }
+
+            return bits < 0x80;
+        }
+
+        /**
+         * Checking, if block of `TranscodeBlockValue` UTF-16 code units has no surrogates
+         */
+        template<typename UnitT>
+        GSTD_FORCEINLINE auto IsBmpBlock(const UnitT *data) GSTD_NOEXCEPT -> bool {
+            std::uint32_t surrogates = 0;
+
+            for (std::uint64_t index = 0; index < TranscodeBlockValue; ++index) {
+                surrogates |= (static_cast<std::uint32_t>(data[index]) & 0xf800) == 0xd800 ? 1 : 0;
+            }
+
+            return surrogates == 0;
+        }
+
+        /**
+         * Encoding code point of Basic Multilingual Plane, that is not surrogate
+         */
+        GSTD_FORCEINLINE auto EncodeBmp(std::uint32_t unit,
+                                        char *output) GSTD_NOEXCEPT -> std::uint64_t {
+            if (unit < 0x80) {
+                output[0] = static_cast<char>(unit);
+
+                return 1;
+            }
+
+            if (unit < 0x800) {
+                output[0] = static_cast<char>(0xc0 | (unit >> 6));
+                output[1] = static_cast<char>(0x80 | (unit & 0x3f));
+
+                return 2;
+            }
+
+            output[0] = static_cast<char>(0xe0 | (unit >> 12));
+            output[1] = static_cast<char>(0x80 | ((unit >> 6) & 0x3f));
+            output[2] = static_cast<char>(0x80 | (unit & 0x3f));
+
+            return 3;
+        }
+
+        template<typename OutputT>
+        GSTD_CONSTEXPR auto CheckOutputSize(const Span<OutputT> &output,
+                                            std::uint64_t size) -> void {
+            if (output.Size() < size) {
+                Panic("Output is too small for transcoded string!");
+            }
+        }
+
+    }
+
+    namespace detail {
+
+        /**
+         * Getting size of UTF-8 encoding of UTF-16 code units. Code units are `char16_t` or 2-byte `wchar_t`
+         */
+        template<typename UnitT>
+        GSTD_INLINE auto Utf8SizeOfUtf16(const UnitT *data,
+                                         std::uint64_t size) GSTD_NOEXCEPT -> std::uint64_t {
+            return SimdDispatch([data, size] () -> std::uint64_t {
+                std::uint64_t lanes[SimdLanesValue] = {};
+                std::uint64_t index = 0;
+
+                auto unitSize = [data, size] (std::uint64_t index) -> std::uint64_t {
+                    auto unit = static_cast<std::uint32_t>(data[index]);
+                    auto next = index + 1 < size ? static_cast<std::uint32_t>(data[index + 1]) : 0;
+                    auto pair = IsHighSurrogate(unit) && IsLowSurrogate(next);
+
+                    return 1 + (unit >= 0x80 ? 1 : 0) + (unit >= 0x800 ? 1 : 0) - (pair ? 2 : 0);
+                };
+
+                for (; index + SimdLanesValue <= size; index += SimdLanesValue) {
+                    for (std::uint64_t lane = 0; lane < SimdLanesValue; ++lane) {
+                        lanes[lane] += unitSize(index + lane);
+                    }
+                }
+
+                for (std::uint64_t lane = 0; index < size; ++index, ++lane) {
+                    lanes[lane] += unitSize(index);
+                }
+
+                return ReduceLanes(lanes,
+                                   [] (std::uint64_t first,
+                                       std::uint64_t second) {
+                    return first + second;
+                });
+            });
+        }
+
+        /**
+         * Getting size of UTF-8 encoding of UTF-32 code units. Code units are `char32_t` or 4-byte `wchar_t`
+         */
+        template<typename UnitT>
+        GSTD_INLINE auto Utf8SizeOfUtf32(const UnitT *data,
+                                         std::uint64_t size) GSTD_NOEXCEPT -> std::uint64_t {
+            return SimdDispatch([data, size] () -> std::uint64_t {
+                std::uint64_t lanes[SimdLanesValue] = {};
+                std::uint64_t index = 0;
+
+                auto unitSize = [data] (std::uint64_t index) -> std::uint64_t {
+                    auto unit = static_cast<std::uint32_t>(data[index]);
+                    auto valid = unit < 0xd800 || (unit > 0xdfff && unit <= 0x10ffff);
+
+                    return valid ? 1 + (unit >= 0x80 ? 1 : 0) + (unit >= 0x800 ? 1 : 0) + (unit >= 0x10000 ? 1 : 0) : 3;
+                };
+
+                for (; index + SimdLanesValue <= size; index += SimdLanesValue) {
+                    for (std::uint64_t lane = 0; lane < SimdLanesValue; ++lane) {
+                        lanes[lane] += unitSize(index + lane);
+                    }
+                }
+
+                for (std::uint64_t lane = 0; index < size; ++index, ++lane) {
+                    lanes[lane] += unitSize(index);
+                }
+
+                return ReduceLanes(lanes,
+                                   [] (std::uint64_t first,
+                                       std::uint64_t second) {
+                    return first + second;
+                });
+            });
+        }
+
+    }
+
+    /**
+     * Getting size of UTF-8 encoding of UTF-16 string. Unpaired surrogates are counted as `ReplacementCodePoint`
+     * @param input UTF-16 string
+     * @return Count of UTF-8 bytes
+     */
+    GSTD_INLINE auto Utf8SizeOfUtf16(Span<const char16_t> input) GSTD_NOEXCEPT -> std::uint64_t {
+        return detail::Utf8SizeOfUtf16(input.Data(),
+                                       input.Size());
+    }
+
+    /**
+     * Getting size of UTF-8 encoding of UTF-32 string. Invalid code points are counted as `ReplacementCodePoint`
+     * @param input UTF-32 string
+     * @return Count of UTF-8 bytes
+     */
+    GSTD_INLINE auto Utf8SizeOfUtf32(Span<const char32_t> input) GSTD_NOEXCEPT -> std::uint64_t {
+        return detail::Utf8SizeOfUtf32(input.Data(),
+                                       input.Size());
+    }
+
+    namespace detail {
+
+        /**
+         * Converting UTF-16 code units to UTF-8. Code units are `char16_t` or 2-byte `wchar_t`
+         */
+        template<typename UnitT>
+        GSTD_INLINE auto Utf16ToUtf8(const UnitT *data,
+                                     std::uint64_t size,
+                                     char *result) GSTD_NOEXCEPT -> std::uint64_t {
+            return SimdDispatch([data, size, result] () -> std::uint64_t {
+                std::uint64_t index = 0;
+                std::uint64_t written = 0;
+
+                while (index < size) {
+                    if (index + TranscodeBlockValue <= size) {
+                        if (IsAsciiBlock(data + index)) {
+                            for (std::uint64_t offset = 0; offset < TranscodeBlockValue; ++offset) {
+                                result[written + offset] = static_cast<char>(data[index + offset]);
+                            }
+
+                            index += TranscodeBlockValue;
+                            written += TranscodeBlockValue;
+
+                            continue;
+                        }
+
+                        if (IsBmpBlock(data + index)) {
+                            for (std::uint64_t offset = 0; offset < TranscodeBlockValue; ++offset) {
+                                written += EncodeBmp(data[index + offset],
+                                                     result + written);
+                            }
+
+                            index += TranscodeBlockValue;
+
+                            continue;
+                        }
+                    }
+
+                    auto unit = static_cast<std::uint32_t>(data[index++]);
+
+                    if ((unit & 0xf800) != 0xd800) {
+                        written += EncodeBmp(unit,
+                                             result + written);
+
+                        continue;
+                    }
+
+                    CodePoint codePoint = ReplacementCodePoint;
+
+                    if (IsHighSurrogate(unit) && index < size && IsLowSurrogate(data[index])) {
+                        codePoint = 0x10000 + ((unit - 0xd800) << 10) + (static_cast<std::uint32_t>(data[index++]) - 0xdc00);
+                    }
+
+                    written += Symbol(codePoint).EncodeUtf8(result + written);
+                }
+
+                return written;
+            });
+        }
+
+        /**
+         * Converting UTF-32 code units to UTF-8. Code units are `char32_t` or 4-byte `wchar_t`
+         */
+        template<typename UnitT>
+        GSTD_INLINE auto Utf32ToUtf8(const UnitT *data,
+                                     std::uint64_t size,
+                                     char *result) GSTD_NOEXCEPT -> std::uint64_t {
+            return SimdDispatch([data, size, result] () -> std::uint64_t {
+                std::uint64_t index = 0;
+                std::uint64_t written = 0;
+
+                while (index < size) {
+                    if (index + TranscodeBlockValue <= size && IsAsciiBlock(data + index)) {
+                        for (std::uint64_t offset = 0; offset < TranscodeBlockValue; ++offset) {
+                            result[written + offset] = static_cast<char>(data[index + offset]);
+                        }
+
+                        index += TranscodeBlockValue;
+                        written += TranscodeBlockValue;
+
+                        continue;
+                    }
+
+                    Symbol symbol(static_cast<CodePoint>(data[index++]));
+
+                    written += (symbol.IsValid() ? symbol : Symbol(ReplacementCodePoint)).EncodeUtf8(result + written);
+                }
+
+                return written;
+            });
+        }
+
+    }
+
+    /**
+     * Converting UTF-16 string to UTF-8. Unpaired surrogates are replaced by `ReplacementCodePoint`<br>
+     * Blocks of ASCII are narrowed and blocks without surrogates are encoded without pairing checks
+     * @param input UTF-16 string
+     * @param output Output, must have at least `Utf8SizeOfUtf16(input)` bytes
+     * @return Count of written bytes
+     */
+    GSTD_INLINE auto ConvertUtf16ToUtf8(Span<const char16_t> input,
+                                        Span<char> output) -> std::uint64_t {
+        if (output.Size() / 3 < input.Size()) {
+            detail::CheckOutputSize(output,
+                                    Utf8SizeOfUtf16(input));
+        }
+
+        return detail::Utf16ToUtf8(input.Data(),
+                                   input.Size(),
+                                   output.Data());
+    }
+
+    /**
+     * Converting UTF-32 string to UTF-8. Invalid code points are replaced by `ReplacementCodePoint`
+     * @param input UTF-32 string
+     * @param output Output, must have at least `Utf8SizeOfUtf32(input)` bytes
+     * @return Count of written bytes
+     */
+    GSTD_INLINE auto ConvertUtf32ToUtf8(Span<const char32_t> input,
+                                        Span<char> output) -> std::uint64_t {
+        if (output.Size() / 4 < input.Size()) {
+            detail::CheckOutputSize(output,
+                                    Utf8SizeOfUtf32(input));
+        }
+
+        return detail::Utf32ToUtf8(input.Data(),
+                                   input.Size(),
+                                   output.Data());
+    }
+
+    namespace detail {
+
+        /**
+         * Decoding UTF-8 string and passing code points to consumer. ASCII runs are passed without decoding
+         */
+        template<typename ConsumerT>
+        GSTD_FORCEINLINE auto DecodeUtf8String(StringRef input,
+                                               const ConsumerT &consumer) -> void {
+            auto data = input.Data();
+            auto end = data + input.Size();
+
+            while (data < end) {
+                auto ascii = AsciiPrefix(data,
+                                         static_cast<std::uint64_t>(end - data),
+                                         Utf8AsciiRunValue);
+
+                for (std::uint64_t index = 0; index < ascii; ++index) {
+                    consumer(static_cast<CodePoint>(data[index]));
+                }
+
+                data += ascii;
+
+                if (ascii == Utf8AsciiRunValue || data == end) {
+                    continue;
+                }
+
+                auto decoded = DecodeUtf8(data,
+                                          end);
+
+                consumer(decoded.First());
+
+                data += decoded.Second();
+            }
+        }
+
+    }
+
+    /**
+     * Getting size of UTF-16 encoding of UTF-8 string. Invalid sequences are counted as `ReplacementCodePoint`
+     * @param input UTF-8 string
+     * @return Count of UTF-16 code units
+     */
+    GSTD_INLINE auto Utf16SizeOfUtf8(StringRef input) -> std::uint64_t {
+        if (IsValidUtf8(input)) {
+            auto data = input.Data();
+            auto size = input.Size();
+
+            return detail::SimdDispatch([data, size] () -> std::uint64_t {
+                std::uint64_t count = 0;
+
+                for (std::uint64_t index = 0; index < size; ++index) {
+                    auto byte = static_cast<std::uint8_t>(data[index]);
+
+                    count += (static_cast<std::int8_t>(byte) > -65 ? 1 : 0) + (byte >= 0xf0 ? 1 : 0);
+                }
+
+                return count;
+            });
+        }
+
+        std::uint64_t count = 0;
+
+        detail::DecodeUtf8String(input,
+                                 [&count] (CodePoint codePoint) {
+            count += codePoint >= 0x10000 ? 2 : 1;
+        });
+
+        return count;
+    }
+
+    /**
+     * Getting size of UTF-32 encoding of UTF-8 string. Invalid sequences are counted as `ReplacementCodePoint`
+     * @param input UTF-8 string
+     * @return Count of UTF-32 code units
+     */
+    GSTD_INLINE auto Utf32SizeOfUtf8(StringRef input) -> std::uint64_t {
+        if (IsValidUtf8(input)) {
+            return CountCodePoints(input);
+        }
+
+        std::uint64_t count = 0;
+
+        detail::DecodeUtf8String(input,
+                                 [&count] (CodePoint) {
+            ++count;
+        });
+
+        return count;
+    }
+
+    namespace detail {
+
+        GSTD_INLINE auto Utf8ToUtf16(StringRef input,
+                                     char16_t *result) -> std::uint64_t {
+            std::uint64_t written = 0;
+
+            DecodeUtf8String(input,
+                             [result, &written] (CodePoint codePoint) {
+                if (codePoint < 0x10000) {
+                    result[written++] = static_cast<char16_t>(codePoint);
+                } else {
+                    codePoint -= 0x10000;
+
+                    result[written++] = static_cast<char16_t>(0xd800 + (codePoint >> 10));
+                    result[written++] = static_cast<char16_t>(0xdc00 + (codePoint & 0x3ff));
+                }
+            });
+
+            return written;
+        }
+
+        GSTD_INLINE auto Utf8ToUtf32(StringRef input,
+                                     char32_t *result) -> std::uint64_t {
+            std::uint64_t written = 0;
+
+            DecodeUtf8String(input,
+                             [result, &written] (CodePoint codePoint) {
+                result[written++] = static_cast<char32_t>(codePoint);
+            });
+
+            return written;
+        }
+
+    }
+
+    /**
+     * Converting UTF-8 string to UTF-16. Invalid sequences are replaced by `ReplacementCodePoint`
+     * @param input UTF-8 string
+     * @param output Output, must have at least `Utf16SizeOfUtf8(input)` code units
+     * @return Count of written code units
+     */
+    GSTD_INLINE auto ConvertUtf8ToUtf16(StringRef input,
+                                        Span<char16_t> output) -> std::uint64_t {
+        if (output.Size() < input.Size()) {
+            detail::CheckOutputSize(output,
+                                    Utf16SizeOfUtf8(input));
+        }
+
+        return detail::Utf8ToUtf16(input,
+                                   output.Data());
+    }
+
+    /**
+     * Converting UTF-8 string to UTF-32. Invalid sequences are replaced by `ReplacementCodePoint`
+     * @param input UTF-8 string
+     * @param output Output, must have at least `Utf32SizeOfUtf8(input)` code units
+     * @return Count of written code units
+     */
+    GSTD_INLINE auto ConvertUtf8ToUtf32(StringRef input,
+                                        Span<char32_t> output) -> std::uint64_t {
+        if (output.Size() < input.Size()) {
+            detail::CheckOutputSize(output,
+                                    Utf32SizeOfUtf8(input));
+        }
+
+        return detail::Utf8ToUtf32(input,
+                                   output.Data());
+    }
+
+    /**
+     * Converting UTF-8 string to UTF-16 with one exact-size allocation
+     * @param input UTF-8 string
+     * @return UTF-16 string
+     */
+    GSTD_INLINE auto ToUtf16(StringRef input) -> Vector<char16_t> {
+        Vector<char16_t> output;
+
+        output.ResizeUninitialized(Utf16SizeOfUtf8(input));
+
+        detail::Utf8ToUtf16(input,
+                            output.Data());
+
+        return output;
+    }
+
+    /**
+     * Converting UTF-8 string to UTF-32 with one exact-size allocation
+     * @param input UTF-8 string
+     * @return UTF-32 string
+     */
+    GSTD_INLINE auto ToUtf32(StringRef input) -> Vector<char32_t> {
+        Vector<char32_t> output;
+
+        output.ResizeUninitialized(Utf32SizeOfUtf8(input));
+
+        detail::Utf8ToUtf32(input,
+                            output.Data());
+
+        return output;
+    }
+
+}
+
+#endif //GSTD_TRANSCODE_H
@@ -1,9 +1,16 @@
 #ifndef GSTD_TREE_H
 #define GSTD_TREE_H
 
+#include <bit>
+#include <functional>
+#include <memory>
+#include <utility>
+
 #include <gstd/Containers/Node.h>
+#include <gstd/Containers/Span.h>
 
 #include <gstd/Memory/Memory.h>
+#include <gstd/Type/Optional.h>
 
 namespace gstd {
 
@@ -21,18 +28,28 @@ namespace gstd {
     public:
 
         GSTD_CONSTEXPR GSTD_EXPLICIT BinarySearchTreeNode(ValueType value)
-                : BaseNode<ValueType>(std::move(value)) {}
+                : BaseNode<ValueType>(std::move(value)),
+                  _left(nullptr),
+                  _right(nullptr) {}
 
     public:
 
-        GSTD_CONSTEXPR auto Left() -> BinarySearchTreeNode * {
+        GSTD_CONSTEXPR auto Left() GSTD_NOEXCEPT -> BinarySearchTreeNode * {
             return _left;
         }
 
-        GSTD_CONSTEXPR auto Right() -> BinarySearchTreeNode * {
+        GSTD_CONSTEXPR auto Right() GSTD_NOEXCEPT -> BinarySearchTreeNode * {
             return _right;
         }
 
+        GSTD_CONSTEXPR auto SetLeft(BinarySearchTreeNode *node) GSTD_NOEXCEPT -> void {
+            _left = node;
+        }
+
+        GSTD_CONSTEXPR auto SetRight(BinarySearchTreeNode *node) GSTD_NOEXCEPT -> void {
+            _right = node;
+        }
+
     private:
 
         BinarySearchTreeNode *_left;
@@ -44,41 +61,405 @@ namespace gstd {
     class BinarySearchTree : public Tree<ValueT> {
     public:
 
-    using ValueType = ValueT;
+        using ValueType = ValueT;
 
-    using NodeType = BinarySearchTreeNode<ValueType>;
+        using NodeType = BinarySearchTreeNode<ValueType>;
 
     public:
 
-    GSTD_CONSTEXPR BinarySearchTree() = default;
+        GSTD_EXPLICIT BinarySearchTree(RawPtr<Allocator> allocator = DefaultAllocator())
+                : _root(nullptr),
+                  _allocator(allocator) {}
 
-    GSTD_CONSTEXPR BinarySearchTree(Allocator<NodeType> *allocator)
-    : _allocator(allocator) {}
+        BinarySearchTree(const BinarySearchTree &tree) = delete;
 
     public:
 
-    GSTD_CONSTEXPR auto Insert(const ValueType &value,
-                               const NodeType *node) -> NodeType * {
-        if (!node) {
-            node = _allocator(NodeType::New(value,
-nullptr,
-    nullptr));
-        } else if (value < node->Value()) {
-            node->Left() = Insert(value,
-            node->Left());
-        } else {
-            node->Right() = Insert(value,
-                                   node->Right());
+        ~BinarySearchTree() {
+            Clear();
+        }
+
+    public:
+
+        /**
+         * Inserting value. Equal values are inserted to right subtree
+         * @param value Value
+         * @return Node of inserted value
+         */
+        auto Insert(const ValueType &value) -> NodeType * {
+            auto node = _allocator->template Allocate<NodeType>();
+
+            std::construct_at(node,
+                              value);
+
+            if (!_root.HasValue()) {
+                _root = node;
+
+                return node;
+            }
+
+            for (auto parent = _root.Value();;) {
+                if (value < parent->Value().Get()) {
+                    if (parent->Left() == nullptr) {
+                        parent->SetLeft(node);
+
+                        return node;
+                    }
+
+                    parent = parent->Left();
+                } else {
+                    if (parent->Right() == nullptr) {
+                        parent->SetRight(node);
+
+                        return node;
+                    }
+
+                    parent = parent->Right();
+                }
+            }
         }
 
-    return node;
-    }
+        /**
+         * Destroying all nodes. Left children are rotated up, so degenerate trees don`t need deep recursion
+         */
+        auto Clear() -> void {
+            auto node = _root.Value();
+
+            while (node != nullptr) {
+                if (auto left = node->Left(); left != nullptr) {
+                    node->SetLeft(left->Right());
+                    left->SetRight(node);
+                    node = left;
+                } else {
+                    auto right = node->Right();
+
+                    std::destroy_at(node);
+                    _allocator->Deallocate(node);
+
+                    node = right;
+                }
+            }
+
+            _root = nullptr;
+        }
+
+    public:
+
+        auto operator=(const BinarySearchTree &tree) -> BinarySearchTree & = delete;
 
     private:
 
         RawPtr<NodeType> _root;
 
-        RawPtr<Allocator<NodeType>> _allocator;
+        RawPtr<Allocator> _allocator;
+    };
+
+    /**
+     * Read-only search tree, built from sorted elements and stored in Eytzinger (BFS) order without pointers<br>
+     * Top levels of tree share few cache lines and descendants of node are prefetched several levels ahead,
+     * so search is faster than binary search over sorted array and pointer-based trees
+     * @tparam ValueT Value type
+     * @tparam CompareT Comparator type
+     */
+    template<typename ValueT,
+             typename CompareT = std::less<>>
+    class StaticSearchTree : public Tree<ValueT> {
+    public:
+
+        using ValueType = ValueT;
+
+        using CompareType = CompareT;
+
+        using SizeType = std::uint64_t;
+
+    public:
+
+        /**
+         * Count of searches, that interleaved in batched search
+         */
+        static constexpr SizeType BatchValue = 16;
+
+    private:
+
+        static constexpr SizeType CacheLineValue = 64;
+
+        /**
+         * Multiplier of node index for prefetching: descendants of node `k` after `log2(D)` levels are `k * D ... k * D + D - 1`.
+         * Nodes are stored 1-based in buffer, that is aligned to cache line, so for sizes of elements, that are powers of two,
+         * these descendants start at boundary of cache line and fill it
+         */
+        static constexpr SizeType PrefetchDistanceValue = sizeof(ValueType) >= CacheLineValue ? 1 : std::bit_floor(CacheLineValue / sizeof(ValueType));
+
+    public:
+
+        /**
+         * Main constructor for `StaticSearchTree`
+         * @param sorted Sorted elements
+         * @param compare Comparator, that used for sorting elements
+         * @param allocator Allocator
+         */
+        GSTD_EXPLICIT StaticSearchTree(Span<const ValueType> sorted,
+                                       CompareType compare = CompareType(),
+                                       RawPtr<Allocator> allocator = DefaultAllocator())
+                : _allocator(allocator),
+                  _values(_allocator->template Allocate<ValueType>(sorted.Size() + 1,
+                                                                   CacheLineValue)),
+                  _size(sorted.Size()),
+                  _compare(std::move(compare)) {
+            std::uninitialized_default_construct_n(_values,
+                                                   _size + 1);
+
+            SizeType position = 0;
+
+            Build(sorted.Data(),
+                  position,
+                  1);
+        }
+
+        StaticSearchTree(const StaticSearchTree &tree) = delete;
+
+        StaticSearchTree(StaticSearchTree &&tree) GSTD_NOEXCEPT
+                : _allocator(tree._allocator),
+                  _values(std::exchange(tree._values, nullptr)),
+                  _size(std::exchange(tree._size, 0)),
+                  _compare(std::move(tree._compare)) {}
+
+    public:
+
+        ~StaticSearchTree() {
+            Release();
+        }
+
+    public:
+
+        /**
+         * Building tree from sorted elements
+         * @param sorted Sorted elements
+         * @param compare Comparator, that used for sorting elements
+         * @return Tree
+         */
+        static auto New(Span<const ValueType> sorted,
+                        CompareType compare = CompareType()) -> StaticSearchTree {
+            return StaticSearchTree(sorted,
+                                    std::move(compare));
+        }
+
+    public:
+
+        /**
+         * Finding element, that equal to key
+         * @tparam KeyT Key type
+         * @param key Key
+         * @return Element or none
+         */
+        template<typename KeyT>
+        auto Find(const KeyT &key) const -> Optional<Ref<const ValueType>> {
+            auto node = Descend(key);
+
+            if (node == 0 || _compare(key, _values[node])) {
+                return MakeNone();
+            }
+
+            return MakeSome(MakeCRef(_values[node]));
+        }
+
+        /**
+         * Finding first element, that is not less than key
+         * @tparam KeyT Key type
+         * @param key Key
+         * @return Element or none, if all elements are less than key
+         */
+        template<typename KeyT>
+        auto LowerBound(const KeyT &key) const -> Optional<Ref<const ValueType>> {
+            auto node = Descend(key);
+
+            if (node == 0) {
+                return MakeNone();
+            }
+
+            return MakeSome(MakeCRef(_values[node]));
+        }
+
+        /**
+         * Finding elements, that equal to keys. Searches are processed in groups of `BatchValue` in lockstep,
+         * so memory accesses of independent searches overlap
+         * @tparam KeyT Key type
+         * @param keys Keys
+         * @param output Output elements, must have size of keys
+         */
+        template<typename KeyT>
+        auto FindMany(Span<const KeyT> keys,
+                      Span<Optional<Ref<const ValueType>>> output) const -> void {
+            DescendMany(keys,
+                        output,
+                        true);
+        }
+
+        /**
+         * Finding lower bounds of many keys in lockstep
+         * @tparam KeyT Key type
+         * @param keys Keys
+         * @param output Output elements, must have size of keys
+         */
+        template<typename KeyT>
+        auto LowerBoundMany(Span<const KeyT> keys,
+                            Span<Optional<Ref<const ValueType>>> output) const -> void {
+            DescendMany(keys,
+                        output,
+                        false);
+        }
+
+        GSTD_CONSTEXPR auto Size() const GSTD_NOEXCEPT -> SizeType {
+            return _size;
+        }
+
+        GSTD_CONSTEXPR auto Empty() const GSTD_NOEXCEPT -> bool {
+            return _size == 0;
+        }
+
+    public:
+
+        auto operator=(const StaticSearchTree &tree) -> StaticSearchTree & = delete;
+
+        auto operator=(StaticSearchTree &&tree) GSTD_NOEXCEPT -> StaticSearchTree & {
+            if (this != &tree) {
+                Release();
+
+                _allocator = tree._allocator;
+                _values = std::exchange(tree._values, nullptr);
+                _size = std::exchange(tree._size, 0);
+                _compare = std::move(tree._compare);
+            }
+
+            return *this;
+        }
+
+    private:
+
+        auto Release() -> void {
+            if (_values == nullptr) {
+                return;
+            }
+
+            std::destroy_n(_values,
+                           _size + 1);
+
+            _allocator->Deallocate(_values,
+                                   _size + 1,
+                                   CacheLineValue);
+
+            _values = nullptr;
+        }
+
+        /**
+         * Filling nodes of subtree with root `node` by in-order traversal
+         */
+        auto Build(const ValueType *sorted,
+                   SizeType &position,
+                   SizeType node) -> void {
+            if (node > _size) {
+                return;
+            }
+
+            Build(sorted,
+                  position,
+                  2 * node);
+
+            _values[node] = sorted[position++];
+
+            Build(sorted,
+                  position,
+                  2 * node + 1);
+        }
+
+        /**
+         * Restoring node, where search turned left last time, from path of search
+         * @param node Node after leaving tree
+         * @return Node of lower bound (1-based) or zero
+         */
+        static GSTD_CONSTEXPR auto Resolve(SizeType node) GSTD_NOEXCEPT -> SizeType {
+            return node >> (std::countr_one(node) + 1);
+        }
+
+        template<typename KeyT>
+        auto Descend(const KeyT &key) const -> SizeType {
+            auto data = _values;
+            auto size = _size;
+            SizeType node = 1;
+
+            while (node <= size) {
+                if (node * PrefetchDistanceValue <= size) {
+                    GSTD_PREFETCH(data + node * PrefetchDistanceValue);
+                }
+
+                node = 2 * node + (_compare(data[node], key) ? 1 : 0);
+            }
+
+            return Resolve(node);
+        }
+
+        template<typename KeyT>
+        auto DescendMany(Span<const KeyT> keys,
+                         Span<Optional<Ref<const ValueType>>> output,
+                         bool exact) const -> void {
+            if (output.Size() != keys.Size()) {
+                Panic("Sizes of keys and output must be equal!");
+            }
+
+            auto data = _values;
+            auto size = _size;
+            auto needles = keys.Data();
+            auto results = output.Data();
+            auto fullLevels = static_cast<SizeType>(std::bit_width(size + 1) - 1);
+
+            for (SizeType first = 0; first < keys.Size(); first += BatchValue) {
+                auto count = keys.Size() - first < BatchValue ? keys.Size() - first : BatchValue;
+                SizeType nodes[BatchValue];
+
+                for (SizeType lane = 0; lane < count; ++lane) {
+                    nodes[lane] = 1;
+                }
+
+                for (SizeType level = 0; level < fullLevels; ++level) {
+                    for (SizeType lane = 0; lane < count; ++lane) {
+                        if (nodes[lane] * PrefetchDistanceValue <= size) {
+                            GSTD_PREFETCH(data + nodes[lane] * PrefetchDistanceValue);
+                        }
+
+                        nodes[lane] = 2 * nodes[lane] + (_compare(data[nodes[lane]], needles[first + lane]) ? 1 : 0);
+                    }
+                }
+
+                for (SizeType lane = 0; lane < count; ++lane) {
+                    auto node = nodes[lane];
+
+                    if (node <= size) {
+                        node = 2 * node + (_compare(data[node], needles[first + lane]) ? 1 : 0);
+                    }
+
+                    node = Resolve(node);
+
+                    if (node == 0 || (exact && _compare(needles[first + lane], data[node]))) {
+                        results[first + lane] = MakeNone();
+                    } else {
+                        results[first + lane] = MakeSome(MakeCRef(data[node]));
+                    }
+                }
+            }
+        }
+
+    private:
+
+        RawPtr<Allocator> _allocator;
+
+        /**
+         * Nodes in Eytzinger order at indices `1 ... _size`, element at index 0 is unused
+         */
+        ValueType *_values;
+
+        SizeType _size;
+
+        CompareType _compare;
     };
 
     template<typename ValueT>
@@ -0,0 +1,671 @@
+#ifndef GSTD_UTF8_H
+#define GSTD_UTF8_H
+
+#include <bit>
+#include <cstring>
+
+#include <gstd/Algorithm/Simd.h>
+#include <gstd/Containers/StringRef.h>
+#include <gstd/Type/Pair.h>
+
+#if defined(GSTD_ARCH_X86_64)
+    #include <immintrin.h>
+#endif
+
+namespace gstd {
+
+    using CodePoint = std::uint32_t;
+
+    /**
+     * Code point, that replaces invalid sequences while decoding
+     */
+    inline constexpr CodePoint ReplacementCodePoint = 0xfffd;
+
+    /**
+     * Unicode code point
+     */
+    class Symbol {
+    public:
+
+        GSTD_CONSTEXPR Symbol(CodePoint codePoint) GSTD_NOEXCEPT
+                : _codePoint(codePoint) {}
+
+    public:
+
+        static GSTD_CONSTEXPR auto New(CodePoint codePoint) GSTD_NOEXCEPT -> Symbol {
+            return Symbol {
+                codePoint
+            };
+        }
+
+    public:
+
+        GSTD_CONSTEXPR auto Value() const GSTD_NOEXCEPT -> CodePoint {
+            return _codePoint;
+        }
+
+        GSTD_CONSTEXPR auto IsAscii() const GSTD_NOEXCEPT -> bool {
+            return _codePoint < 0x80;
+        }
+
+        /**
+         * Checking, if code point is Unicode scalar value (not surrogate and not greater than U+10FFFF)
+         * @return Is code point valid
+         */
+        GSTD_CONSTEXPR auto IsValid() const GSTD_NOEXCEPT -> bool {
+            return _codePoint < 0xd800 || (_codePoint > 0xdfff && _codePoint <= 0x10ffff);
+        }
+
+        /**
+         * Getting count of bytes in UTF-8 encoding of code point
+         * @return Count of bytes from 1 to 4
+         */
+        GSTD_CONSTEXPR auto Utf8Size() const GSTD_NOEXCEPT -> std::uint64_t {
+            return _codePoint < 0x80 ? 1 : (_codePoint < 0x800 ? 2 : (_codePoint < 0x10000 ? 3 : 4));
+        }
+
+        /**
+         * Encoding code point to UTF-8
+         * @param output Output, must have at least `Utf8Size()` bytes
+         * @return Count of written bytes
+         */
+        GSTD_CONSTEXPR auto EncodeUtf8(char *output) const GSTD_NOEXCEPT -> std::uint64_t {
+            if (_codePoint < 0x80) {
+                output[0] = static_cast<char>(_codePoint);
+
+                return 1;
+            }
+
+            if (_codePoint < 0x800) {
+                output[0] = static_cast<char>(0xc0 | (_codePoint >> 6));
+                output[1] = static_cast<char>(0x80 | (_codePoint & 0x3f));
+
+                return 2;
+            }
+
+            if (_codePoint < 0x10000) {
+                output[0] = static_cast<char>(0xe0 | (_codePoint >> 12));
+                output[1] = static_cast<char>(0x80 | ((_codePoint >> 6) & 0x3f));
+                output[2] = static_cast<char>(0x80 | (_codePoint & 0x3f));
+
+                return 3;
+            }
+
+            output[0] = static_cast<char>(0xf0 | (_codePoint >> 18));
+            output[1] = static_cast<char>(0x80 | ((_codePoint >> 12) & 0x3f));
+            output[2] = static_cast<char>(0x80 | ((_codePoint >> 6) & 0x3f));
+            output[3] = static_cast<char>(0x80 | (_codePoint & 0x3f));
+
+            return 4;
+        }
+
+    public:
+
+        GSTD_CONSTEXPR auto operator==(const Symbol &symbol) const GSTD_NOEXCEPT -> bool = default;
+
+        GSTD_CONSTEXPR auto operator<=>(const Symbol &symbol) const GSTD_NOEXCEPT -> std::strong_ordering = default;
+
+    private:
+
+        CodePoint _codePoint;
+    };
+
+    namespace detail {
+
+        /**
+         * Count of bytes, that checked by ASCII fast path of `StringIterator` at once
+         */
+        inline constexpr std::uint64_t Utf8AsciiRunValue = 64;
+
+        GSTD_CONSTEXPR auto IsContinuationByte(std::uint8_t byte) GSTD_NOEXCEPT -> bool {
+            return (byte & 0xc0) == 0x80;
+        }
+
+        /**
+         * Decoding one code point with full validation (overlong forms, surrogates and values above U+10FFFF are rejected)
+         * @param data Start of sequence, must be less than `end`
+         * @param end End of string
+         * @return Code point and count of consumed bytes. Invalid sequence gives `ReplacementCodePoint` and 1 byte
+         */
+        GSTD_CONSTEXPR auto DecodeUtf8(const char *data,
+                                       const char *end) GSTD_NOEXCEPT -> Pair<CodePoint, std::uint64_t> {
+            auto invalid = [] () {
+                return MakePair(CodePoint(ReplacementCodePoint),
+                                std::uint64_t(1));
+            };
+
+            auto available = static_cast<std::uint64_t>(end - data);
+            auto first = static_cast<std::uint8_t>(data[0]);
+
+            if (first < 0x80) {
+                return MakePair(CodePoint(first),
+                                std::uint64_t(1));
+            }
+
+            if (first < 0xc2 || first > 0xf4) {
+                return invalid();
+            }
+
+            if (first < 0xe0) {
+                if (available < 2 || !IsContinuationByte(static_cast<std::uint8_t>(data[1]))) {
+                    return invalid();
+                }
+
+                return MakePair(CodePoint(((first & 0x1f) << 6) | (static_cast<std::uint8_t>(data[1]) & 0x3f)),
+                                std::uint64_t(2));
+            }
+
+            auto second = available > 1 ? static_cast<std::uint8_t>(data[1]) : 0;
+
+            if (first < 0xf0) {
+                auto low = first == 0xe0 ? 0xa0 : 0x80;
+                auto high = first == 0xed ? 0x9f : 0xbf;
+
+                if (available < 3 || second < low || second > high || !IsContinuationByte(static_cast<std::uint8_t>(data[2]))) {
+                    return invalid();
+                }
+
+                return MakePair(CodePoint(((first & 0x0f) << 12)
+                                          | ((second & 0x3f) << 6)
+                                          | (static_cast<std::uint8_t>(data[2]) & 0x3f)),
+                                std::uint64_t(3));
+            }
+
+            auto low = first == 0xf0 ? 0x90 : 0x80;
+            auto high = first == 0xf4 ? 0x8f : 0xbf;
+
+            if (available < 4
+                || second < low
+                || second > high
+                || !IsContinuationByte(static_cast<std::uint8_t>(data[2]))
+                || !IsContinuationByte(static_cast<std::uint8_t>(data[3]))) {
+                return invalid();
+            }
+
+            return MakePair(CodePoint(((first & 0x07) << 18)
+                                      | ((second & 0x3f) << 12)
+                                      | ((static_cast<std::uint8_t>(data[2]) & 0x3f) << 6)
+                                      | (static_cast<std::uint8_t>(data[3]) & 0x3f)),
+                            std::uint64_t(4));
+        }
+
+        /**
+         * Counting ASCII bytes at start of string by 8-byte words
+         * @param data String
+         * @param size Size of string
+         * @param limit Maximal count of checked bytes
+         * @return Count of ASCII bytes at start
+         */
+        GSTD_INLINE auto AsciiPrefix(const char *data,
+                                     std::uint64_t size,
+                                     std::uint64_t limit) GSTD_NOEXCEPT -> std::uint64_t {
+            constexpr std::uint64_t HighBitsValue = 0x8080808080808080ull;
+
+            size = size < limit ? size : limit;
+
+            std::uint64_t count = 0;
+
+            for (; count + 8 <= size; count += 8) {
+                std::uint64_t word;
+
+                std::memcpy(&word, data + count, 8);
+
+                if (auto mask = word & HighBitsValue; mask != 0) {
+                    if GSTD_CONSTEXPR (std::endian::native == std::endian::little) {
+                        return count + static_cast<std::uint64_t>(std::countr_zero(mask)) / 8;
+                    } else {
+                        return count + static_cast<std::uint64_t>(std::countl_zero(mask)) / 8;
+                    }
+                }
+            }
+
+            while (count < size && static_cast<std::uint8_t>(data[count]) < 0x80) {
+                ++count;
+            }
+
+            return count;
+        }
+
+        /**
+         * Finding first invalid sequence by scalar decoding with ASCII fast path
+         * @return Offset of first invalid sequence or `size`
+         */
+        GSTD_INLINE auto FindInvalidUtf8Scalar(const char *data,
+                                               std::uint64_t size) GSTD_NOEXCEPT -> std::uint64_t {
+            std::uint64_t offset = 0;
+
+            while (offset < size) {
+                offset += AsciiPrefix(data + offset,
+                                      size - offset,
+                                      size - offset);
+
+                if (offset == size) {
+                    break;
+                }
+
+                auto decoded = DecodeUtf8(data + offset,
+                                          data + size);
+
+                if (decoded.Second() == 1) {
+                    return offset;
+                }
+
+                offset += decoded.Second();
+            }
+
+            return size;
+        }
+
+#if defined(GSTD_ARCH_X86_64)
+
+        /**
+         * Error flags of lookup validation (Keiser, Lemire "Validating UTF-8 In Less Than One Instruction Per Byte").
+         * Each flag marks pair of adjacent bytes, that is invalid, when flag is set in all three lookup tables
+         */
+        namespace utf8 {
+
+            inline constexpr std::uint8_t TooShortValue = 1 << 0;
+            inline constexpr std::uint8_t TooLongValue = 1 << 1;
+            inline constexpr std::uint8_t Overlong3Value = 1 << 2;
+            inline constexpr std::uint8_t TooLargeValue = 1 << 3;
+            inline constexpr std::uint8_t SurrogateValue = 1 << 4;
+            inline constexpr std::uint8_t Overlong2Value = 1 << 5;
+            inline constexpr std::uint8_t TooLarge1000Value = 1 << 6;
+            inline constexpr std::uint8_t Overlong4Value = 1 << 6;
+            inline constexpr std::uint8_t TwoContinuationsValue = 1 << 7;
+            inline constexpr std::uint8_t CarryValue = TooShortValue | TooLongValue | TwoContinuationsValue;
+
+            /**
+             * Flags by high nibble of first byte
+             */
+            inline constexpr std::uint8_t FirstHighTable[16] = {
+                TooLongValue, TooLongValue, TooLongValue, TooLongValue,
+                TooLongValue, TooLongValue, TooLongValue, TooLongValue,
+                TwoContinuationsValue, TwoContinuationsValue, TwoContinuationsValue, TwoContinuationsValue,
+                TooShortValue | Overlong2Value,
+                TooShortValue,
+                TooShortValue | Overlong3Value | SurrogateValue,
+                TooShortValue | TooLargeValue | TooLarge1000Value | Overlong4Value
+            };
+
+            /**
+             * Flags by low nibble of first byte
+             */
+            inline constexpr std::uint8_t FirstLowTable[16] = {
+                CarryValue | Overlong3Value | Overlong2Value | Overlong4Value,
+                CarryValue | Overlong2Value,
+                CarryValue,
+                CarryValue,
+                CarryValue | TooLargeValue,
+                CarryValue | TooLargeValue | TooLarge1000Value,
+                CarryValue | TooLargeValue | TooLarge1000Value,
+                CarryValue | TooLargeValue | TooLarge1000Value,
+                CarryValue | TooLargeValue | TooLarge1000Value,
+                CarryValue | TooLargeValue | TooLarge1000Value,
+                CarryValue | TooLargeValue | TooLarge1000Value,
+                CarryValue | TooLargeValue | TooLarge1000Value,
+                CarryValue | TooLargeValue | TooLarge1000Value,
+                CarryValue | TooLargeValue | TooLarge1000Value | SurrogateValue,
+                CarryValue | TooLargeValue | TooLarge1000Value,
+                CarryValue | TooLargeValue | TooLarge1000Value
+            };
+
+            /**
+             * Flags by high nibble of second byte
+             */
+            inline constexpr std::uint8_t SecondHighTable[16] = {
+                TooShortValue, TooShortValue, TooShortValue, TooShortValue,
+                TooShortValue, TooShortValue, TooShortValue, TooShortValue,
+                TooLongValue | Overlong2Value | TwoContinuationsValue | Overlong3Value | TooLarge1000Value | Overlong4Value,
+                TooLongValue | Overlong2Value | TwoContinuationsValue | Overlong3Value | TooLargeValue,
+                TooLongValue | Overlong2Value | TwoContinuationsValue | SurrogateValue | TooLargeValue,
+                TooLongValue | Overlong2Value | TwoContinuationsValue | SurrogateValue | TooLargeValue,
+                TooShortValue, TooShortValue, TooShortValue, TooShortValue
+            };
+
+        }
+
+        GSTD_TARGET("avx2")
+        inline auto LoadTableAVX2(const std::uint8_t (&table)[16]) GSTD_NOEXCEPT -> __m256i {
+            return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(table)));
+        }
+
+        /**
+         * State of vectorized validation between blocks
+         */
+        struct Utf8StateAVX2 {
+            __m256i Error;
+
+            __m256i Previous;
+
+            __m256i Incomplete;
+        };
+
+        GSTD_TARGET("avx2")
+        inline auto CheckUtf8BlockAVX2(Utf8StateAVX2 &state,
+                                       __m256i input,
+                                       __m256i firstHigh,
+                                       __m256i firstLow,
+                                       __m256i secondHigh) GSTD_NOEXCEPT -> void {
+            if (_mm256_movemask_epi8(input) == 0) {
+                state.Error = _mm256_or_si256(state.Error,
+                                              state.Incomplete);
+                state.Incomplete = _mm256_setzero_si256();
+                state.Previous = input;
+
+                return;
+            }
+
+            auto nibbleMask = _mm256_set1_epi8(0x0f);
+            auto shifted = _mm256_permute2x128_si256(state.Previous, input, 0x21);
+            auto previous1 = _mm256_alignr_epi8(input, shifted, 15);
+            auto previous2 = _mm256_alignr_epi8(input, shifted, 14);
+            auto previous3 = _mm256_alignr_epi8(input, shifted, 13);
+
+            auto special = _mm256_and_si256(_mm256_and_si256(_mm256_shuffle_epi8(firstHigh,
+                                                                                 _mm256_and_si256(_mm256_srli_epi16(previous1, 4),
+                                                                                                  nibbleMask)),
+                                                             _mm256_shuffle_epi8(firstLow,
+                                                                                 _mm256_and_si256(previous1,
+                                                                                                  nibbleMask))),
+                                            _mm256_shuffle_epi8(secondHigh,
+                                                                _mm256_and_si256(_mm256_srli_epi16(input, 4),
+                                                                                 nibbleMask)));
+
+            auto third = _mm256_subs_epu8(previous2, _mm256_set1_epi8(static_cast<char>(0xe0 - 0x80)));
+            auto fourth = _mm256_subs_epu8(previous3, _mm256_set1_epi8(static_cast<char>(0xf0 - 0x80)));
+            auto required = _mm256_and_si256(_mm256_or_si256(third, fourth),
+                                             _mm256_set1_epi8(static_cast<char>(0x80)));
+
+            state.Error = _mm256_or_si256(state.Error,
+                                          _mm256_xor_si256(required, special));
+
+            auto maximal = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,
+                                            -1, -1, -1, -1, -1, -1, -1, -1,
+                                            -1, -1, -1, -1, -1, -1, -1, -1,
+                                            -1, -1, -1, -1, -1,
+                                            static_cast<char>(0xf0 - 1),
+                                            static_cast<char>(0xe0 - 1),
+                                            static_cast<char>(0xc0 - 1));
+
+            state.Incomplete = _mm256_subs_epu8(input, maximal);
+            state.Previous = input;
+        }
+
+        GSTD_TARGET("avx2")
+        inline auto IsValidUtf8AVX2(const char *data,
+                                    std::uint64_t size) GSTD_NOEXCEPT -> bool {
+            auto firstHigh = LoadTableAVX2(utf8::FirstHighTable);
+            auto firstLow = LoadTableAVX2(utf8::FirstLowTable);
+            auto secondHigh = LoadTableAVX2(utf8::SecondHighTable);
+
+            Utf8StateAVX2 state {
+                _mm256_setzero_si256(),
+                _mm256_setzero_si256(),
+                _mm256_setzero_si256()
+            };
+
+            std::uint64_t offset = 0;
+
+            for (; offset + 64 <= size; offset += 64) {
+                auto first = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + offset));
+                auto second = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + offset + 32));
+
+                if (_mm256_movemask_epi8(_mm256_or_si256(first, second)) == 0) {
+                    state.Error = _mm256_or_si256(state.Error,
+                                                  state.Incomplete);
+                    state.Incomplete = _mm256_setzero_si256();
+                    state.Previous = second;
+
+                    continue;
+                }
+
+                CheckUtf8BlockAVX2(state, first, firstHigh, firstLow, secondHigh);
+                CheckUtf8BlockAVX2(state, second, firstHigh, firstLow, secondHigh);
+            }
+
+            for (; offset < size; offset += 32) {
+                alignas(32) char block[32] = {};
+
+                std::memcpy(block,
+                            data + offset,
+                            size - offset < 32 ? size - offset : 32);
+
+                CheckUtf8BlockAVX2(state,
+                                   _mm256_load_si256(reinterpret_cast<const __m256i *>(block)),
+                                   firstHigh,
+                                   firstLow,
+                                   secondHigh);
+            }
+
+            state.Error = _mm256_or_si256(state.Error,
+                                          state.Incomplete);
+
+            return _mm256_testz_si256(state.Error, state.Error) != 0;
+        }
+
+#endif
+
+        /**
+         * Counting bytes, that are not continuation bytes, in vectorized loop
+         */
+        GSTD_FORCEINLINE auto CountLeadBytes(const char *data,
+                                             std::uint64_t size) GSTD_NOEXCEPT -> std::uint64_t {
+            std::uint64_t lanes[SimdLanesValue] = {};
+            std::uint64_t index = 0;
+
+            for (; index + SimdLanesValue <= size; index += SimdLanesValue) {
+                for (std::uint64_t lane = 0; lane < SimdLanesValue; ++lane) {
+                    lanes[lane] += static_cast<std::int8_t>(data[index + lane]) > -65 ? 1 : 0;
+                }
+            }
+
+            for (std::uint64_t lane = 0; index < size; ++index, ++lane) {
+                lanes[lane] += static_cast<std::int8_t>(data[index]) > -65 ? 1 : 0;
+            }
+
+            return ReduceLanes(lanes,
+                               [] (std::uint64_t first,
+                                   std::uint64_t second) {
+                return first + second;
+            });
+        }
+
+    }
+
+    /**
+     * Checking, if string is valid UTF-8. Overlong forms, surrogates and code points above U+10FFFF are invalid<br>
+     * With AVX2 string is validated by vectorized lookup tables, 64 bytes per step, ASCII blocks are skipped
+     * @param string String
+     * @return Is string valid
+     */
+    GSTD_INLINE auto IsValidUtf8(StringRef string) GSTD_NOEXCEPT -> bool {
+#if defined(GSTD_ARCH_X86_64)
+        if (CurrentSimdLevel() >= SimdLevel::AVX2) {
+            return detail::IsValidUtf8AVX2(string.Data(),
+                                           string.Size());
+        }
+#endif
+
+        return detail::FindInvalidUtf8Scalar(string.Data(),
+                                             string.Size()) == string.Size();
+    }
+
+    /**
+     * Finding first invalid sequence in UTF-8 string
+     * @param string String
+     * @return Byte offset of first invalid sequence or none, if string is valid
+     */
+    GSTD_INLINE auto FindInvalidUtf8(StringRef string) GSTD_NOEXCEPT -> Optional<std::uint64_t> {
+        auto offset = detail::FindInvalidUtf8Scalar(string.Data(),
+                                                    string.Size());
+
+        if (offset == string.Size()) {
+            return MakeNone();
+        }
+
+        return MakeSome(std::move(offset));
+    }
+
+    /**
+     * Counting code points in valid UTF-8 string
+     * @param string Valid UTF-8 string
+     * @return Count of code points
+     */
+    GSTD_INLINE auto CountCodePoints(StringRef string) GSTD_NOEXCEPT -> std::uint64_t {
+        auto data = string.Data();
+        auto size = string.Size();
+
+        return detail::SimdDispatch([data, size] () -> std::uint64_t {
+            return detail::CountLeadBytes(data, size);
+        });
+    }
+
+    /**
+     * Getting byte offset of code point by its index in valid UTF-8 string
+     * @param string Valid UTF-8 string
+     * @param index Index of code point
+     * @return Byte offset or none, if string has less code points
+     */
+    GSTD_INLINE auto CodePointOffset(StringRef string,
+                                     std::uint64_t index) GSTD_NOEXCEPT -> Optional<std::uint64_t> {
+        constexpr std::uint64_t BlockValue = 256;
+
+        auto data = string.Data();
+        auto size = string.Size();
+
+        auto offset = detail::SimdDispatch([data, size, &index] () -> std::uint64_t {
+            std::uint64_t offset = 0;
+
+            for (; offset + BlockValue <= size; offset += BlockValue) {
+                auto count = detail::CountLeadBytes(data + offset,
+                                                    BlockValue);
+
+                if (count > index) {
+                    break;
+                }
+
+                index -= count;
+            }
+
+            return offset;
+        });
+
+        for (; offset < size; ++offset) {
+            if (detail::IsContinuationByte(static_cast<std::uint8_t>(data[offset]))) {
+                continue;
+            }
+
+            if (index == 0) {
+                return MakeSome(std::move(offset));
+            }
+
+            --index;
+        }
+
+        return MakeNone();
+    }
+
+    /**
+     * Getting index of code point, that contains byte with offset, in valid UTF-8 string
+     * @param string Valid UTF-8 string
+     * @param offset Byte offset
+     * @return Index of code point or count of code points, if offset is not less than size of string
+     */
+    GSTD_INLINE auto CodePointIndex(StringRef string,
+                                    std::uint64_t offset) GSTD_NOEXCEPT -> std::uint64_t {
+        if (offset >= string.Size()) {
+            return CountCodePoints(string);
+        }
+
+        auto count = CountCodePoints(StringRef(string.Data(),
+                                               offset + 1));
+
+        return count > 0 ? count - 1 : 0;
+    }
+
+    /**
+     * Iterator over code points of UTF-8 string. Invalid sequences are decoded as `ReplacementCodePoint`<br>
+     * Runs of ASCII bytes are detected up to `Utf8AsciiRunValue` bytes ahead, so they are iterated without decoding
+     */
+    class StringIterator {
+    public:
+
+        GSTD_CONSTEXPR StringIterator(StringRef string) GSTD_NOEXCEPT
+                : _pointer(string.Data()),
+                  _end(string.Data() + string.Size()),
+                  _ascii(0) {
+            ScanAscii();
+        }
+
+    public:
+
+        GSTD_CONSTEXPR auto has_next() const GSTD_NOEXCEPT -> bool {
+            return _pointer < _end;
+        }
+
+        GSTD_CONSTEXPR auto next() GSTD_NOEXCEPT -> void {
+            if (_ascii > 1) {
+                ++_pointer;
+                --_ascii;
+
+                return;
+            }
+
+            if (_ascii == 1) {
+                ++_pointer;
+            } else {
+                auto decoded = detail::DecodeUtf8(_pointer,
+                                                  _end);
+
+                _pointer += decoded.Second();
+            }
+
+            ScanAscii();
+        }
+
+        GSTD_CONSTEXPR auto current() const GSTD_NOEXCEPT -> Symbol {
+            if (_ascii != 0) {
+                return Symbol(static_cast<std::uint8_t>(*_pointer));
+            }
+
+            auto decoded = detail::DecodeUtf8(_pointer,
+                                              _end);
+
+            return Symbol(decoded.First());
+        }
+
+        /**
+         * Getting pointer to current code point
+         * @return Pointer to current code point
+         */
+        GSTD_CONSTEXPR auto Position() const GSTD_NOEXCEPT -> const char * {
+            return _pointer;
+        }
+
+    private:
+
+        GSTD_CONSTEXPR auto ScanAscii() GSTD_NOEXCEPT -> void {
+            if (_pointer == _end || static_cast<std::uint8_t>(*_pointer) >= 0x80) {
+                _ascii = 0;
+            } else if (std::is_constant_evaluated()) {
+                _ascii = 1;
+            } else {
+                _ascii = detail::AsciiPrefix(_pointer,
+                                             static_cast<std::uint64_t>(_end - _pointer),
+                                             detail::Utf8AsciiRunValue);
+            }
+        }
+
+    private:
+
+        const char *_pointer;
+
+        const char *_end;
+
+        std::uint64_t _ascii;
+    };
+
+}
+
+#endif //GSTD_UTF8_H
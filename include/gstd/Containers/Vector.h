@@ -1,8 +1,17 @@
 #ifndef GSTD_VECTOR_H
 #define GSTD_VECTOR_H
 
+#include <bit>
+#include <limits>
+#include <memory>
+
 #include <gstd/Containers/Slice.h>
+#include <gstd/Containers/SliceView.h>
 #include <gstd/Memory/Allocator.h>
+#include <gstd/Memory/RawPtr.h>
+#include <gstd/Memory/Relocate.h>
+#include <gstd/Type/Convert.h>
+#include <gstd/Type/InitializerList.h>
 
 namespace gstd {
 
@@ -33,6 +42,13 @@ namespace gstd {
         static_assert(std::is_unsigned_v<IndexType>,
                       "`IndexType` must be unsigned type!");
 
+    private:
+
+        /**
+         * Minimal capacity of buffer after first allocation
+         */
+        inline static constexpr SizeType MinCapacityValue = 4;
+
     public:
 
         GSTD_CONSTEXPR Vector(RawPtr<Allocator> allocator = DefaultAllocator())
@@ -50,26 +66,39 @@ namespace gstd {
                   _allocator(allocator) {}
 
         GSTD_CONSTEXPR Vector(InitializerList<ValueType> initializerList,
-                              RawPtr<Allocator> allocator = DefaultAllocator());
+                              RawPtr<Allocator> allocator = DefaultAllocator())
+                : Vector(allocator) {
+            Reserve(initializerList.Size());
 
-        GSTD_CONSTEXPR Vector(const Vector &vector);
+            for (auto &value : initializerList) {
+                std::construct_at(_buffer.Value() + _size,
+                                  value);
+                ++_size;
+            }
+        }
 
-        GSTD_CONSTEXPR Vector(Vector &&vector) GSTD_NOEXCEPT;
+        GSTD_CONSTEXPR Vector(const Vector &vector)
+                : Vector(vector._allocator) {
+            Reserve(vector._size);
 
-    public:
+            CopyConstruct(vector._buffer.Value(),
+                          vector._size);
+        }
 
-        GSTD_CONSTEXPR ~Vector() GSTD_NOEXCEPT {
-            if (_buffer.HasValue()) {
-                for (IndexType index = 0; index < _size; ++index) {
-                    _buffer[index].~ValueType();
-                }
+        GSTD_CONSTEXPR Vector(Vector &&vector) GSTD_NOEXCEPT
+                : _buffer(vector._buffer),
+                  _size(vector._size),
+                  _capacity(vector._capacity),
+                  _allocator(vector._allocator) {
+            vector._buffer = nullptr;
+            vector._size = 0;
+            vector._capacity = 0;
+        }
 
-                _allocator->Deallocate(_buffer);
-            }
+    public:
 
-            _buffer = nullptr;
-            _size = 0;
-            _capacity = 0;
+        GSTD_CONSTEXPR ~Vector() GSTD_NOEXCEPT {
+            Release();
         }
 
     public:
@@ -101,31 +130,16 @@ namespace gstd {
     public:
 
         GSTD_CONSTEXPR auto Append(const ValueType &value) -> void {
-            if (_size >= _capacity) {
-                // ...
-            }
-
-            new (_buffer + _size) ValueType(value);
-            ++_size;
+            Emplace(value);
         }
 
         GSTD_CONSTEXPR auto Append(ValueType &&value) -> void {
-            if (_size >= _capacity) {
-                // ...
-            }
-
-            new (_buffer + _size) ValueType(std::move(value));
-            ++_size;
+            Emplace(std::move(value));
         }
 
         template<typename... ArgumentsT>
         GSTD_CONSTEXPR auto Append(ArgumentsT &&...arguments) -> void {
-            if (_size >= _capacity) {
-                // ...
-            }
-
-            new (_buffer + _size) ValueType(std::forward<ArgumentsT>(arguments)...);
-            ++_size;
+            Emplace(std::forward<ArgumentsT>(arguments)...);
         }
 
         GSTD_CONSTEXPR auto At(const IndexType &index) -> Optional<Ref<ValueType>> {
@@ -133,7 +147,7 @@ namespace gstd {
                 return MakeNone();
             }
 
-            return MakeSome(MakeRef(_buffer[index]));
+            return MakeSome(MakeRef(_buffer.Value()[index]));
         }
 
         GSTD_CONSTEXPR auto At(const IndexType &index) const -> Optional<Ref<const ValueType>> {
@@ -141,29 +155,42 @@ namespace gstd {
                 return MakeNone();
             }
 
-            return MakeSome(MakeCRef(_buffer[index]));
+            return MakeSome(MakeCRef(_buffer.Value()[index]));
         }
 
         GSTD_CONSTEXPR auto Insert(const IndexType &index,
-                                   const ValueType &value) -> void;
+                                   const ValueType &value) -> void {
+            EmplaceAt(index,
+                      value);
+        }
 
         GSTD_CONSTEXPR auto Insert(const IndexType &index,
-                                   ValueType &&value) -> void;
+                                   ValueType &&value) -> void {
+            EmplaceAt(index,
+                      std::move(value));
+        }
 
         template<typename... ArgumentsT>
         GSTD_CONSTEXPR auto Insert(const IndexType &index,
-                                   ArgumentsT &&...value) -> void;
+                                   ArgumentsT &&...value) -> void {
+            EmplaceAt(index,
+                      std::forward<ArgumentsT>(value)...);
+        }
 
         GSTD_CONSTEXPR auto Remove(const IndexType &index) -> void {
-            if (_size <= 0) {
-                // ...
+            if (!InBounds(index)) {
+                Panic("Index out of range!");
             }
 
-            if (index >= _size) {
-                // ...
-            }
+            auto buffer = _buffer.Value();
+
+            std::destroy_at(buffer + index);
+
+            RelocateN(buffer + index + 1,
+                      _size - index - 1,
+                      buffer + index);
 
-            // ?
+            --_size;
         }
 
         GSTD_CONSTEXPR auto Size() const -> SizeType {
@@ -174,9 +201,141 @@ namespace gstd {
             return _capacity;
         }
 
-        GSTD_CONSTEXPR auto Reserve(const SizeType &size) -> void;
+        GSTD_CONSTEXPR auto Data() GSTD_NOEXCEPT -> ValueType * {
+            return _buffer.Value();
+        }
+
+        GSTD_CONSTEXPR auto Data() const GSTD_NOEXCEPT -> const ValueType * {
+            return _buffer.Value();
+        }
+
+        GSTD_CONSTEXPR auto AsSpan() GSTD_NOEXCEPT -> Span<ValueType> {
+            return Span<ValueType> {
+                _buffer.Value(),
+                _size
+            };
+        }
+
+        GSTD_CONSTEXPR auto AsSpan() const GSTD_NOEXCEPT -> Span<const ValueType> {
+            return Span<const ValueType> {
+                _buffer.Value(),
+                _size
+            };
+        }
+
+        /**
+         * Getting zero-copy strided view over elements by `Slice`
+         * @param slice Slice
+         * @return `SliceView` over elements
+         */
+        GSTD_CONSTEXPR auto View(const Slice &slice) -> SliceView<ValueType> {
+            return SliceView<ValueType>::New(AsSpan(),
+                                             slice);
+        }
+
+        GSTD_CONSTEXPR auto View(const Slice &slice) const -> SliceView<const ValueType> {
+            return SliceView<const ValueType>::New(AsSpan(),
+                                                   slice);
+        }
+
+        GSTD_CONSTEXPR auto Reserve(const SizeType &size) -> void {
+            if (size <= _capacity) {
+                return;
+            }
+
+            Reallocate(size);
+        }
+
+        GSTD_CONSTEXPR auto Fit() -> void {
+            if (_size == _capacity) {
+                return;
+            }
+
+            Reallocate(_size);
+        }
+
+        /**
+         * Changing size of vector without initializing new elements, available only for trivial types<br>
+         * New elements have indeterminate values and must be written before reading
+         * @param size New size
+         */
+        GSTD_CONSTEXPR auto ResizeUninitialized(const SizeType &size) -> void {
+            static_assert(std::is_trivial_v<ValueType>,
+                          "`ResizeUninitialized` is available only for trivial `ValueType`!");
+
+            Grow(size);
+
+            _size = size;
+        }
+
+        /**
+         * Changing size of vector with default initialization of new elements<br>
+         * Unlike `Resize` trivial elements are not zeroed
+         * @param size New size
+         */
+        GSTD_CONSTEXPR auto ResizeDefaultInit(const SizeType &size) -> void {
+            if (size < _size) {
+                std::destroy_n(_buffer.Value() + size,
+                               _size - size);
+
+                _size = size;
+
+                return;
+            }
+
+            Grow(size);
+
+            for (auto buffer = _buffer.Value(); _size < size; ++_size) {
+                ::new (static_cast<void *>(buffer + _size)) ValueType;
+            }
+        }
+
+        /**
+         * Changing size of vector with value initialization of new elements
+         * @param size New size
+         */
+        GSTD_CONSTEXPR auto Resize(const SizeType &size) -> void {
+            if (size < _size) {
+                std::destroy_n(_buffer.Value() + size,
+                               _size - size);
+
+                _size = size;
+
+                return;
+            }
+
+            Grow(size);
+
+            for (auto buffer = _buffer.Value(); _size < size; ++_size) {
+                std::construct_at(buffer + _size);
+            }
+        }
+
+        /**
+         * Appending `count` uninitialized elements and returning them for writing by producer (read, decompressor, formatter)<br>
+         * Available only for trivial types. If producer writes less elements, vector can be shrunk by `ResizeUninitialized`
+         * @param count Count of new elements
+         * @return Writable span of new elements
+         */
+        GSTD_CONSTEXPR auto AppendUninitialized(const SizeType &count) -> Span<ValueType> {
+            static_assert(std::is_trivial_v<ValueType>,
+                          "`AppendUninitialized` is available only for trivial `ValueType`!");
+
+            if (count > std::numeric_limits<SizeType>::max() - _size) {
+                Panic("`Vector` size overflow!");
+            }
+
+            auto size = _size;
 
-        GSTD_CONSTEXPR auto Fit() -> void;
+            Grow(_size + count);
+
+            _size += count;
+
+            return Span<ValueType> {
+                _buffer.Value() + size,
+                count
+            };
+        }
 
     private:
 
@@ -184,19 +343,182 @@ namespace gstd {
             return index < Size();
         }
 
+        /**
+         * Constructing element at end. On growth element is constructed in new buffer before relocation,
+         * so arguments can refer to elements of vector
+         */
+        template<typename... ArgumentsT>
+        GSTD_CONSTEXPR auto Emplace(ArgumentsT &&...arguments) -> void {
+            if (_size < _capacity) {
+                std::construct_at(_buffer.Value() + _size,
+                                  std::forward<ArgumentsT>(arguments)...);
+                ++_size;
+
+                return;
+            }
+
+            auto capacity = NextCapacity();
+            auto buffer = _allocator->template Allocate<ValueType>(capacity);
+
+            std::construct_at(buffer + _size,
+                              std::forward<ArgumentsT>(arguments)...);
+
+            if (_buffer.HasValue()) {
+                RelocateN(_buffer.Value(),
+                          _size,
+                          buffer);
+
+                _allocator->Deallocate(_buffer.Value(),
+                                       _capacity);
+            }
+
+            _buffer = buffer;
+            _capacity = capacity;
+            ++_size;
+        }
+
+        template<typename... ArgumentsT>
+        GSTD_CONSTEXPR auto EmplaceAt(const IndexType &index,
+                                      ArgumentsT &&...arguments) -> void {
+            if (index > _size) {
+                Panic("Index out of range!");
+            }
+
+            if (_size < _capacity) {
+                auto buffer = _buffer.Value();
+
+                ValueType value(std::forward<ArgumentsT>(arguments)...);
+
+                RelocateN(buffer + index,
+                          _size - index,
+                          buffer + index + 1);
+
+                std::construct_at(buffer + index,
+                                  std::move(value));
+                ++_size;
+
+                return;
+            }
+
+            auto capacity = NextCapacity();
+            auto buffer = _allocator->template Allocate<ValueType>(capacity);
+
+            std::construct_at(buffer + index,
+                              std::forward<ArgumentsT>(arguments)...);
+
+            if (_buffer.HasValue()) {
+                RelocateN(_buffer.Value(),
+                          index,
+                          buffer);
+                RelocateN(_buffer.Value() + index,
+                          _size - index,
+                          buffer + index + 1);
+
+                _allocator->Deallocate(_buffer.Value(),
+                                       _capacity);
+            }
+
+            _buffer = buffer;
+            _capacity = capacity;
+            ++_size;
+        }
+
+        GSTD_CONSTEXPR auto NextCapacity() const GSTD_NOEXCEPT -> SizeType {
+            if (_capacity < MinCapacityValue) {
+                return MinCapacityValue;
+            }
+
+            return _capacity * 2;
+        }
+
+        /**
+         * Growing buffer for holding at least `size` elements with geometric growth
+         * @param size Required count of elements
+         */
+        GSTD_CONSTEXPR auto Grow(const SizeType &size) -> void {
+            if (size <= _capacity) {
+                return;
+            }
+
+            auto capacity = NextCapacity();
+
+            Reallocate(size > capacity ? size : capacity);
+        }
+
+        /**
+         * Copy constructing `count` elements from `source` after existing elements. Capacity must be enough<br>
+         * Trivially copyable elements are copied with one `MemCopy`
+         * @param source Source elements
+         * @param count Count of elements
+         */
+        GSTD_CONSTEXPR auto CopyConstruct(const ValueType *source,
+                                          const SizeType &count) -> void {
+            if GSTD_CONSTEXPR (std::is_trivially_copyable_v<ValueType>) {
+                if (!std::is_constant_evaluated()) {
+                    MemCopy(static_cast<void *>(_buffer.Value() + _size),
+                            static_cast<const void *>(source),
+                            count * sizeof(ValueType));
+
+                    _size += count;
+
+                    return;
+                }
+            }
+
+            for (IndexType index = 0; index < count; ++index) {
+                std::construct_at(_buffer.Value() + _size,
+                                  source[index]);
+                ++_size;
+            }
+        }
+
+        /**
+         * Moving elements to new buffer with `capacity` elements. Elements are relocated, not copied
+         * @param capacity New capacity
+         */
+        GSTD_CONSTEXPR auto Reallocate(const SizeType &capacity) -> void {
+            auto buffer = _allocator->template Allocate<ValueType>(capacity);
+
+            if (_buffer.HasValue()) {
+                RelocateN(_buffer.Value(),
+                          _size,
+                          buffer);
+
+                _allocator->Deallocate(_buffer.Value(),
+                                       _capacity);
+            }
+
+            _buffer = buffer;
+            _capacity = capacity;
+        }
+
+        GSTD_CONSTEXPR auto Release() GSTD_NOEXCEPT -> void {
+            if (_buffer.HasValue()) {
+                std::destroy_n(_buffer.Value(),
+                               _size);
+
+                _allocator->Deallocate(_buffer.Value(),
+                                       _capacity);
+            }
+
+            _buffer = nullptr;
+            _size = 0;
+            _capacity = 0;
+        }
+
     public:
 
         GSTD_CONSTEXPR auto Iter() -> Iterator {
             return Iterator {
-                _buffer,
-                _buffer + _size
+                _buffer.Value(),
+                _buffer.Value() + _size
             };
         }
 
         GSTD_CONSTEXPR auto Iter() const -> ConstIterator {
             return ConstIterator {
-                _buffer,
-                _buffer + _size
+                _buffer.Value(),
+                _buffer.Value() + _size
             };
         }
 
@@ -219,7 +541,14 @@ namespace gstd {
                 return *this;
             }
 
-            // ...
+            std::destroy_n(_buffer.Value(),
+                           _size);
+            _size = 0;
+
+            Reserve(vector._size);
+
+            CopyConstruct(vector._buffer.Value(),
+                          vector._size);
 
             return *this;
         }
@@ -229,18 +558,59 @@ namespace gstd {
                 return *this;
             }
 
-            // ...
+            Release();
+
+            _buffer = vector._buffer;
+            _size = vector._size;
+            _capacity = vector._capacity;
+            _allocator = vector._allocator;
+
+            vector._buffer = nullptr;
+            vector._size = 0;
+            vector._capacity = 0;
 
             return *this;
         }
 
         GSTD_CONSTEXPR auto operator==(const Vector &vector) const -> bool;
 
-        GSTD_CONSTEXPR auto operator[](const IndexType &index) -> ValueType &;
+        GSTD_CONSTEXPR auto operator[](const IndexType &index) -> ValueType & {
+            if (!InBounds(index)) {
+                Panic("Index out of range!");
+            }
+
+            return _buffer.Value()[index];
+        }
+
+        GSTD_CONSTEXPR auto operator[](const IndexType &index) const -> const ValueType & {
+            if (!InBounds(index)) {
+                Panic("Index out of range!");
+            }
+
+            return _buffer.Value()[index];
+        }
+
+        GSTD_CONSTEXPR auto operator[](const Slice &slice) const -> Vector {
+            auto bounds = slice.Resolve(_size);
 
-        GSTD_CONSTEXPR auto operator[](const IndexType &index) const -> const ValueType &;
+            Vector vector(_allocator);
 
-        GSTD_CONSTEXPR auto operator[](const Slice &slice) const -> Vector;
+            vector.Reserve(bounds.GetCount());
+
+            for (IndexType index = 0; index < bounds.GetCount(); ++index) {
+                vector.Emplace(_buffer.Value()[bounds.GetStart() + StaticCast<Position>(index) * bounds.GetStep()]);
+            }
+
+            return vector;
+        }
+
+        GSTD_CONSTEXPR operator Span<ValueType>() GSTD_NOEXCEPT {
+            return AsSpan();
+        }
+
+        GSTD_CONSTEXPR operator Span<const ValueType>() const GSTD_NOEXCEPT {
+            return AsSpan();
+        }
 
     private:
 
@@ -253,19 +623,1669 @@ namespace gstd {
         RawPtr<Allocator> _allocator;
     };
 
-    class StableVector {
+    /**
+     * `Vector` owns its buffer only by pointer, so it can be relocated by bytes copying
+     * @tparam ValueT Value type
+     */
+    template<typename ValueT>
+    struct IsTriviallyRelocatable<Vector<ValueT>> : TrueType {
 
     };
 
-    class StaticVector {
+    template<typename ValueT,
+             std::uint64_t ChunkSizeV>
+    class StableVector;
+
+    /**
+     * Iterator over elements of `StableVector`
+     * @tparam ValueT Value type
+     * @tparam ChunkSizeV Count of elements in one chunk
+     */
+    template<typename ValueT,
+             std::uint64_t ChunkSizeV>
+    class StableVectorIterator : public Iterator<ValueT> {
+    public:
 
-    };
+        using ValueType = typename Iterator<ValueT>::ValueType;
 
-    class SmallVector {
+        using ContainerType = std::conditional_t<std::is_const_v<ValueType>,
+                                                 const StableVector<std::remove_const_t<ValueType>,
+                                                                    ChunkSizeV>,
+                                                 StableVector<ValueType,
+                                                              ChunkSizeV>>;
+
+        using IndexType = std::uint64_t;
+
+    public:
+
+        GSTD_CONSTEXPR StableVectorIterator(ContainerType &container) GSTD_NOEXCEPT
+                : _container(container),
+                  _index(0) {}
+
+    protected:
+
+        GSTD_CONSTEXPR auto DoNext() -> Optional<Ref<ValueType>> override {
+            if (_index == _container.Size()) {
+                return MakeNone();
+            }
+
+            auto &value = _container[_index];
 
+            ++_index;
+
+            return MakeSome(MakeRef(value));
+        }
+
+    private:
+
+        ContainerType &_container;
+
+        IndexType _index;
     };
 
-    class Devector {
+    /**
+     * Vector with pointer stability. Elements are stored in fixed-size chunks and never move after insertion<br>
+     * Indexing is O(1): one shift for chunk index and one mask for index in chunk
+     * @tparam ValueT Value type
+     * @tparam ChunkSizeV Count of elements in one chunk, must be power of two
+     */
+    template<typename ValueT,
+             std::uint64_t ChunkSizeV = 64>
+    class StableVector {
+    public:
+
+        using ValueType = ValueT;
+
+        using AllocatorType = Allocator;
+
+        using SizeType = std::uint64_t;
+
+        using Iterator = StableVectorIterator<ValueType,
+                                              ChunkSizeV>;
+
+        using ConstIterator = StableVectorIterator<const ValueType,
+                                                   ChunkSizeV>;
+
+        using IndexType = std::uint64_t;
+
+        inline static constexpr SizeType ChunkSizeValue = ChunkSizeV;
+
+    public:
+
+        static_assert(!std::is_reference_v<ValueType>,
+                      "`ValueType` can`t be reference type!");
+
+        static_assert(ChunkSizeValue > 0 && (ChunkSizeValue & (ChunkSizeValue - 1)) == 0,
+                      "`ChunkSizeV` must be power of two!");
+
+    private:
+
+        inline static constexpr SizeType ChunkShiftValue = std::countr_zero(ChunkSizeValue);
+
+        inline static constexpr SizeType ChunkMaskValue = ChunkSizeValue - 1;
+
+    public:
+
+        GSTD_CONSTEXPR StableVector(RawPtr<Allocator> allocator = DefaultAllocator())
+                : _chunks(allocator),
+                  _size(0),
+                  _allocator(allocator) {}
+
+        GSTD_CONSTEXPR StableVector(const StableVector &vector)
+                : StableVector(vector._allocator) {
+            for (IndexType index = 0; index < vector._size; ++index) {
+                Append(vector[index]);
+            }
+        }
+
+        GSTD_CONSTEXPR StableVector(StableVector &&vector) GSTD_NOEXCEPT
+                : _chunks(std::move(vector._chunks)),
+                  _size(vector._size),
+                  _allocator(vector._allocator) {
+            vector._size = 0;
+        }
+
+    public:
+
+        GSTD_CONSTEXPR ~StableVector() GSTD_NOEXCEPT {
+            Clear();
+            Fit();
+        }
+
+    public:
+
+        static GSTD_CONSTEXPR auto New() -> StableVector {
+            return StableVector {};
+        }
+
+        static GSTD_CONSTEXPR auto New(RawPtr<Allocator> allocator) -> StableVector {
+            return StableVector {
+                allocator
+            };
+        }
+
+    public:
+
+        /**
+         * Appending new element to end of vector. Other elements are not moved
+         * @tparam ArgumentsT Arguments types
+         * @param arguments Arguments for constructing element
+         * @return Reference to new element, valid until element is removed
+         */
+        template<typename... ArgumentsT>
+        GSTD_CONSTEXPR auto Append(ArgumentsT &&...arguments) -> ValueType & {
+            if (_size == Capacity()) {
+                _chunks.Append(_allocator->template Allocate<ValueType>(ChunkSizeValue));
+            }
+
+            auto pointer = std::construct_at(Address(_size),
+                                             std::forward<ArgumentsT>(arguments)...);
+            ++_size;
+
+            return *pointer;
+        }
+
+        /**
+         * Removing last element and returning it. Chunk of element is not released
+         * @return Last element or `None` if vector is empty
+         */
+        GSTD_CONSTEXPR auto Pop() -> Optional<ValueType> {
+            if (_size == 0) {
+                return MakeNone();
+            }
+
+            --_size;
+
+            auto pointer = Address(_size);
+
+            ValueType value(std::move(*pointer));
+
+            std::destroy_at(pointer);
+
+            return MakeSome(std::move(value));
+        }
+
+        GSTD_CONSTEXPR auto Clear() GSTD_NOEXCEPT -> void {
+            for (IndexType index = 0; index < _size; ++index) {
+                std::destroy_at(Address(index));
+            }
+
+            _size = 0;
+        }
+
+        /**
+         * Releasing chunks, that don't contain any element
+         */
+        GSTD_CONSTEXPR auto Fit() -> void {
+            auto usedChunks = (_size + ChunkMaskValue) >> ChunkShiftValue;
+
+            while (_chunks.Size() > usedChunks) {
+                auto last = _chunks.Size() - 1;
+
+                _allocator->Deallocate(_chunks[last],
+                                       ChunkSizeValue);
+
+                _chunks.Remove(last);
+            }
+        }
+
+        /**
+         * Allocating chunks for holding at least `size` elements
+         * @param size Count of elements
+         */
+        GSTD_CONSTEXPR auto Reserve(const SizeType &size) -> void {
+            while (Capacity() < size) {
+                _chunks.Append(_allocator->template Allocate<ValueType>(ChunkSizeValue));
+            }
+        }
+
+        GSTD_CONSTEXPR auto At(const IndexType &index) -> Optional<Ref<ValueType>> {
+            if (!InBounds(index)) {
+                return MakeNone();
+            }
+
+            return MakeSome(MakeRef(*Address(index)));
+        }
+
+        GSTD_CONSTEXPR auto At(const IndexType &index) const -> Optional<Ref<const ValueType>> {
+            if (!InBounds(index)) {
+                return MakeNone();
+            }
+
+            return MakeSome(MakeCRef(*Address(index)));
+        }
+
+        GSTD_CONSTEXPR auto Size() const GSTD_NOEXCEPT -> SizeType {
+            return _size;
+        }
+
+        GSTD_CONSTEXPR auto Capacity() const GSTD_NOEXCEPT -> SizeType {
+            return _chunks.Size() << ChunkShiftValue;
+        }
+
+        GSTD_CONSTEXPR auto ChunkCount() const GSTD_NOEXCEPT -> SizeType {
+            return _chunks.Size();
+        }
+
+        /**
+         * Getting contiguous elements of chunk with `index` for cache-friendly processing
+         * @param index Index of chunk
+         * @return Elements of chunk
+         */
+        GSTD_CONSTEXPR auto Chunk(const IndexType &index) -> Span<ValueType> {
+            if (index >= ChunkCount()) {
+                Panic("Chunk index out of range!");
+            }
+
+            auto begin = index << ChunkShiftValue;
+            auto size = begin >= _size ? 0 : (_size - begin < ChunkSizeValue ? _size - begin : ChunkSizeValue);
+
+            return Span<ValueType> {
+                _chunks[index],
+                size
+            };
+        }
+
+    private:
+
+        GSTD_CONSTEXPR auto InBounds(const IndexType &index) const GSTD_NOEXCEPT -> bool {
+            return index < Size();
+        }
+
+        GSTD_CONSTEXPR auto Address(const IndexType &index) const GSTD_NOEXCEPT -> ValueType * {
+            return _chunks[index >> ChunkShiftValue] + (index & ChunkMaskValue);
+        }
+
+    public:
+
+        GSTD_CONSTEXPR auto Iter() -> Iterator {
+            return Iterator {
+                *this
+            };
+        }
+
+        GSTD_CONSTEXPR auto Iter() const -> ConstIterator {
+            return ConstIterator {
+                *this
+            };
+        }
+
+    public:
+
+        GSTD_CONSTEXPR auto operator=(const StableVector &vector) -> StableVector & {
+            if (&vector == this) {
+                return *this;
+            }
+
+            Clear();
+
+            for (IndexType index = 0; index < vector._size; ++index) {
+                Append(vector[index]);
+            }
+
+            return *this;
+        }
+
+        GSTD_CONSTEXPR auto operator=(StableVector &&vector) GSTD_NOEXCEPT -> StableVector & {
+            if (&vector == this) {
+                return *this;
+            }
+
+            Clear();
+            Fit();
+
+            _chunks = std::move(vector._chunks);
+            _size = vector._size;
+            _allocator = vector._allocator;
+
+            vector._size = 0;
+
+            return *this;
+        }
+
+        GSTD_CONSTEXPR auto operator[](const IndexType &index) -> ValueType & {
+            if (!InBounds(index)) {
+                Panic("Index out of range!");
+            }
+
+            return *Address(index);
+        }
+
+        GSTD_CONSTEXPR auto operator[](const IndexType &index) const -> const ValueType & {
+            if (!InBounds(index)) {
+                Panic("Index out of range!");
+            }
+
+            return *Address(index);
+        }
+
+    private:
+
+        Vector<ValueType *> _chunks;
+
+        SizeType _size;
+
+        RawPtr<Allocator> _allocator;
+    };
+
+    namespace detail {
+
+        /**
+         * Smallest unsigned type that can hold values in [0, MaxValueV] range
+         * @tparam MaxValueV Max value
+         */
+        template<std::uint64_t MaxValueV>
+        using CompactSizeT = std::conditional_t<MaxValueV <= std::numeric_limits<std::uint8_t>::max(),
+                                                std::uint8_t,
+                                                std::conditional_t<MaxValueV <= std::numeric_limits<std::uint16_t>::max(),
+                                                                   std::uint16_t,
+                                                                   std::conditional_t<MaxValueV <= std::numeric_limits<std::uint32_t>::max(),
+                                                                                      std::uint32_t,
+                                                                                      std::uint64_t>>>;
+
+    }
+
+    /**
+     * Errors of `StaticVector` operations
+     */
+    enum class StaticVectorError {
+        Overflow,
+        OutOfRange
+    };
+
+    /**
+     * Vector with fixed capacity and inline storage. Never allocates and can be used in compile-time<br>
+     * Operations that can fail return `Optional` or `Result` instead of panic
+     * @tparam ValueT Value type
+     * @tparam CapacityV Max count of elements
+     */
+    template<typename ValueT,
+             std::uint64_t CapacityV>
+    class StaticVector {
+    public:
+
+        using ValueType = ValueT;
+
+        using SizeType = std::uint64_t;
+
+        using Iterator = RangeIterator<ValueType>;
+
+        using ConstIterator = /* @todo const? */ RangeIterator<const ValueType>;
+
+        using IndexType = std::uint64_t;
+
+        inline static constexpr SizeType CapacityValue = CapacityV;
+
+    private:
+
+        /**
+         * Type of size field, smallest type for holding `CapacityV`
+         */
+        using CompactSizeType = detail::CompactSizeT<CapacityValue>;
+
+    public:
+
+        static_assert(!std::is_reference_v<ValueType>,
+                      "`ValueType` can`t be reference type!");
+
+        static_assert(CapacityValue > 0,
+                      "`CapacityV` must be greater than zero!");
+
+    public:
+
+        GSTD_CONSTEXPR StaticVector() GSTD_NOEXCEPT
+                : _storage(),
+                  _size(0) {}
+
+        GSTD_CONSTEXPR StaticVector(InitializerList<ValueType> initializerList)
+                : StaticVector() {
+            if (initializerList.Size() > CapacityValue) {
+                Panic("Initializer list size is greater than `StaticVector` capacity!");
+            }
+
+            for (auto &value : initializerList) {
+                std::construct_at(Buffer() + _size,
+                                  value);
+                ++_size;
+            }
+        }
+
+        GSTD_CONSTEXPR StaticVector(const StaticVector &vector)
+                : StaticVector() {
+            for (IndexType index = 0; index < vector._size; ++index) {
+                std::construct_at(Buffer() + index,
+                                  vector.Buffer()[index]);
+                ++_size;
+            }
+        }
+
+        GSTD_CONSTEXPR StaticVector(StaticVector &&vector) GSTD_NOEXCEPT
+                : StaticVector() {
+            for (IndexType index = 0; index < vector._size; ++index) {
+                std::construct_at(Buffer() + index,
+                                  std::move(vector.Buffer()[index]));
+                ++_size;
+            }
+
+            vector.Clear();
+        }
+
+    public:
+
+        GSTD_CONSTEXPR ~StaticVector() GSTD_NOEXCEPT {
+            Clear();
+        }
+
+    public:
+
+        static GSTD_CONSTEXPR auto New() GSTD_NOEXCEPT -> StaticVector {
+            return StaticVector {};
+        }
+
+    public:
+
+        /**
+         * Appending new element to end of vector
+         * @tparam ArgumentsT Arguments types
+         * @param arguments Arguments for constructing element
+         * @return Reference to new element or `StaticVectorError::Overflow` if vector is full
+         */
+        template<typename... ArgumentsT>
+        GSTD_CONSTEXPR auto Append(ArgumentsT &&...arguments) -> Result<Ref<ValueType>,
+                                                                           StaticVectorError> {
+            if (Full()) {
+                return MakeErr(StaticVectorError::Overflow);
+            }
+
+            auto pointer = std::construct_at(Buffer() + _size,
+                                             std::forward<ArgumentsT>(arguments)...);
+            ++_size;
+
+            return MakeOk(MakeRef(*pointer));
+        }
+
+        /**
+         * Inserting new element before element with `index`
+         * @tparam ArgumentsT Arguments types
+         * @param index Index of new element
+         * @param arguments Arguments for constructing element
+         * @return Reference to new element or error if vector is full or index is out of range
+         */
+        template<typename... ArgumentsT>
+        GSTD_CONSTEXPR auto Insert(const IndexType &index,
+                                   ArgumentsT &&...arguments) -> Result<Ref<ValueType>,
+                                                                        StaticVectorError> {
+            if (index > _size) {
+                return MakeErr(StaticVectorError::OutOfRange);
+            }
+
+            if (Full()) {
+                return MakeErr(StaticVectorError::Overflow);
+            }
+
+            ValueType value(std::forward<ArgumentsT>(arguments)...);
+
+            RelocateN(Buffer() + index,
+                      _size - index,
+                      Buffer() + index + 1);
+
+            auto pointer = std::construct_at(Buffer() + index,
+                                             std::move(value));
+            ++_size;
+
+            return MakeOk(MakeRef(*pointer));
+        }
+
+        /**
+         * Removing element with `index` and returning it
+         * @param index Index of element
+         * @return Removed element or `None` if index is out of range
+         */
+        GSTD_CONSTEXPR auto Remove(const IndexType &index) -> Optional<ValueType> {
+            if (!InBounds(index)) {
+                return MakeNone();
+            }
+
+            ValueType value(std::move(Buffer()[index]));
+
+            std::destroy_at(Buffer() + index);
+
+            RelocateN(Buffer() + index + 1,
+                      _size - index - 1,
+                      Buffer() + index);
+
+            --_size;
+
+            return MakeSome(std::move(value));
+        }
+
+        /**
+         * Removing last element and returning it
+         * @return Last element or `None` if vector is empty
+         */
+        GSTD_CONSTEXPR auto Pop() -> Optional<ValueType> {
+            if (Empty()) {
+                return MakeNone();
+            }
+
+            --_size;
+
+            ValueType value(std::move(Buffer()[_size]));
+
+            std::destroy_at(Buffer() + _size);
+
+            return MakeSome(std::move(value));
+        }
+
+        GSTD_CONSTEXPR auto Clear() GSTD_NOEXCEPT -> void {
+            std::destroy_n(Buffer(),
+                           _size);
+
+            _size = 0;
+        }
+
+        GSTD_CONSTEXPR auto At(const IndexType &index) -> Optional<Ref<ValueType>> {
+            if (!InBounds(index)) {
+                return MakeNone();
+            }
+
+            return MakeSome(MakeRef(Buffer()[index]));
+        }
+
+        GSTD_CONSTEXPR auto At(const IndexType &index) const -> Optional<Ref<const ValueType>> {
+            if (!InBounds(index)) {
+                return MakeNone();
+            }
+
+            return MakeSome(MakeCRef(Buffer()[index]));
+        }
+
+        GSTD_CONSTEXPR auto Size() const GSTD_NOEXCEPT -> SizeType {
+            return _size;
+        }
+
+        GSTD_CONSTEXPR auto Capacity() const GSTD_NOEXCEPT -> SizeType {
+            return CapacityValue;
+        }
+
+        GSTD_CONSTEXPR auto Empty() const GSTD_NOEXCEPT -> bool {
+            return _size == 0;
+        }
+
+        GSTD_CONSTEXPR auto Full() const GSTD_NOEXCEPT -> bool {
+            return _size == CapacityValue;
+        }
+
+        GSTD_CONSTEXPR auto Data() GSTD_NOEXCEPT -> ValueType * {
+            return Buffer();
+        }
+
+        GSTD_CONSTEXPR auto Data() const GSTD_NOEXCEPT -> const ValueType * {
+            return Buffer();
+        }
+
+        GSTD_CONSTEXPR auto AsSpan() GSTD_NOEXCEPT -> Span<ValueType> {
+            return Span<ValueType> {
+                Buffer(),
+                _size
+            };
+        }
+
+        GSTD_CONSTEXPR auto AsSpan() const GSTD_NOEXCEPT -> Span<const ValueType> {
+            return Span<const ValueType> {
+                Buffer(),
+                _size
+            };
+        }
+
+    private:
+
+        GSTD_CONSTEXPR auto InBounds(const IndexType &index) const GSTD_NOEXCEPT -> bool {
+            return index < Size();
+        }
+
+        GSTD_CONSTEXPR auto Buffer() GSTD_NOEXCEPT -> ValueType * {
+            return _storage._values;
+        }
+
+        GSTD_CONSTEXPR auto Buffer() const GSTD_NOEXCEPT -> const ValueType * {
+            return _storage._values;
+        }
+
+    public:
+
+        GSTD_CONSTEXPR auto Iter() -> Iterator {
+            return Iterator {
+                Buffer(),
+                Buffer() + _size
+            };
+        }
+
+        GSTD_CONSTEXPR auto Iter() const -> ConstIterator {
+            return ConstIterator {
+                Buffer(),
+                Buffer() + _size
+            };
+        }
+
+    public:
+
+        GSTD_CONSTEXPR auto operator=(const StaticVector &vector) -> StaticVector & {
+            if (&vector == this) {
+                return *this;
+            }
+
+            Clear();
+
+            for (IndexType index = 0; index < vector._size; ++index) {
+                std::construct_at(Buffer() + index,
+                                  vector.Buffer()[index]);
+                ++_size;
+            }
+
+            return *this;
+        }
+
+        GSTD_CONSTEXPR auto operator=(StaticVector &&vector) GSTD_NOEXCEPT -> StaticVector & {
+            if (&vector == this) {
+                return *this;
+            }
+
+            Clear();
+
+            for (IndexType index = 0; index < vector._size; ++index) {
+                std::construct_at(Buffer() + index,
+                                  std::move(vector.Buffer()[index]));
+                ++_size;
+            }
+
+            vector.Clear();
+
+            return *this;
+        }
+
+        GSTD_CONSTEXPR auto operator[](const IndexType &index) -> ValueType & {
+            if (!InBounds(index)) {
+                Panic("Index out of range!");
+            }
+
+            return Buffer()[index];
+        }
+
+        GSTD_CONSTEXPR auto operator[](const IndexType &index) const -> const ValueType & {
+            if (!InBounds(index)) {
+                Panic("Index out of range!");
+            }
+
+            return Buffer()[index];
+        }
+
+        GSTD_CONSTEXPR operator Span<ValueType>() GSTD_NOEXCEPT {
+            return AsSpan();
+        }
+
+        GSTD_CONSTEXPR operator Span<const ValueType>() const GSTD_NOEXCEPT {
+            return AsSpan();
+        }
+
+    private:
+
+        /**
+         * Uninitialized storage for elements. Elements are constructed only on insertion
+         */
+        union Storage {
+
+            GSTD_CONSTEXPR Storage() GSTD_NOEXCEPT {}
+
+            GSTD_CONSTEXPR ~Storage() GSTD_NOEXCEPT {}
+
+            ValueType _values[CapacityValue];
+
+        } _storage;
+
+        CompactSizeType _size;
+    };
+
+    /**
+     * Vector with inline storage for first `InlineSizeV` elements<br>
+     * Elements are stored inside of object while they fit to inline storage and spilled to allocator otherwise
+     * @tparam ValueT Value type
+     * @tparam InlineSizeV Count of elements in inline storage
+     */
+    template<typename ValueT,
+             std::uint64_t InlineSizeV = 8>
+    class SmallVector {
+    public:
+
+        using ValueType = ValueT;
+
+        using AllocatorType = Allocator;
+
+        using SizeType = std::uint64_t;
+
+        using Iterator = RangeIterator<ValueType>;
+
+        using ConstIterator = /* @todo const? */ RangeIterator<const ValueType>;
+
+        using IndexType = std::uint64_t;
+
+        inline static constexpr SizeType InlineSizeValue = InlineSizeV;
+
+    private:
+
+        /**
+         * Type of size and capacity fields, keeps header of vector compact
+         */
+        using CompactSizeType = std::uint32_t;
+
+    public:
+
+        static_assert(!std::is_reference_v<ValueType>,
+                      "`ValueType` can`t be reference type!");
+
+        static_assert(InlineSizeValue > 0,
+                      "`InlineSizeV` must be greater than zero!");
+
+        static_assert(InlineSizeValue <= std::numeric_limits<CompactSizeType>::max(),
+                      "`InlineSizeV` is too big!");
+
+    public:
+
+        GSTD_CONSTEXPR SmallVector(RawPtr<Allocator> allocator = DefaultAllocator())
+                : _buffer(InlineBuffer()),
+                  _size(0),
+                  _capacity(InlineSizeValue),
+                  _allocator(allocator) {}
+
+        GSTD_CONSTEXPR SmallVector(InitializerList<ValueType> initializerList,
+                                   RawPtr<Allocator> allocator = DefaultAllocator())
+                : SmallVector(allocator) {
+            Reserve(initializerList.Size());
+
+            for (auto &value : initializerList) {
+                std::construct_at(_buffer + _size,
+                                  value);
+                ++_size;
+            }
+        }
+
+        GSTD_CONSTEXPR SmallVector(const SmallVector &vector)
+                : SmallVector(vector._allocator) {
+            Reserve(vector._size);
+
+            for (IndexType index = 0; index < vector._size; ++index) {
+                std::construct_at(_buffer + index,
+                                  vector._buffer[index]);
+                ++_size;
+            }
+        }
+
+        GSTD_CONSTEXPR SmallVector(SmallVector &&vector) GSTD_NOEXCEPT
+                : SmallVector(vector._allocator) {
+            Steal(vector);
+        }
+
+    public:
+
+        GSTD_CONSTEXPR ~SmallVector() GSTD_NOEXCEPT {
+            Release();
+        }
+
+    public:
+
+        static GSTD_CONSTEXPR auto New() -> SmallVector {
+            return SmallVector {};
+        }
+
+        static GSTD_CONSTEXPR auto New(RawPtr<Allocator> allocator) -> SmallVector {
+            return SmallVector {
+                allocator
+            };
+        }
+
+    public:
+
+        GSTD_CONSTEXPR auto Append(const ValueType &value) -> void {
+            Emplace(value);
+        }
+
+        GSTD_CONSTEXPR auto Append(ValueType &&value) -> void {
+            Emplace(std::move(value));
+        }
+
+        template<typename... ArgumentsT>
+        GSTD_CONSTEXPR auto Append(ArgumentsT &&...arguments) -> void {
+            Emplace(std::forward<ArgumentsT>(arguments)...);
+        }
+
+        GSTD_CONSTEXPR auto At(const IndexType &index) -> Optional<Ref<ValueType>> {
+            if (!InBounds(index)) {
+                return MakeNone();
+            }
+
+            return MakeSome(MakeRef(_buffer[index]));
+        }
+
+        GSTD_CONSTEXPR auto At(const IndexType &index) const -> Optional<Ref<const ValueType>> {
+            if (!InBounds(index)) {
+                return MakeNone();
+            }
+
+            return MakeSome(MakeCRef(_buffer[index]));
+        }
+
+        template<typename... ArgumentsT>
+        GSTD_CONSTEXPR auto Insert(const IndexType &index,
+                                   ArgumentsT &&...arguments) -> void {
+            if (index > _size) {
+                Panic("Index out of range!");
+            }
+
+            ValueType value(std::forward<ArgumentsT>(arguments)...);
+
+            if (_size >= _capacity) {
+                Reallocate(NextCapacity());
+            }
+
+            RelocateN(_buffer + index,
+                      _size - index,
+                      _buffer + index + 1);
+
+            std::construct_at(_buffer + index,
+                              std::move(value));
+            ++_size;
+        }
+
+        GSTD_CONSTEXPR auto Remove(const IndexType &index) -> void {
+            if (!InBounds(index)) {
+                Panic("Index out of range!");
+            }
+
+            std::destroy_at(_buffer + index);
+
+            RelocateN(_buffer + index + 1,
+                      _size - index - 1,
+                      _buffer + index);
+
+            --_size;
+        }
+
+        GSTD_CONSTEXPR auto Size() const GSTD_NOEXCEPT -> SizeType {
+            return _size;
+        }
+
+        GSTD_CONSTEXPR auto Capacity() const GSTD_NOEXCEPT -> SizeType {
+            return _capacity;
+        }
+
+        GSTD_CONSTEXPR auto Data() GSTD_NOEXCEPT -> ValueType * {
+            return _buffer;
+        }
+
+        GSTD_CONSTEXPR auto Data() const GSTD_NOEXCEPT -> const ValueType * {
+            return _buffer;
+        }
+
+        /**
+         * Checking that elements are stored in inline storage
+         * @return Is elements stored in inline storage
+         */
+        GSTD_CONSTEXPR auto IsInline() const GSTD_NOEXCEPT -> bool {
+            return _buffer == InlineBuffer();
+        }
+
+        GSTD_CONSTEXPR auto Reserve(const SizeType &size) -> void {
+            if (size <= _capacity) {
+                return;
+            }
+
+            Reallocate(size);
+        }
+
+        /**
+         * Shrinking capacity to size of vector. Moves elements back to inline storage if they fit in it
+         */
+        GSTD_CONSTEXPR auto Fit() -> void {
+            if (IsInline() || _size == _capacity) {
+                return;
+            }
+
+            if (_size <= InlineSizeValue) {
+                auto buffer = _buffer;
+
+                RelocateN(buffer,
+                          _size,
+                          InlineBuffer());
+
+                _allocator->Deallocate(buffer,
+                                       _capacity);
+
+                _buffer = InlineBuffer();
+                _capacity = InlineSizeValue;
+
+                return;
+            }
+
+            Reallocate(_size);
+        }
+
+        /**
+         * Changing size of vector without initializing new elements, available only for trivial types<br>
+         * New elements have indeterminate values and must be written before reading
+         * @param size New size
+         */
+        GSTD_CONSTEXPR auto ResizeUninitialized(const SizeType &size) -> void {
+            static_assert(std::is_trivial_v<ValueType>,
+                          "`ResizeUninitialized` is available only for trivial `ValueType`!");
+
+            Grow(size);
+
+            _size = size;
+        }
+
+        /**
+         * Changing size of vector with default initialization of new elements<br>
+         * Unlike `Resize` trivial elements are not zeroed
+         * @param size New size
+         */
+        GSTD_CONSTEXPR auto ResizeDefaultInit(const SizeType &size) -> void {
+            if (size < _size) {
+                std::destroy_n(_buffer + size,
+                               _size - size);
+
+                _size = size;
+
+                return;
+            }
+
+            Grow(size);
+
+            for (auto buffer = _buffer; _size < size; ++_size) {
+                ::new (static_cast<void *>(buffer + _size)) ValueType;
+            }
+        }
+
+        /**
+         * Changing size of vector with value initialization of new elements
+         * @param size New size
+         */
+        GSTD_CONSTEXPR auto Resize(const SizeType &size) -> void {
+            if (size < _size) {
+                std::destroy_n(_buffer + size,
+                               _size - size);
+
+                _size = size;
+
+                return;
+            }
+
+            Grow(size);
+
+            for (auto buffer = _buffer; _size < size; ++_size) {
+                std::construct_at(buffer + _size);
+            }
+        }
+
+        /**
+         * Appending `count` uninitialized elements and returning them for writing by producer (read, decompressor, formatter)<br>
+         * Available only for trivial types. If producer writes less elements, vector can be shrunk by `ResizeUninitialized`
+         * @param count Count of new elements
+         * @return Writable span of new elements
+         */
+        GSTD_CONSTEXPR auto AppendUninitialized(const SizeType &count) -> Span<ValueType> {
+            static_assert(std::is_trivial_v<ValueType>,
+                          "`AppendUninitialized` is available only for trivial `ValueType`!");
+
+            if (count > std::numeric_limits<SizeType>::max() - _size) {
+                Panic("`SmallVector` size overflow!");
+            }
+
+            auto size = _size;
+
+            Grow(_size + count);
+
+            _size += count;
+
+            return Span<ValueType> {
+                _buffer + size,
+                count
+            };
+        }
+
+        GSTD_CONSTEXPR auto AsSpan() GSTD_NOEXCEPT -> Span<ValueType> {
+            return Span<ValueType> {
+                _buffer,
+                _size
+            };
+        }
+
+        GSTD_CONSTEXPR auto AsSpan() const GSTD_NOEXCEPT -> Span<const ValueType> {
+            return Span<const ValueType> {
+                _buffer,
+                _size
+            };
+        }
+
+    private:
+
+        GSTD_CONSTEXPR auto InBounds(const IndexType &index) const GSTD_NOEXCEPT -> bool {
+            return index < Size();
+        }
+
+        GSTD_CONSTEXPR auto InlineBuffer() GSTD_NOEXCEPT -> ValueType * {
+            return ReinterpretCast<ValueType *>(_inline);
+        }
+
+        GSTD_CONSTEXPR auto InlineBuffer() const GSTD_NOEXCEPT -> const ValueType * {
+            return ReinterpretCast<const ValueType *>(_inline);
+        }
+
+        template<typename... ArgumentsT>
+        GSTD_CONSTEXPR auto Emplace(ArgumentsT &&...arguments) -> void {
+            if (_size >= _capacity) {
+                ValueType value(std::forward<ArgumentsT>(arguments)...);
+
+                Reallocate(NextCapacity());
+
+                std::construct_at(_buffer + _size,
+                                  std::move(value));
+                ++_size;
+
+                return;
+            }
+
+            std::construct_at(_buffer + _size,
+                              std::forward<ArgumentsT>(arguments)...);
+            ++_size;
+        }
+
+        GSTD_CONSTEXPR auto NextCapacity() const -> SizeType {
+            return StaticCast<SizeType>(_capacity) * 2;
+        }
+
+        /**
+         * Growing buffer for holding at least `size` elements with geometric growth
+         * @param size Required count of elements
+         */
+        GSTD_CONSTEXPR auto Grow(const SizeType &size) -> void {
+            if (size <= _capacity) {
+                return;
+            }
+
+            auto capacity = NextCapacity();
+
+            Reallocate(size > capacity ? size : capacity);
+        }
+
+        GSTD_CONSTEXPR auto Reallocate(const SizeType &capacity) -> void {
+            if (capacity > std::numeric_limits<CompactSizeType>::max()) {
+                Panic("`SmallVector` capacity overflow!");
+            }
+
+            auto buffer = _allocator->template Allocate<ValueType>(capacity);
+
+            RelocateN(_buffer,
+                      _size,
+                      buffer);
+
+            if (!IsInline()) {
+                _allocator->Deallocate(_buffer,
+                                       _capacity);
+            }
+
+            _buffer = buffer;
+            _capacity = StaticCast<CompactSizeType>(capacity);
+        }
+
+        /**
+         * Taking elements from other vector, other vector must be empty and inline before call
+         * @param vector Other vector
+         */
+        GSTD_CONSTEXPR auto Steal(SmallVector &vector) GSTD_NOEXCEPT -> void {
+            if (vector.IsInline()) {
+                RelocateN(vector._buffer,
+                          vector._size,
+                          _buffer);
+            } else {
+                _buffer = vector._buffer;
+                _capacity = vector._capacity;
+
+                vector._buffer = vector.InlineBuffer();
+                vector._capacity = InlineSizeValue;
+            }
+
+            _size = vector._size;
+
+            vector._size = 0;
+        }
+
+        GSTD_CONSTEXPR auto Release() GSTD_NOEXCEPT -> void {
+            std::destroy_n(_buffer,
+                           _size);
+
+            if (!IsInline()) {
+                _allocator->Deallocate(_buffer,
+                                       _capacity);
+            }
+
+            _buffer = InlineBuffer();
+            _size = 0;
+            _capacity = InlineSizeValue;
+        }
+
+    public:
+
+        GSTD_CONSTEXPR auto Iter() -> Iterator {
+            return Iterator {
+                _buffer,
+                _buffer + _size
+            };
+        }
+
+        GSTD_CONSTEXPR auto Iter() const -> ConstIterator {
+            return ConstIterator {
+                _buffer,
+                _buffer + _size
+            };
+        }
+
+    public:
+
+        GSTD_CONSTEXPR auto operator=(const SmallVector &vector) -> SmallVector & {
+            if (&vector == this) {
+                return *this;
+            }
+
+            std::destroy_n(_buffer,
+                           _size);
+            _size = 0;
+
+            Reserve(vector._size);
+
+            for (IndexType index = 0; index < vector._size; ++index) {
+                std::construct_at(_buffer + index,
+                                  vector._buffer[index]);
+                ++_size;
+            }
+
+            return *this;
+        }
+
+        GSTD_CONSTEXPR auto operator=(SmallVector &&vector) GSTD_NOEXCEPT -> SmallVector & {
+            if (&vector == this) {
+                return *this;
+            }
+
+            Release();
+
+            _allocator = vector._allocator;
+
+            Steal(vector);
+
+            return *this;
+        }
+
+        GSTD_CONSTEXPR auto operator[](const IndexType &index) -> ValueType & {
+            if (!InBounds(index)) {
+                Panic("Index out of range!");
+            }
+
+            return _buffer[index];
+        }
+
+        GSTD_CONSTEXPR auto operator[](const IndexType &index) const -> const ValueType & {
+            if (!InBounds(index)) {
+                Panic("Index out of range!");
+            }
+
+            return _buffer[index];
+        }
+
+        GSTD_CONSTEXPR auto operator[](const Slice &slice) const -> SmallVector {
+            auto bounds = slice.Resolve(_size);
+
+            SmallVector vector(_allocator);
+
+            vector.Reserve(bounds.GetCount());
+
+            for (IndexType index = 0; index < bounds.GetCount(); ++index) {
+                vector.Emplace(_buffer[bounds.GetStart() + StaticCast<Position>(index) * bounds.GetStep()]);
+            }
+
+            return vector;
+        }
+
+        GSTD_CONSTEXPR operator Span<ValueType>() GSTD_NOEXCEPT {
+            return AsSpan();
+        }
+
+        GSTD_CONSTEXPR operator Span<const ValueType>() const GSTD_NOEXCEPT {
+            return AsSpan();
+        }
+
+    private:
+
+        ValueType *_buffer;
+
+        CompactSizeType _size;
+
+        CompactSizeType _capacity;
+
+        RawPtr<Allocator> _allocator;
+
+        alignas(ValueType) Byte _inline[sizeof(ValueType) * InlineSizeValue];
+    };
+
+    /**
+     * Double-ended vector. Elements are stored contiguously with spare capacity at both ends,
+     * so pushing to front and to back is amortized O(1)<br>
+     * When one end is exhausted elements are re-centred in place or in new buffer with doubled capacity
+     * @tparam ValueT Value type
+     */
+    template<typename ValueT>
+    class Devector {
+    public:
+
+        using ValueType = ValueT;
+
+        using AllocatorType = Allocator;
+
+        using SizeType = std::uint64_t;
+
+        using Iterator = RangeIterator<ValueType>;
+
+        using ConstIterator = /* @todo const? */ RangeIterator<const ValueType>;
+
+        using IndexType = std::uint64_t;
+
+    public:
+
+        static_assert(!std::is_reference_v<ValueType>,
+                      "`ValueType` can`t be reference type!");
+
+    private:
+
+        /**
+         * Minimal capacity of buffer after first allocation
+         */
+        inline static constexpr SizeType MinCapacityValue = 8;
+
+    public:
+
+        GSTD_CONSTEXPR Devector(RawPtr<Allocator> allocator = DefaultAllocator())
+                : _buffer(nullptr),
+                  _front(0),
+                  _size(0),
+                  _capacity(0),
+                  _allocator(allocator) {}
+
+        GSTD_CONSTEXPR Devector(const Devector &devector)
+                : Devector(devector._allocator) {
+            CopyFrom(devector);
+        }
+
+        GSTD_CONSTEXPR Devector(Devector &&devector) GSTD_NOEXCEPT
+                : _buffer(devector._buffer),
+                  _front(devector._front),
+                  _size(devector._size),
+                  _capacity(devector._capacity),
+                  _allocator(devector._allocator) {
+            devector._buffer = nullptr;
+            devector._front = 0;
+            devector._size = 0;
+            devector._capacity = 0;
+        }
+
+    public:
+
+        GSTD_CONSTEXPR ~Devector() GSTD_NOEXCEPT {
+            Release();
+        }
+
+    public:
+
+        static GSTD_CONSTEXPR auto New() -> Devector {
+            return Devector {};
+        }
+
+        static GSTD_CONSTEXPR auto New(RawPtr<Allocator> allocator) -> Devector {
+            return Devector {
+                allocator
+            };
+        }
+
+    public:
+
+        template<typename... ArgumentsT>
+        GSTD_CONSTEXPR auto PushBack(ArgumentsT &&...arguments) -> ValueType & {
+            if (BackCapacity() == 0) {
+                ValueType value(std::forward<ArgumentsT>(arguments)...);
+
+                MakeRoom();
+
+                return Construct(_front + _size,
+                                 std::move(value));
+            }
+
+            return Construct(_front + _size,
+                             std::forward<ArgumentsT>(arguments)...);
+        }
+
+        template<typename... ArgumentsT>
+        GSTD_CONSTEXPR auto PushFront(ArgumentsT &&...arguments) -> ValueType & {
+            if (FrontCapacity() == 0) {
+                ValueType value(std::forward<ArgumentsT>(arguments)...);
+
+                MakeRoom();
+
+                --_front;
+
+                return Construct(_front,
+                                 std::move(value));
+            }
+
+            --_front;
+
+            return Construct(_front,
+                             std::forward<ArgumentsT>(arguments)...);
+        }
+
+        GSTD_CONSTEXPR auto PopBack() -> Optional<ValueType> {
+            if (Empty()) {
+                return MakeNone();
+            }
+
+            auto pointer = Data() + (_size - 1);
+
+            ValueType value(std::move(*pointer));
+
+            std::destroy_at(pointer);
+
+            --_size;
+
+            return MakeSome(std::move(value));
+        }
+
+        GSTD_CONSTEXPR auto PopFront() -> Optional<ValueType> {
+            if (Empty()) {
+                return MakeNone();
+            }
+
+            auto pointer = Data();
+
+            ValueType value(std::move(*pointer));
+
+            std::destroy_at(pointer);
+
+            ++_front;
+            --_size;
+
+            return MakeSome(std::move(value));
+        }
+
+        GSTD_CONSTEXPR auto At(const IndexType &index) -> Optional<Ref<ValueType>> {
+            if (!InBounds(index)) {
+                return MakeNone();
+            }
+
+            return MakeSome(MakeRef(Data()[index]));
+        }
+
+        GSTD_CONSTEXPR auto At(const IndexType &index) const -> Optional<Ref<const ValueType>> {
+            if (!InBounds(index)) {
+                return MakeNone();
+            }
+
+            return MakeSome(MakeCRef(Data()[index]));
+        }
+
+        GSTD_CONSTEXPR auto Clear() GSTD_NOEXCEPT -> void {
+            std::destroy_n(Data(),
+                           _size);
+
+            _front = _capacity / 2;
+            _size = 0;
+        }
+
+        GSTD_CONSTEXPR auto Size() const GSTD_NOEXCEPT -> SizeType {
+            return _size;
+        }
+
+        GSTD_CONSTEXPR auto Capacity() const GSTD_NOEXCEPT -> SizeType {
+            return _capacity;
+        }
+
+        GSTD_CONSTEXPR auto Empty() const GSTD_NOEXCEPT -> bool {
+            return _size == 0;
+        }
+
+        /**
+         * Getting count of free slots before first element
+         * @return Count of free slots before first element
+         */
+        GSTD_CONSTEXPR auto FrontCapacity() const GSTD_NOEXCEPT -> SizeType {
+            return _front;
+        }
+
+        /**
+         * Getting count of free slots after last element
+         * @return Count of free slots after last element
+         */
+        GSTD_CONSTEXPR auto BackCapacity() const GSTD_NOEXCEPT -> SizeType {
+            return _capacity - _front - _size;
+        }
+
+        /**
+         * Reserving buffer for at least `size` elements with elements placed in the middle of it
+         * @param size Count of elements
+         */
+        GSTD_CONSTEXPR auto Reserve(const SizeType &size) -> void {
+            if (size <= _capacity) {
+                return;
+            }
+
+            Reallocate(size);
+        }
+
+        GSTD_CONSTEXPR auto Data() GSTD_NOEXCEPT -> ValueType * {
+            return _buffer + _front;
+        }
+
+        GSTD_CONSTEXPR auto Data() const GSTD_NOEXCEPT -> const ValueType * {
+            return _buffer + _front;
+        }
+
+        GSTD_CONSTEXPR auto AsSpan() GSTD_NOEXCEPT -> Span<ValueType> {
+            return Span<ValueType> {
+                Data(),
+                _size
+            };
+        }
+
+        GSTD_CONSTEXPR auto AsSpan() const GSTD_NOEXCEPT -> Span<const ValueType> {
+            return Span<const ValueType> {
+                Data(),
+                _size
+            };
+        }
+
+    private:
+
+        GSTD_CONSTEXPR auto InBounds(const IndexType &index) const GSTD_NOEXCEPT -> bool {
+            return index < Size();
+        }
+
+        template<typename... ArgumentsT>
+        GSTD_CONSTEXPR auto Construct(const IndexType &position,
+                                      ArgumentsT &&...arguments) -> ValueType & {
+            auto pointer = std::construct_at(_buffer + position,
+                                             std::forward<ArgumentsT>(arguments)...);
+            ++_size;
+
+            return *pointer;
+        }
+
+        /**
+         * Making free slots at both ends of buffer<br>
+         * If buffer is at most half full elements are re-centred in place, otherwise buffer is doubled
+         */
+        GSTD_CONSTEXPR auto MakeRoom() -> void {
+            if (_capacity != 0 && _size < _capacity / 2) {
+                auto front = (_capacity - _size) / 2;
+
+                RelocateN(Data(),
+                          _size,
+                          _buffer + front);
+
+                _front = front;
+
+                return;
+            }
+
+            Reallocate(_capacity < MinCapacityValue ? MinCapacityValue : _capacity * 2);
+        }
+
+        GSTD_CONSTEXPR auto Reallocate(const SizeType &capacity) -> void {
+            auto buffer = _allocator->template Allocate<ValueType>(capacity);
+            auto front = (capacity - _size) / 2;
+
+            if (_buffer) {
+                RelocateN(Data(),
+                          _size,
+                          buffer + front);
+
+                _allocator->Deallocate(_buffer,
+                                       _capacity);
+            }
+
+            _buffer = buffer;
+            _front = front;
+            _capacity = capacity;
+        }
+
+        /**
+         * Copying elements of other devector to the middle of buffer, this devector must be empty before call
+         * @param devector Other devector
+         */
+        GSTD_CONSTEXPR auto CopyFrom(const Devector &devector) -> void {
+            Reserve(devector._size);
+
+            _front = (_capacity - devector._size) / 2;
+
+            for (IndexType index = 0; index < devector._size; ++index) {
+                Construct(_front + index,
+                          devector[index]);
+            }
+        }
+
+        GSTD_CONSTEXPR auto Release() GSTD_NOEXCEPT -> void {
+            if (_buffer) {
+                std::destroy_n(Data(),
+                               _size);
+
+                _allocator->Deallocate(_buffer,
+                                       _capacity);
+            }
+
+            _buffer = nullptr;
+            _front = 0;
+            _size = 0;
+            _capacity = 0;
+        }
+
+    public:
+
+        GSTD_CONSTEXPR auto Iter() -> Iterator {
+            return Iterator {
+                Data(),
+                Data() + _size
+            };
+        }
+
+        GSTD_CONSTEXPR auto Iter() const -> ConstIterator {
+            return ConstIterator {
+                Data(),
+                Data() + _size
+            };
+        }
+
+    public:
+
+        GSTD_CONSTEXPR auto operator=(const Devector &devector) -> Devector & {
+            if (&devector == this) {
+                return *this;
+            }
+
+            Clear();
+            CopyFrom(devector);
+
+            return *this;
+        }
+
+        GSTD_CONSTEXPR auto operator=(Devector &&devector) GSTD_NOEXCEPT -> Devector & {
+            if (&devector == this) {
+                return *this;
+            }
+
+            Release();
+
+            _buffer = devector._buffer;
+            _front = devector._front;
+            _size = devector._size;
+            _capacity = devector._capacity;
+            _allocator = devector._allocator;
+
+            devector._buffer = nullptr;
+            devector._front = 0;
+            devector._size = 0;
+            devector._capacity = 0;
+
+            return *this;
+        }
+
+        GSTD_CONSTEXPR auto operator[](const IndexType &index) -> ValueType & {
+            if (!InBounds(index)) {
+                Panic("Index out of range!");
+            }
+
+            return Data()[index];
+        }
+
+        GSTD_CONSTEXPR auto operator[](const IndexType &index) const -> const ValueType & {
+            if (!InBounds(index)) {
+                Panic("Index out of range!");
+            }
+
+            return Data()[index];
+        }
+
+        GSTD_CONSTEXPR operator Span<ValueType>() GSTD_NOEXCEPT {
+            return AsSpan();
+        }
+
+        GSTD_CONSTEXPR operator Span<const ValueType>() const GSTD_NOEXCEPT {
+            return AsSpan();
+        }
+
+    private:
+
+        ValueType *_buffer;
+
+        SizeType _front;
+
+        SizeType _size;
+
+        SizeType _capacity;
+
+        RawPtr<Allocator> _allocator;
+    };
+
+    /**
+     * `Devector` owns its buffer only by pointer, so it can be relocated by bytes copying
+     * @tparam ValueT Value type
+     */
+    template<typename ValueT>
+    struct IsTriviallyRelocatable<Devector<ValueT>> : TrueType {
 
     };
 
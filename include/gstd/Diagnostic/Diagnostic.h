@@ -4,5 +4,6 @@
 #include <gstd/Diagnostic/Backtrace.h>
 #include <gstd/Diagnostic/Exception.h>
 #include <gstd/Diagnostic/Panic.h>
+#include <gstd/Diagnostic/PanicFormat.h>
 
 #endif //GSTD_DIAGNOSTIC_H
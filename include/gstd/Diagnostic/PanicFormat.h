@@ -0,0 +1,61 @@
+#ifndef GSTD_PANICFORMAT_H
+#define GSTD_PANICFORMAT_H
+
+#include <cstring>
+#include <string_view>
+
+#include <gstd/Diagnostic/Panic.h>
+#include <gstd/Type/Types.h>
+
+namespace gstd {
+
+    namespace detail {
+
+        /**
+         * Size of stack buffer for panic messages. Longer messages are truncated
+         */
+        inline constexpr std::uint64_t PanicMessageSizeValue = 1024;
+
+    }
+
+    /**
+     * Replacing first `{}` in message by argument in stack buffer and panic with it. It is used by `Expect` of
+     * `Result`, `Optional` and `RawPtr`, that can`t depend on `PanicFormat<F>(...)` from Containers/FormatString.h
+     * @param format Message with `{}` for argument
+     * @param argument Argument
+     */
+    [[noreturn]] GSTD_INLINE auto PanicFormat(std::string_view format,
+                                              std::string_view argument) -> void {
+        char buffer[detail::PanicMessageSizeValue];
+        std::uint64_t size = 0;
+
+        auto write = [&buffer, &size] (std::string_view text) -> void {
+            auto count = text.size() < sizeof(buffer) - 1 - size ? text.size() : sizeof(buffer) - 1 - size;
+
+            if (count != 0) {
+                std::memcpy(buffer + size,
+                            text.data(),
+                            count);
+            }
+
+            size += count;
+        };
+
+        auto position = format.find("{}");
+
+        if (position == std::string_view::npos) {
+            write(format);
+        } else {
+            write(format.substr(0, position));
+            write(argument);
+            write(format.substr(position + 2));
+        }
+
+        buffer[size] = '\0';
+
+        Panic(buffer);
+    }
+
+}
+
+#endif //GSTD_PANICFORMAT_H
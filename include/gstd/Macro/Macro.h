@@ -71,6 +71,58 @@
     #warning "[warning] gstd/Macro/Macro.h: OS not detected!"
 #endif
 
+/*
+ *
+ * Architecture macros
+ *
+ */
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define GSTD_ARCH_X86_64
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #define GSTD_ARCH_ARM64
+#endif
+
+/*
+ *
+ * Code generation macros
+ *
+ */
+
+#if defined(__GNUC__) || defined(__clang__)
+    /**
+     * Compiling function for specified instruction sets, for example GSTD_TARGET("avx2")
+     */
+    #define GSTD_TARGET(isa) __attribute__((target(isa)))
+
+    /**
+     * Inlining all calls in function body, so inlined code is compiled with `GSTD_TARGET` of function
+     */
+    #define GSTD_FLATTEN __attribute__((flatten))
+
+    /**
+     * Forced inlining
+     */
+    #define GSTD_FORCEINLINE inline __attribute__((always_inline))
+
+    /**
+     * Prefetching cache line with address for reading
+     */
+    #define GSTD_PREFETCH(address) __builtin_prefetch(address)
+
+    /**
+     * Disabling address sanitizer for function, that reads aligned blocks after end of string.
+     * Aligned block never crosses page boundary, so such reading is safe
+     */
+    #define GSTD_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#else
+    #define GSTD_TARGET(isa)
+    #define GSTD_FLATTEN
+    #define GSTD_FORCEINLINE __forceinline
+    #define GSTD_PREFETCH(address) ((void) (address))
+    #define GSTD_NO_SANITIZE_ADDRESS
+#endif
+
 /**
  * Keyword 'explicit'
  */
@@ -1,7 +1,10 @@
 #ifndef GSTD_ALLOCATOR_H
 #define GSTD_ALLOCATOR_H
 
+#include <cstddef>
+
 #include <gstd/Containers/Span.h>
+#include <gstd/Type/Convert.h>
 
 namespace gstd {
 
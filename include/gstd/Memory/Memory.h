@@ -3,7 +3,9 @@
 
 #include <gstd/Memory/Allocator.h>
 #include <gstd/Memory/Constants.h>
+#include <gstd/Memory/MemoryOperations.h>
 #include <gstd/Memory/MemorySource.h>
 #include <gstd/Memory/RawPtr.h>
+#include <gstd/Memory/Relocate.h>
 
 #endif //GSTD_MEMORY_H
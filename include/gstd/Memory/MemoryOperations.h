@@ -0,0 +1,611 @@
+#ifndef GSTD_MEMORYOPERATIONS_H
+#define GSTD_MEMORYOPERATIONS_H
+
+#include <cstring>
+
+#include <gstd/Memory/Allocator.h>
+#include <gstd/System/Cpu.h>
+
+#if defined(GSTD_ARCH_X86_64)
+    #include <immintrin.h>
+#endif
+
+namespace gstd {
+
+    namespace detail {
+
+        /**
+         * Maximal size, that copied and filled by overlapping scalar loads and stores without loops
+         */
+        inline constexpr std::uint64_t MemorySmallSizeValue = 64;
+
+        /**
+         * Copying `size` bytes, where `SizeV <= size <= 2 * SizeV`, by two overlapping blocks<br>
+         * Both blocks are loaded before storing, so memory ranges may overlap
+         */
+        template<std::uint64_t SizeV>
+        GSTD_FORCEINLINE auto CopyEdges(Byte *destination,
+                                        const Byte *source,
+                                        std::uint64_t size) GSTD_NOEXCEPT -> void {
+            Byte head[SizeV];
+            Byte tail[SizeV];
+
+            std::memcpy(head, source, SizeV);
+            std::memcpy(tail, source + size - SizeV, SizeV);
+            std::memcpy(destination, head, SizeV);
+            std::memcpy(destination + size - SizeV, tail, SizeV);
+        }
+
+        /**
+         * Copying up to `MemorySmallSizeValue` bytes without loops. Memory ranges may overlap
+         */
+        GSTD_FORCEINLINE auto CopySmall(Byte *destination,
+                                        const Byte *source,
+                                        std::uint64_t size) GSTD_NOEXCEPT -> void {
+            if (size >= 32) {
+                CopyEdges<32>(destination, source, size);
+            } else if (size >= 16) {
+                CopyEdges<16>(destination, source, size);
+            } else if (size >= 8) {
+                CopyEdges<8>(destination, source, size);
+            } else if (size >= 4) {
+                CopyEdges<4>(destination, source, size);
+            } else if (size >= 2) {
+                CopyEdges<2>(destination, source, size);
+            } else if (size == 1) {
+                destination[0] = source[0];
+            }
+        }
+
+        /**
+         * Filling up to `MemorySmallSizeValue` bytes without loops
+         */
+        GSTD_FORCEINLINE auto FillSmall(Byte *destination,
+                                        Byte value,
+                                        std::uint64_t size) GSTD_NOEXCEPT -> void {
+            Byte pattern[32];
+
+            std::memset(pattern, value, sizeof(pattern));
+
+            if (size >= 32) {
+                std::memcpy(destination, pattern, 32);
+                std::memcpy(destination + size - 32, pattern, 32);
+            } else if (size >= 16) {
+                std::memcpy(destination, pattern, 16);
+                std::memcpy(destination + size - 16, pattern, 16);
+            } else if (size >= 8) {
+                std::memcpy(destination, pattern, 8);
+                std::memcpy(destination + size - 8, pattern, 8);
+            } else if (size >= 4) {
+                std::memcpy(destination, pattern, 4);
+                std::memcpy(destination + size - 4, pattern, 4);
+            } else {
+                for (std::uint64_t index = 0; index < size; ++index) {
+                    destination[index] = value;
+                }
+            }
+        }
+
+        /**
+         * Checking if bulk operation of `size` bytes should bypass cache by non-temporal stores
+         */
+        GSTD_INLINE auto IsNonTemporalSize(std::uint64_t size) GSTD_NOEXCEPT -> bool {
+            return size >= LastLevelCacheSize();
+        }
+
+#if defined(GSTD_ARCH_X86_64)
+
+        /*
+         * Bulk kernels take more than `MemorySmallSizeValue` bytes. Head and tail are written with unaligned stores,
+         * body is written with destination aligned stores
+         */
+
+        GSTD_TARGET("avx2")
+        inline auto CopyAVX2(Byte *destination,
+                             const Byte *source,
+                             std::uint64_t size,
+                             bool nonTemporal) GSTD_NOEXCEPT -> void {
+            auto head = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source));
+            auto tail = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + size - 32));
+            auto end = destination + size - 32;
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination), head);
+
+            auto advance = 32 - (reinterpret_cast<std::uintptr_t>(destination) & 31);
+
+            destination += advance;
+            source += advance;
+
+            if (nonTemporal) {
+                for (; destination < end; destination += 32, source += 32) {
+                    _mm256_stream_si256(reinterpret_cast<__m256i *>(destination),
+                                        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source)));
+                }
+
+                _mm_sfence();
+            } else {
+                for (; destination + 128 <= end; destination += 128, source += 128) {
+                    auto first = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source));
+                    auto second = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + 32));
+                    auto third = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + 64));
+                    auto fourth = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + 96));
+
+                    _mm256_store_si256(reinterpret_cast<__m256i *>(destination), first);
+                    _mm256_store_si256(reinterpret_cast<__m256i *>(destination + 32), second);
+                    _mm256_store_si256(reinterpret_cast<__m256i *>(destination + 64), third);
+                    _mm256_store_si256(reinterpret_cast<__m256i *>(destination + 96), fourth);
+                }
+
+                for (; destination < end; destination += 32, source += 32) {
+                    _mm256_store_si256(reinterpret_cast<__m256i *>(destination),
+                                       _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source)));
+                }
+            }
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(end), tail);
+        }
+
+        GSTD_TARGET("avx512f")
+        inline auto CopyAVX512(Byte *destination,
+                               const Byte *source,
+                               std::uint64_t size,
+                               bool nonTemporal) GSTD_NOEXCEPT -> void {
+            auto head = _mm512_loadu_si512(source);
+            auto tail = _mm512_loadu_si512(source + size - 64);
+            auto end = destination + size - 64;
+
+            _mm512_storeu_si512(destination, head);
+
+            auto advance = 64 - (reinterpret_cast<std::uintptr_t>(destination) & 63);
+
+            destination += advance;
+            source += advance;
+
+            if (nonTemporal) {
+                for (; destination < end; destination += 64, source += 64) {
+                    _mm512_stream_si512(reinterpret_cast<__m512i *>(destination),
+                                        _mm512_loadu_si512(source));
+                }
+
+                _mm_sfence();
+            } else {
+                for (; destination + 256 <= end; destination += 256, source += 256) {
+                    auto first = _mm512_loadu_si512(source);
+                    auto second = _mm512_loadu_si512(source + 64);
+                    auto third = _mm512_loadu_si512(source + 128);
+                    auto fourth = _mm512_loadu_si512(source + 192);
+
+                    _mm512_store_si512(destination, first);
+                    _mm512_store_si512(destination + 64, second);
+                    _mm512_store_si512(destination + 128, third);
+                    _mm512_store_si512(destination + 192, fourth);
+                }
+
+                for (; destination < end; destination += 64, source += 64) {
+                    _mm512_store_si512(destination,
+                                       _mm512_loadu_si512(source));
+                }
+            }
+
+            _mm512_storeu_si512(end, tail);
+        }
+
+        GSTD_TARGET("avx2")
+        inline auto FillAVX2(Byte *destination,
+                             Byte value,
+                             std::uint64_t size,
+                             bool nonTemporal) GSTD_NOEXCEPT -> void {
+            auto pattern = _mm256_set1_epi8(static_cast<char>(value));
+            auto end = destination + size - 32;
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination), pattern);
+
+            destination += 32 - (reinterpret_cast<std::uintptr_t>(destination) & 31);
+
+            if (nonTemporal) {
+                for (; destination < end; destination += 32) {
+                    _mm256_stream_si256(reinterpret_cast<__m256i *>(destination), pattern);
+                }
+
+                _mm_sfence();
+            } else {
+                for (; destination < end; destination += 32) {
+                    _mm256_store_si256(reinterpret_cast<__m256i *>(destination), pattern);
+                }
+            }
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(end), pattern);
+        }
+
+        GSTD_TARGET("avx512f")
+        inline auto FillAVX512(Byte *destination,
+                               Byte value,
+                               std::uint64_t size,
+                               bool nonTemporal) GSTD_NOEXCEPT -> void {
+            auto pattern = _mm512_set1_epi8(static_cast<char>(value));
+            auto end = destination + size - 64;
+
+            _mm512_storeu_si512(destination, pattern);
+
+            destination += 64 - (reinterpret_cast<std::uintptr_t>(destination) & 63);
+
+            if (nonTemporal) {
+                for (; destination < end; destination += 64) {
+                    _mm512_stream_si512(reinterpret_cast<__m512i *>(destination), pattern);
+                }
+
+                _mm_sfence();
+            } else {
+                for (; destination < end; destination += 64) {
+                    _mm512_store_si512(destination, pattern);
+                }
+            }
+
+            _mm512_storeu_si512(end, pattern);
+        }
+
+        GSTD_TARGET("avx2,bmi")
+        inline auto CompareAVX2(const Byte *first,
+                                const Byte *second,
+                                std::uint64_t size) GSTD_NOEXCEPT -> int {
+            std::uint64_t index = 0;
+
+            for (; index + 32 <= size; index += 32) {
+                auto equal = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(first + index)),
+                                               _mm256_loadu_si256(reinterpret_cast<const __m256i *>(second + index)));
+                auto mask = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(equal));
+
+                if (mask != 0) {
+                    auto offset = index + static_cast<std::uint64_t>(_tzcnt_u32(mask));
+
+                    return static_cast<int>(first[offset]) - static_cast<int>(second[offset]);
+                }
+            }
+
+            for (; index < size; ++index) {
+                if (first[index] != second[index]) {
+                    return static_cast<int>(first[index]) - static_cast<int>(second[index]);
+                }
+            }
+
+            return 0;
+        }
+
+        GSTD_TARGET("avx512f,avx512bw,bmi,bmi2")
+        inline auto CompareAVX512(const Byte *first,
+                                  const Byte *second,
+                                  std::uint64_t size) GSTD_NOEXCEPT -> int {
+            std::uint64_t index = 0;
+
+            for (; index + 64 <= size; index += 64) {
+                auto mask = _mm512_cmpneq_epu8_mask(_mm512_loadu_si512(first + index),
+                                                    _mm512_loadu_si512(second + index));
+
+                if (mask != 0) {
+                    auto offset = index + static_cast<std::uint64_t>(_tzcnt_u64(mask));
+
+                    return static_cast<int>(first[offset]) - static_cast<int>(second[offset]);
+                }
+            }
+
+            if (index < size) {
+                auto tail = _bzhi_u64(~0ull, static_cast<unsigned>(size - index));
+                auto mask = _mm512_mask_cmpneq_epu8_mask(tail,
+                                                         _mm512_maskz_loadu_epi8(tail, first + index),
+                                                         _mm512_maskz_loadu_epi8(tail, second + index));
+
+                if (mask != 0) {
+                    auto offset = index + static_cast<std::uint64_t>(_tzcnt_u64(mask));
+
+                    return static_cast<int>(first[offset]) - static_cast<int>(second[offset]);
+                }
+            }
+
+            return 0;
+        }
+
+        GSTD_TARGET("avx2,bmi")
+        inline auto FindAVX2(const Byte *data,
+                             std::uint64_t size,
+                             Byte value) GSTD_NOEXCEPT -> std::uint64_t {
+            auto pattern = _mm256_set1_epi8(static_cast<char>(value));
+            std::uint64_t index = 0;
+
+            for (; index + 32 <= size; index += 32) {
+                auto equal = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + index)),
+                                               pattern);
+                auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(equal));
+
+                if (mask != 0) {
+                    return index + static_cast<std::uint64_t>(_tzcnt_u32(mask));
+                }
+            }
+
+            for (; index < size; ++index) {
+                if (data[index] == value) {
+                    return index;
+                }
+            }
+
+            return size;
+        }
+
+        GSTD_TARGET("avx512f,avx512bw,bmi,bmi2")
+        inline auto FindAVX512(const Byte *data,
+                               std::uint64_t size,
+                               Byte value) GSTD_NOEXCEPT -> std::uint64_t {
+            auto pattern = _mm512_set1_epi8(static_cast<char>(value));
+            std::uint64_t index = 0;
+
+            for (; index + 64 <= size; index += 64) {
+                auto mask = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(data + index),
+                                                   pattern);
+
+                if (mask != 0) {
+                    return index + static_cast<std::uint64_t>(_tzcnt_u64(mask));
+                }
+            }
+
+            if (index < size) {
+                auto tail = _bzhi_u64(~0ull, static_cast<unsigned>(size - index));
+                auto mask = _mm512_mask_cmpeq_epi8_mask(tail,
+                                                        _mm512_maskz_loadu_epi8(tail, data + index),
+                                                        pattern);
+
+                if (mask != 0) {
+                    return index + static_cast<std::uint64_t>(_tzcnt_u64(mask));
+                }
+            }
+
+            return size;
+        }
+
+#endif
+
+    }
+
+    /**
+     * Copying `size` bytes from `source` to `destination`. Memory ranges must not overlap<br>
+     * Small sizes are copied without loops, large sizes are copied by widest available vectors
+     * and with non-temporal stores, if size is greater than last level cache
+     * @param destination Destination memory
+     * @param source Source memory
+     * @param size Count of bytes
+     */
+    GSTD_INLINE auto MemCopy(void *destination,
+                             const void *source,
+                             std::uint64_t size) GSTD_NOEXCEPT -> void {
+        auto to = static_cast<Byte *>(destination);
+        auto from = static_cast<const Byte *>(source);
+
+        if (size <= detail::MemorySmallSizeValue) {
+            detail::CopySmall(to, from, size);
+
+            return;
+        }
+
+#if defined(GSTD_ARCH_X86_64)
+        switch (CurrentSimdLevel()) {
+            case SimdLevel::AVX512:
+                detail::CopyAVX512(to, from, size, detail::IsNonTemporalSize(size));
+
+                return;
+            case SimdLevel::AVX2:
+                detail::CopyAVX2(to, from, size, detail::IsNonTemporalSize(size));
+
+                return;
+            default:
+                break;
+        }
+#endif
+
+        std::memcpy(to, from, size);
+    }
+
+    /**
+     * Copying `size` bytes from `source` to `destination`. Memory ranges may overlap
+     * @param destination Destination memory
+     * @param source Source memory
+     * @param size Count of bytes
+     */
+    GSTD_INLINE auto MemMove(void *destination,
+                             const void *source,
+                             std::uint64_t size) GSTD_NOEXCEPT -> void {
+        auto to = static_cast<Byte *>(destination);
+        auto from = static_cast<const Byte *>(source);
+
+        if (size <= detail::MemorySmallSizeValue) {
+            detail::CopySmall(to, from, size);
+
+            return;
+        }
+
+        if (to + size <= from || from + size <= to) {
+            MemCopy(to, from, size);
+
+            return;
+        }
+
+        std::memmove(to, from, size);
+    }
+
+    /**
+     * Filling `size` bytes of `destination` with `value`
+     * @param destination Destination memory
+     * @param value Value
+     * @param size Count of bytes
+     */
+    GSTD_INLINE auto MemFill(void *destination,
+                             Byte value,
+                             std::uint64_t size) GSTD_NOEXCEPT -> void {
+        auto to = static_cast<Byte *>(destination);
+
+        if (size <= detail::MemorySmallSizeValue) {
+            detail::FillSmall(to, value, size);
+
+            return;
+        }
+
+#if defined(GSTD_ARCH_X86_64)
+        switch (CurrentSimdLevel()) {
+            case SimdLevel::AVX512:
+                detail::FillAVX512(to, value, size, detail::IsNonTemporalSize(size));
+
+                return;
+            case SimdLevel::AVX2:
+                detail::FillAVX2(to, value, size, detail::IsNonTemporalSize(size));
+
+                return;
+            default:
+                break;
+        }
+#endif
+
+        std::memset(to, value, size);
+    }
+
+    /**
+     * Comparing `size` bytes lexicographically
+     * @param first First memory
+     * @param second Second memory
+     * @param size Count of bytes
+     * @return Negative value, zero or positive value, if first memory is less, equal or greater than second
+     */
+    GSTD_INLINE auto MemCompare(const void *first,
+                                const void *second,
+                                std::uint64_t size) GSTD_NOEXCEPT -> int {
+        auto left = static_cast<const Byte *>(first);
+        auto right = static_cast<const Byte *>(second);
+
+#if defined(GSTD_ARCH_X86_64)
+        switch (CurrentSimdLevel()) {
+            case SimdLevel::AVX512:
+                return detail::CompareAVX512(left, right, size);
+            case SimdLevel::AVX2:
+                return detail::CompareAVX2(left, right, size);
+            default:
+                break;
+        }
+#endif
+
+        return std::memcmp(left, right, size);
+    }
+
+    /**
+     * Finding first byte, that equal to `value`
+     * @param data Memory
+     * @param size Count of bytes
+     * @param value Value
+     * @return Index of found byte or `size`, if byte not found
+     */
+    GSTD_INLINE auto MemFind(const void *data,
+                             std::uint64_t size,
+                             Byte value) GSTD_NOEXCEPT -> std::uint64_t {
+        auto bytes = static_cast<const Byte *>(data);
+
+#if defined(GSTD_ARCH_X86_64)
+        switch (CurrentSimdLevel()) {
+            case SimdLevel::AVX512:
+                return detail::FindAVX512(bytes, size, value);
+            case SimdLevel::AVX2:
+                return detail::FindAVX2(bytes, size, value);
+            default:
+                break;
+        }
+#endif
+
+        if (size == 0) {
+            return 0;
+        }
+
+        auto found = static_cast<const Byte *>(std::memchr(bytes, value, size));
+
+        return found == nullptr ? size : static_cast<std::uint64_t>(found - bytes);
+    }
+
+    /**
+     * Copying bytes from `source` to beginning of `destination`
+     * @param destination Destination bytes, must be not smaller than `source`
+     * @param source Source bytes, must not overlap with `destination`
+     */
+    GSTD_INLINE auto MemCopy(Span<Byte> destination,
+                             Span<const Byte> source) -> void {
+        if (destination.Size() < source.Size()) {
+            Panic("Destination is smaller than source!");
+        }
+
+        MemCopy(destination.Data(),
+                source.Data(),
+                source.Size());
+    }
+
+    /**
+     * Copying bytes from `source` to beginning of `destination`
+     * @param destination Destination bytes, must be not smaller than `source`
+     * @param source Source bytes, may overlap with `destination`
+     */
+    GSTD_INLINE auto MemMove(Span<Byte> destination,
+                             Span<const Byte> source) -> void {
+        if (destination.Size() < source.Size()) {
+            Panic("Destination is smaller than source!");
+        }
+
+        MemMove(destination.Data(),
+                source.Data(),
+                source.Size());
+    }
+
+    /**
+     * Filling bytes with `value`
+     * @param destination Bytes
+     * @param value Value
+     */
+    GSTD_INLINE auto MemFill(Span<Byte> destination,
+                             Byte value) GSTD_NOEXCEPT -> void {
+        MemFill(destination.Data(),
+                value,
+                destination.Size());
+    }
+
+    /**
+     * Comparing bytes lexicographically, shorter prefix is less
+     * @param first First bytes
+     * @param second Second bytes
+     * @return Negative value, zero or positive value, if first bytes are less, equal or greater than second
+     */
+    GSTD_INLINE auto MemCompare(Span<const Byte> first,
+                                Span<const Byte> second) GSTD_NOEXCEPT -> int {
+        auto size = first.Size() < second.Size() ? first.Size() : second.Size();
+        auto result = MemCompare(first.Data(),
+                                 second.Data(),
+                                 size);
+
+        if (result != 0 || first.Size() == second.Size()) {
+            return result;
+        }
+
+        return first.Size() < second.Size() ? -1 : 1;
+    }
+
+    /**
+     * Finding first byte, that equal to `value`
+     * @param data Bytes
+     * @param value Value
+     * @return Index of found byte or `None`
+     */
+    GSTD_INLINE auto MemFind(Span<const Byte> data,
+                             Byte value) GSTD_NOEXCEPT -> Optional<std::uint64_t> {
+        auto index = MemFind(data.Data(),
+                             data.Size(),
+                             value);
+
+        if (index == data.Size()) {
+            return MakeNone();
+        }
+
+        return MakeSome(std::move(index));
+    }
+
+}
+
+#endif //GSTD_MEMORYOPERATIONS_H
@@ -1,7 +1,8 @@
 #ifndef GSTD_RAWPTR_H
 #define GSTD_RAWPTR_H
 
-#include <fmt/format.h>
+#include <gstd/Diagnostic/PanicFormat.h>
+#include <gstd/Type/Trait.h>
 
 namespace gstd {
 
@@ -50,10 +51,10 @@ namespace gstd {
             return Value() != nullptr;
         }
 
-        // TODO
         GSTD_CONSTEXPR auto Expect(std::string_view message) const -> void {
             if (!HasValue()) {
-                Panic(fmt::format("`RawPtr` failed expect some value in pointer with message '{}'!", message).c_str());
+                PanicFormat("`RawPtr` failed expect some value in pointer with message '{}'!",
+                            message);
             }
         }
 
@@ -108,6 +109,11 @@ namespace gstd {
         PointerType _pointer;
     };
 
+    template<typename ValueT>
+    struct IsTriviallyRelocatable<RawPtr<ValueT>> : TrueType {
+
+    };
+
 }
 
 #endif //GSTD_RAWPTR_H
@@ -0,0 +1,69 @@
+#ifndef GSTD_RELOCATE_H
+#define GSTD_RELOCATE_H
+
+#include <memory>
+
+#include <gstd/Memory/MemoryOperations.h>
+#include <gstd/Type/Trait.h>
+
+namespace gstd {
+
+    /**
+     * Relocating `count` objects from `source` to uninitialized memory in `destination`<br>
+     * After relocating objects in `source` are destroyed and memory in `source` is uninitialized<br>
+     * Memory ranges may overlap. Trivially relocatable types are relocated with one `MemMove`
+     * @tparam ValueT Value type
+     * @param source Source objects
+     * @param count Count of objects
+     * @param destination Uninitialized destination memory
+     */
+    template<typename ValueT>
+    GSTD_CONSTEXPR auto RelocateN(ValueT *source,
+                                  std::uint64_t count,
+                                  ValueT *destination) -> void {
+        if (count == 0 || source == destination) {
+            return;
+        }
+
+        if GSTD_CONSTEXPR (IsTriviallyRelocatableV<ValueT>) {
+            if (!std::is_constant_evaluated()) {
+                MemMove(static_cast<void *>(destination),
+                        static_cast<const void *>(source),
+                        count * sizeof(ValueT));
+
+                return;
+            }
+        }
+
+        if (destination < source) {
+            for (std::uint64_t index = 0; index < count; ++index) {
+                std::construct_at(destination + index,
+                                  std::move(source[index]));
+                std::destroy_at(source + index);
+            }
+        } else {
+            for (std::uint64_t index = count; index > 0; --index) {
+                std::construct_at(destination + (index - 1),
+                                  std::move(source[index - 1]));
+                std::destroy_at(source + (index - 1));
+            }
+        }
+    }
+
+    /**
+     * Relocating one object from `source` to uninitialized memory in `destination`
+     * @tparam ValueT Value type
+     * @param source Source object
+     * @param destination Uninitialized destination memory
+     */
+    template<typename ValueT>
+    GSTD_CONSTEXPR auto Relocate(ValueT *source,
+                                 ValueT *destination) -> void {
+        RelocateN(source,
+                  1,
+                  destination);
+    }
+
+}
+
+#endif //GSTD_RELOCATE_H
@@ -0,0 +1,511 @@
+#ifndef GSTD_ALGORITHMS_H
+#define GSTD_ALGORITHMS_H
+
+#include <algorithm>
+#include <iterator>
+
+#include <gstd/Algorithm/Sort.h>
+#include <gstd/Containers/Vector.h>
+#include <gstd/Parallel/ThreadPool.h>
+
+namespace gstd {
+
+    /**
+     * Constant for choosing grain size automatically by count of elements and threads
+     */
+    inline constexpr std::uint64_t AutoGrain = 0;
+
+    /**
+     * Mode of parallel reductions and scans
+     */
+    enum class ReduceMode : std::uint8_t {
+        /**
+         * Chunks depend on count of threads. Results of non-associative operations (floating point sum) may differ between machines
+         */
+        Fast,
+
+        /**
+         * Chunks don`t depend on count of threads and partial results are combined in fixed order, so results are reproducible
+         */
+        Deterministic
+    };
+
+    namespace detail {
+
+        /**
+         * Grain of `ReduceMode::Deterministic`, if grain is not specified
+         */
+        inline constexpr std::uint64_t DeterministicGrainValue = 16384;
+
+        /**
+         * Minimal automatic grain of elementwise algorithms, smaller chunks don`t amortize scheduling
+         */
+        inline constexpr std::uint64_t MinElementGrainValue = 2048;
+
+        /**
+         * Resolving grain: explicit grain is kept, otherwise work is split to several chunks per thread
+         * @param size Count of elements
+         * @param grain Requested grain
+         * @param minimum Minimal automatic grain
+         * @return Grain
+         */
+        GSTD_INLINE auto ResolveGrain(std::uint64_t size,
+                                      std::uint64_t grain,
+                                      std::uint64_t minimum) -> std::uint64_t {
+            if (grain != AutoGrain) {
+                return grain;
+            }
+
+            auto chunks = (GlobalThreadPool().ThreadCount() + 1) * 4;
+            auto automatic = (size + chunks - 1) / chunks;
+
+            return automatic > minimum ? automatic : minimum;
+        }
+
+        /**
+         * Running `function(begin, end)` for consecutive chunks of `[0, size)` in parallel
+         * @param size Count of elements
+         * @param grain Count of elements in chunk
+         * @param function Function
+         */
+        template<typename FunctionT>
+        auto ForEachChunk(std::uint64_t size,
+                          std::uint64_t grain,
+                          FunctionT &&function) -> void {
+            auto chunks = (size + grain - 1) / grain;
+
+            ForkJoin(GlobalThreadPool(),
+                     chunks,
+                     [size, grain, &function] (std::uint64_t chunk) {
+                auto begin = chunk * grain;
+                auto end = begin + grain < size ? begin + grain : size;
+
+                function(chunk,
+                         begin,
+                         end);
+            });
+        }
+
+        /**
+         * Finding split of stable merge on merge path diagonal (co-ranking): first `diagonal` elements of merge
+         * of sorted `first` and `second` are `i` first elements of `first` and `diagonal - i` first elements of `second`
+         * @param first First sorted run, its elements go first on ties
+         * @param firstSize Size of first run
+         * @param second Second sorted run
+         * @param secondSize Size of second run
+         * @param diagonal Count of merged elements
+         * @param compare Comparator
+         * @return Count of elements, that taken from first run
+         */
+        template<typename ValueT,
+                 typename CompareT>
+        auto MergeCoRank(const ValueT *first,
+                         std::uint64_t firstSize,
+                         const ValueT *second,
+                         std::uint64_t secondSize,
+                         std::uint64_t diagonal,
+                         CompareT &compare) -> std::uint64_t {
+            auto low = diagonal > secondSize ? diagonal - secondSize : 0;
+            auto high = diagonal < firstSize ? diagonal : firstSize;
+
+            while (low < high) {
+                auto taken = low + (high - low + 1) / 2;
+
+                if (compare(second[diagonal - taken], first[taken - 1])) {
+                    high = taken - 1;
+                } else {
+                    low = taken;
+                }
+            }
+
+            return low;
+        }
+
+    }
+
+    /**
+     * Calling `function(index)` for each index in `[begin, end)` in parallel on `GlobalThreadPool`
+     * @tparam FunctionT Function type
+     * @param begin First index
+     * @param end Index after last
+     * @param function Function
+     * @param grain Count of indices, that processed by one task
+     */
+    template<typename FunctionT>
+    auto ParallelFor(std::uint64_t begin,
+                     std::uint64_t end,
+                     FunctionT &&function,
+                     std::uint64_t grain = AutoGrain) -> void {
+        if (end <= begin) {
+            return;
+        }
+
+        auto size = end - begin;
+
+        detail::ForEachChunk(size,
+                             detail::ResolveGrain(size, grain, 1),
+                             [begin, &function] (std::uint64_t,
+                                                 std::uint64_t first,
+                                                 std::uint64_t last) {
+            for (auto index = begin + first; index < begin + last; ++index) {
+                function(index);
+            }
+        });
+    }
+
+    /**
+     * Transforming elements in parallel: `output[i] = function(input[i])`
+     * @tparam InputT Input value type
+     * @tparam OutputT Output value type
+     * @tparam FunctionT Function type
+     * @param input Input elements
+     * @param output Output elements, may be same as input
+     * @param function Function
+     * @param grain Count of elements, that processed by one task
+     */
+    template<typename InputT,
+             typename OutputT,
+             typename FunctionT>
+    auto ParallelTransform(Span<InputT> input,
+                           Span<OutputT> output,
+                           FunctionT &&function,
+                           std::uint64_t grain = AutoGrain) -> void {
+        if (input.Size() != output.Size()) {
+            Panic("Sizes of spans must be equal!");
+        }
+
+        auto size = input.Size();
+
+        detail::ForEachChunk(size,
+                             detail::ResolveGrain(size, grain, detail::MinElementGrainValue),
+                             [input, output, &function] (std::uint64_t,
+                                                         std::uint64_t first,
+                                                         std::uint64_t last) {
+            for (auto index = first; index < last; ++index) {
+                output.Data()[index] = function(input.Data()[index]);
+            }
+        });
+    }
+
+    /**
+     * Reducing elements in parallel: `operation(...operation(operation(initial, span[0]), span[1])..., span[n - 1])`<br>
+     * Operation must be associative
+     * @tparam ValueT Value type
+     * @tparam ResultT Result type
+     * @tparam OperationT Operation type
+     * @param span Elements
+     * @param initial Initial value
+     * @param operation Associative operation
+     * @param mode Reduction mode
+     * @param grain Count of elements, that processed by one task
+     * @return Result of reduction
+     */
+    template<typename ValueT,
+             typename ResultT,
+             typename OperationT>
+    auto ParallelReduce(Span<ValueT> span,
+                        ResultT initial,
+                        OperationT &&operation,
+                        ReduceMode mode = ReduceMode::Fast,
+                        std::uint64_t grain = AutoGrain) -> ResultT {
+        auto size = span.Size();
+
+        if (mode == ReduceMode::Deterministic && grain == AutoGrain) {
+            grain = detail::DeterministicGrainValue;
+        }
+
+        grain = detail::ResolveGrain(size, grain, detail::MinElementGrainValue);
+
+        Vector<Optional<ResultT>> partials;
+
+        partials.Resize((size + grain - 1) / grain);
+
+        detail::ForEachChunk(size,
+                             grain,
+                             [span, &partials, &operation] (std::uint64_t chunk,
+                                                            std::uint64_t first,
+                                                            std::uint64_t last) {
+            ResultT partial = span.Data()[first];
+
+            for (auto index = first + 1; index < last; ++index) {
+                partial = operation(std::move(partial),
+                                    span.Data()[index]);
+            }
+
+            partials[chunk] = MakeSome(std::move(partial));
+        });
+
+        auto result = std::move(initial);
+
+        for (std::uint64_t chunk = 0; chunk < partials.Size(); ++chunk) {
+            result = operation(std::move(result),
+                               std::move(partials[chunk]).Unwrap());
+        }
+
+        return result;
+    }
+
+    namespace detail {
+
+        /**
+         * Computing carry into each chunk of scan: first two passes of three-pass parallel scan
+         */
+        template<typename InputT,
+                 typename ResultT,
+                 typename OperationT>
+        auto ScanCarries(Span<InputT> input,
+                         Optional<ResultT> initial,
+                         OperationT &operation,
+                         std::uint64_t grain) -> Vector<Optional<ResultT>> {
+            auto size = input.Size();
+
+            Vector<Optional<ResultT>> carries;
+
+            carries.Resize((size + grain - 1) / grain);
+
+            ForEachChunk(size,
+                         grain,
+                         [input, &carries, &operation] (std::uint64_t chunk,
+                                                        std::uint64_t first,
+                                                        std::uint64_t last) {
+                ResultT partial = input.Data()[first];
+
+                for (auto index = first + 1; index < last; ++index) {
+                    partial = operation(std::move(partial),
+                                        input.Data()[index]);
+                }
+
+                carries[chunk] = MakeSome(std::move(partial));
+            });
+
+            auto carry = std::move(initial);
+
+            for (std::uint64_t chunk = 0; chunk < carries.Size(); ++chunk) {
+                auto partial = std::move(carries[chunk]).Unwrap();
+
+                carries[chunk] = carry;
+
+                if (carry.IsSome()) {
+                    carry = MakeSome(operation(std::move(carry).Unwrap(),
+                                               std::move(partial)));
+                } else {
+                    carry = MakeSome(std::move(partial));
+                }
+            }
+
+            return carries;
+        }
+
+    }
+
+    /**
+     * Computing inclusive scan in parallel: `output[i] = operation(output[i - 1], input[i])`, `output[0] = input[0]`<br>
+     * Operation must be associative
+     * @tparam InputT Input value type
+     * @tparam OutputT Output value type
+     * @tparam OperationT Operation type
+     * @param input Input elements
+     * @param output Output elements, may be same as input
+     * @param operation Associative operation
+     * @param mode Reduction mode
+     * @param grain Count of elements, that processed by one task
+     */
+    template<typename InputT,
+             typename OutputT,
+             typename OperationT>
+    auto ParallelInclusiveScan(Span<InputT> input,
+                               Span<OutputT> output,
+                               OperationT &&operation,
+                               ReduceMode mode = ReduceMode::Fast,
+                               std::uint64_t grain = AutoGrain) -> void {
+        using ResultType = std::remove_cv_t<OutputT>;
+
+        if (input.Size() != output.Size()) {
+            Panic("Sizes of spans must be equal!");
+        }
+
+        auto size = input.Size();
+
+        if (mode == ReduceMode::Deterministic && grain == AutoGrain) {
+            grain = detail::DeterministicGrainValue;
+        }
+
+        grain = detail::ResolveGrain(size, grain, detail::MinElementGrainValue);
+
+        auto carries = detail::ScanCarries(input,
+                                           Optional<ResultType>(),
+                                           operation,
+                                           grain);
+
+        detail::ForEachChunk(size,
+                             grain,
+                             [input, output, &carries, &operation] (std::uint64_t chunk,
+                                                                    std::uint64_t first,
+                                                                    std::uint64_t last) {
+            ResultType accumulator = carries[chunk].IsSome()
+                                     ? operation(std::move(carries[chunk]).Unwrap(),
+                                                 input.Data()[first])
+                                     : ResultType(input.Data()[first]);
+
+            output.Data()[first] = accumulator;
+
+            for (auto index = first + 1; index < last; ++index) {
+                accumulator = operation(std::move(accumulator),
+                                        input.Data()[index]);
+
+                output.Data()[index] = accumulator;
+            }
+        });
+    }
+
+    /**
+     * Computing exclusive scan in parallel: `output[i] = operation(output[i - 1], input[i - 1])`, `output[0] = initial`<br>
+     * Operation must be associative
+     * @tparam InputT Input value type
+     * @tparam OutputT Output value type
+     * @tparam OperationT Operation type
+     * @param input Input elements
+     * @param output Output elements, may be same as input
+     * @param initial Initial value
+     * @param operation Associative operation
+     * @param mode Reduction mode
+     * @param grain Count of elements, that processed by one task
+     */
+    template<typename InputT,
+             typename OutputT,
+             typename OperationT>
+    auto ParallelExclusiveScan(Span<InputT> input,
+                               Span<OutputT> output,
+                               std::remove_cv_t<OutputT> initial,
+                               OperationT &&operation,
+                               ReduceMode mode = ReduceMode::Fast,
+                               std::uint64_t grain = AutoGrain) -> void {
+        using ResultType = std::remove_cv_t<OutputT>;
+
+        if (input.Size() != output.Size()) {
+            Panic("Sizes of spans must be equal!");
+        }
+
+        auto size = input.Size();
+
+        if (mode == ReduceMode::Deterministic && grain == AutoGrain) {
+            grain = detail::DeterministicGrainValue;
+        }
+
+        grain = detail::ResolveGrain(size, grain, detail::MinElementGrainValue);
+
+        auto carries = detail::ScanCarries(input,
+                                           Optional<ResultType>(MakeSome(std::move(initial))),
+                                           operation,
+                                           grain);
+
+        detail::ForEachChunk(size,
+                             grain,
+                             [input, output, &carries, &operation] (std::uint64_t chunk,
+                                                                    std::uint64_t first,
+                                                                    std::uint64_t last) {
+            ResultType accumulator = std::move(carries[chunk]).Unwrap();
+
+            for (auto index = first; index < last; ++index) {
+                ResultType value = input.Data()[index];
+
+                output.Data()[index] = accumulator;
+
+                accumulator = operation(std::move(accumulator),
+                                        std::move(value));
+            }
+        });
+    }
+
+    /**
+     * Sorting elements in parallel: chunks are sorted independently, then sorted runs are merged pairwise.
+     * Each pass is split to pieces of `grain` output elements by merge path co-ranking, so all passes stay parallel<br>
+     * Requires default constructible elements for scratch buffer
+     * @tparam ValueT Value type
+     * @tparam CompareT Comparator type
+     * @param span Elements
+     * @param compare Comparator
+     * @param grain Count of elements in one initially sorted run
+     */
+    template<typename ValueT,
+             typename CompareT = std::less<>>
+    auto ParallelSort(Span<ValueT> span,
+                      CompareT compare = CompareT(),
+                      std::uint64_t grain = AutoGrain) -> void {
+        auto size = span.Size();
+
+        if (grain == AutoGrain) {
+            auto runs = GlobalThreadPool().ThreadCount() + 1;
+
+            grain = (size + runs - 1) / runs;
+            grain = grain > detail::MinElementGrainValue ? grain : detail::MinElementGrainValue;
+        }
+
+        if (size <= grain) {
+            Sort(span,
+                 compare);
+
+            return;
+        }
+
+        detail::ForEachChunk(size,
+                             grain,
+                             [span, &compare] (std::uint64_t,
+                                               std::uint64_t first,
+                                               std::uint64_t last) {
+            Sort(Span<ValueT>(span.Data() + first, last - first),
+                 compare);
+        });
+
+        Vector<ValueT> scratch;
+
+        scratch.ResizeDefaultInit(size);
+
+        auto source = span.Data();
+        auto destination = scratch.Data();
+
+        for (auto width = grain; width < size; width *= 2) {
+            detail::ForEachChunk(size,
+                                 grain,
+                                 [source, destination, width, size, &compare] (std::uint64_t,
+                                                                               std::uint64_t first,
+                                                                               std::uint64_t last) {
+                auto begin = first / (2 * width) * (2 * width);
+                auto middle = begin + width < size ? begin + width : size;
+                auto end = middle + width < size ? middle + width : size;
+                auto firstTaken = detail::MergeCoRank(source + begin, middle - begin,
+                                                      source + middle, end - middle,
+                                                      first - begin,
+                                                      compare);
+                auto lastTaken = detail::MergeCoRank(source + begin, middle - begin,
+                                                     source + middle, end - middle,
+                                                     last - begin,
+                                                     compare);
+
+                std::merge(std::make_move_iterator(source + begin + firstTaken),
+                           std::make_move_iterator(source + begin + lastTaken),
+                           std::make_move_iterator(source + middle + (first - begin - firstTaken)),
+                           std::make_move_iterator(source + middle + (last - begin - lastTaken)),
+                           destination + first,
+                           compare);
+            });
+
+            std::swap(source,
+                      destination);
+        }
+
+        if (source != span.Data()) {
+            auto output = span.Data();
+
+            ParallelFor(0,
+                        size,
+                        [source, output] (std::uint64_t index) {
+                output[index] = std::move(source[index]);
+            },
+                        detail::MinElementGrainValue);
+        }
+    }
+
+}
+
+#endif //GSTD_ALGORITHMS_H
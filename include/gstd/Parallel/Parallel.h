@@ -0,0 +1,7 @@
+#ifndef GSTD_PARALLEL_H
+#define GSTD_PARALLEL_H
+
+#include <gstd/Parallel/Algorithms.h>
+#include <gstd/Parallel/ThreadPool.h>
+
+#endif //GSTD_PARALLEL_H
@@ -0,0 +1,264 @@
+#ifndef GSTD_THREADPOOL_H
+#define GSTD_THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gstd/Macro/Macro.h>
+
+namespace gstd {
+
+    /**
+     * Fixed-size pool of worker threads with one shared task queue<br>
+     * Fork-join algorithms from `gstd/Parallel` run on `GlobalThreadPool` and use calling thread as additional worker
+     */
+    class ThreadPool {
+    public:
+
+        using TaskType = std::function<void()>;
+
+        using SizeType = std::uint64_t;
+
+    public:
+
+        /**
+         * Main constructor for `ThreadPool`
+         * @param threadCount Count of worker threads, may be zero
+         */
+        GSTD_EXPLICIT ThreadPool(SizeType threadCount)
+                : _stopped(false) {
+            _workers.reserve(threadCount);
+
+            for (SizeType index = 0; index < threadCount; ++index) {
+                _workers.emplace_back([this] () {
+                    Work();
+                });
+            }
+        }
+
+        ThreadPool(const ThreadPool &pool) = delete;
+
+        ThreadPool(ThreadPool &&pool) = delete;
+
+    public:
+
+        /**
+         * Destructor, that finishes all submitted tasks and joins workers
+         */
+        ~ThreadPool() {
+            {
+                std::lock_guard lock(_mutex);
+
+                _stopped = true;
+            }
+
+            _condition.notify_all();
+
+            for (auto &worker : _workers) {
+                worker.join();
+            }
+        }
+
+    public:
+
+        /**
+         * Submitting task for execution on any worker. Without workers task is executed immediately
+         * @param task Task
+         */
+        auto Submit(TaskType task) -> void {
+            if (_workers.empty()) {
+                task();
+
+                return;
+            }
+
+            {
+                std::lock_guard lock(_mutex);
+
+                _tasks.push_back(std::move(task));
+            }
+
+            _condition.notify_one();
+        }
+
+        /**
+         * Getting count of worker threads
+         * @return Count of worker threads
+         */
+        auto ThreadCount() const GSTD_NOEXCEPT -> SizeType {
+            return _workers.size();
+        }
+
+    public:
+
+        auto operator=(const ThreadPool &pool) -> ThreadPool & = delete;
+
+        auto operator=(ThreadPool &&pool) -> ThreadPool & = delete;
+
+    private:
+
+        auto Work() -> void {
+            while (true) {
+                TaskType task;
+
+                {
+                    std::unique_lock lock(_mutex);
+
+                    _condition.wait(lock,
+                                    [this] () {
+                        return _stopped || !_tasks.empty();
+                    });
+
+                    if (_tasks.empty()) {
+                        return;
+                    }
+
+                    task = std::move(_tasks.front());
+
+                    _tasks.pop_front();
+                }
+
+                task();
+            }
+        }
+
+    private:
+
+        std::vector<std::thread> _workers;
+
+        std::deque<TaskType> _tasks;
+
+        std::mutex _mutex;
+
+        std::condition_variable _condition;
+
+        bool _stopped;
+    };
+
+    /**
+     * Getting shared thread pool with one worker less than hardware threads (calling thread is the last worker)
+     * @return Shared thread pool
+     */
+    GSTD_INLINE auto GlobalThreadPool() -> ThreadPool & {
+        static ThreadPool pool([] () -> ThreadPool::SizeType {
+            auto threads = std::thread::hardware_concurrency();
+
+            return threads > 1 ? threads - 1 : 0;
+        }());
+
+        return pool;
+    }
+
+    namespace detail {
+
+        /**
+         * Shared state of one fork-join loop. Helpers, that started after all chunks were claimed, touch only this state
+         */
+        class ForkJoinState {
+        public:
+
+            using SizeType = std::uint64_t;
+
+        public:
+
+            ForkJoinState(SizeType chunkCount,
+                          const std::function<void(SizeType)> *body) GSTD_NOEXCEPT
+                    : _next(0),
+                      _finished(0),
+                      _chunkCount(chunkCount),
+                      _body(body) {}
+
+        public:
+
+            /**
+             * Claiming and running chunks, until all chunks are claimed
+             */
+            auto Run() -> void {
+                while (true) {
+                    auto chunk = _next.fetch_add(1,
+                                                 std::memory_order_relaxed);
+
+                    if (chunk >= _chunkCount) {
+                        return;
+                    }
+
+                    (*_body)(chunk);
+
+                    if (_finished.fetch_add(1,
+                                            std::memory_order_acq_rel) + 1 == _chunkCount) {
+                        _finished.notify_all();
+                    }
+                }
+            }
+
+            /**
+             * Waiting for finishing of all chunks. Only claimed chunks are waited, so waiting never depends on queued helpers
+             */
+            auto Wait() -> void {
+                auto finished = _finished.load(std::memory_order_acquire);
+
+                while (finished != _chunkCount) {
+                    _finished.wait(finished,
+                                   std::memory_order_acquire);
+
+                    finished = _finished.load(std::memory_order_acquire);
+                }
+            }
+
+        private:
+
+            std::atomic<SizeType> _next;
+
+            std::atomic<SizeType> _finished;
+
+            SizeType _chunkCount;
+
+            const std::function<void(SizeType)> *_body;
+        };
+
+        /**
+         * Running `body(chunk)` for each chunk in `[0, chunkCount)` on thread pool and calling thread
+         * @param pool Thread pool
+         * @param chunkCount Count of chunks
+         * @param body Body of loop
+         */
+        GSTD_INLINE auto ForkJoin(ThreadPool &pool,
+                                  std::uint64_t chunkCount,
+                                  const std::function<void(std::uint64_t)> &body) -> void {
+            if (chunkCount == 0) {
+                return;
+            }
+
+            if (chunkCount == 1 || pool.ThreadCount() == 0) {
+                for (std::uint64_t chunk = 0; chunk < chunkCount; ++chunk) {
+                    body(chunk);
+                }
+
+                return;
+            }
+
+            auto state = std::make_shared<ForkJoinState>(chunkCount,
+                                                         &body);
+            auto helpers = chunkCount - 1 < pool.ThreadCount() ? chunkCount - 1 : pool.ThreadCount();
+
+            for (std::uint64_t helper = 0; helper < helpers; ++helper) {
+                pool.Submit([state] () {
+                    state->Run();
+                });
+            }
+
+            state->Run();
+            state->Wait();
+        }
+
+    }
+
+}
+
+#endif //GSTD_THREADPOOL_H
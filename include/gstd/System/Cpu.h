@@ -0,0 +1,285 @@
+#ifndef GSTD_CPU_H
+#define GSTD_CPU_H
+
+#include <atomic>
+#include <cstdint>
+
+#include <gstd/Macro/Macro.h>
+
+#if defined(GSTD_ARCH_X86_64) && defined(_MSC_VER)
+    #include <intrin.h>
+#elif defined(GSTD_ARCH_X86_64)
+    #include <cpuid.h>
+#endif
+
+namespace gstd {
+
+    /**
+     * Level of SIMD instruction sets, that used by vectorized algorithms
+     */
+    enum class SimdLevel : std::uint8_t {
+        Scalar,
+        SSE2,
+        AVX2,
+        AVX512
+    };
+
+    /**
+     * Instruction set extensions of current processor
+     */
+    class CpuFeatures {
+    public:
+
+        GSTD_CONSTEXPR CpuFeatures() GSTD_NOEXCEPT
+                : _sse2(false),
+                  _sse42(false),
+                  _avx2(false),
+                  _bmi1(false),
+                  _bmi2(false),
+                  _popcnt(false),
+                  _avx512(false) {}
+
+    public:
+
+        /**
+         * Detecting features of current processor. Features, that not enabled by OS, are not reported
+         * @return Features of current processor
+         */
+        static auto Detect() GSTD_NOEXCEPT -> CpuFeatures {
+            CpuFeatures features;
+
+#if defined(GSTD_ARCH_X86_64) && (defined(__GNUC__) || defined(__clang__))
+            __builtin_cpu_init();
+
+            features._sse2 = __builtin_cpu_supports("sse2");
+            features._sse42 = __builtin_cpu_supports("sse4.2");
+            features._avx2 = __builtin_cpu_supports("avx2");
+            features._bmi1 = __builtin_cpu_supports("bmi");
+            features._bmi2 = __builtin_cpu_supports("bmi2");
+            features._popcnt = __builtin_cpu_supports("popcnt");
+            features._avx512 = __builtin_cpu_supports("avx512f")
+                               && __builtin_cpu_supports("avx512bw")
+                               && __builtin_cpu_supports("avx512vl")
+                               && __builtin_cpu_supports("avx512dq");
+#elif defined(GSTD_ARCH_X86_64) && defined(_MSC_VER)
+            int registers[4];
+
+            __cpuid(registers, 1);
+
+            auto osAvx = (registers[2] & (1 << 27)) != 0 && (registers[2] & (1 << 28)) != 0;
+            auto xcr0 = osAvx ? _xgetbv(0) : 0;
+
+            features._sse2 = (registers[3] & (1 << 26)) != 0;
+            features._sse42 = (registers[2] & (1 << 20)) != 0;
+            features._popcnt = (registers[2] & (1 << 23)) != 0;
+
+            __cpuidex(registers, 7, 0);
+
+            features._avx2 = (xcr0 & 0x6) == 0x6 && (registers[1] & (1 << 5)) != 0;
+            features._bmi1 = (registers[1] & (1 << 3)) != 0;
+            features._bmi2 = (registers[1] & (1 << 8)) != 0;
+            features._avx512 = (xcr0 & 0xe6) == 0xe6
+                               && (registers[1] & (1 << 16)) != 0
+                               && (registers[1] & (1 << 17)) != 0
+                               && (registers[1] & (1 << 30)) != 0
+                               && (registers[1] & (1 << 31)) != 0;
+#endif
+
+            return features;
+        }
+
+    public:
+
+        GSTD_CONSTEXPR auto HasSSE2() const GSTD_NOEXCEPT -> bool {
+            return _sse2;
+        }
+
+        GSTD_CONSTEXPR auto HasSSE42() const GSTD_NOEXCEPT -> bool {
+            return _sse42;
+        }
+
+        GSTD_CONSTEXPR auto HasAVX2() const GSTD_NOEXCEPT -> bool {
+            return _avx2;
+        }
+
+        GSTD_CONSTEXPR auto HasBMI1() const GSTD_NOEXCEPT -> bool {
+            return _bmi1;
+        }
+
+        GSTD_CONSTEXPR auto HasBMI2() const GSTD_NOEXCEPT -> bool {
+            return _bmi2;
+        }
+
+        GSTD_CONSTEXPR auto HasPOPCNT() const GSTD_NOEXCEPT -> bool {
+            return _popcnt;
+        }
+
+        /**
+         * Checking support of AVX-512 F, BW, VL and DQ
+         * @return Is AVX-512 supported
+         */
+        GSTD_CONSTEXPR auto HasAVX512() const GSTD_NOEXCEPT -> bool {
+            return _avx512;
+        }
+
+        /**
+         * Getting best SIMD level, that supported by processor. Kernels of AVX2 and AVX-512 levels
+         * also use BMI1, BMI2 and POPCNT (`tzcnt`, `bzhi`, `popcnt`), so these levels require them
+         * @return SIMD level
+         */
+        GSTD_CONSTEXPR auto BestSimdLevel() const GSTD_NOEXCEPT -> SimdLevel {
+            auto avx2 = _avx2 && _bmi1 && _bmi2 && _popcnt;
+
+            if (_avx512 && avx2) {
+                return SimdLevel::AVX512;
+            }
+
+            if (avx2) {
+                return SimdLevel::AVX2;
+            }
+
+            if (_sse2) {
+                return SimdLevel::SSE2;
+            }
+
+            return SimdLevel::Scalar;
+        }
+
+    private:
+
+        bool _sse2;
+
+        bool _sse42;
+
+        bool _avx2;
+
+        bool _bmi1;
+
+        bool _bmi2;
+
+        bool _popcnt;
+
+        bool _avx512;
+    };
+
+    /**
+     * Getting features of current processor, detected once
+     * @return Features of current processor
+     */
+    GSTD_INLINE auto CurrentCpuFeatures() GSTD_NOEXCEPT -> const CpuFeatures & {
+        static const auto features = CpuFeatures::Detect();
+
+        return features;
+    }
+
+    namespace detail {
+
+        inline std::atomic<SimdLevel> SimdLevelLimit = SimdLevel::AVX512;
+
+        /**
+         * Calling `cpuid` instruction
+         * @param leaf Leaf
+         * @param subleaf Subleaf
+         * @param registers Output registers EAX, EBX, ECX, EDX
+         * @return Is leaf supported
+         */
+        GSTD_INLINE auto CpuId(std::uint32_t leaf,
+                               std::uint32_t subleaf,
+                               std::uint32_t (&registers)[4]) GSTD_NOEXCEPT -> bool {
+#if defined(GSTD_ARCH_X86_64) && defined(_MSC_VER)
+            int values[4];
+
+            __cpuid(values, static_cast<int>(leaf & 0x80000000u));
+
+            if (static_cast<std::uint32_t>(values[0]) < leaf) {
+                return false;
+            }
+
+            __cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+
+            for (auto index = 0; index < 4; ++index) {
+                registers[index] = static_cast<std::uint32_t>(values[index]);
+            }
+
+            return true;
+#elif defined(GSTD_ARCH_X86_64)
+            return __get_cpuid_count(leaf, subleaf, &registers[0], &registers[1], &registers[2], &registers[3]) != 0;
+#else
+            (void) leaf;
+            (void) subleaf;
+            (void) registers;
+
+            return false;
+#endif
+        }
+
+        /**
+         * Detecting size of last level cache by deterministic cache parameters of `cpuid`
+         * @return Size of last level cache in bytes or zero, if it can`t be detected
+         */
+        GSTD_INLINE auto DetectLastLevelCacheSize() GSTD_NOEXCEPT -> std::uint64_t {
+            std::uint32_t registers[4] = {};
+            std::uint64_t size = 0;
+
+            for (auto leaf : {0x00000004u, 0x8000001du}) {
+                for (std::uint32_t subleaf = 0; subleaf < 16 && CpuId(leaf, subleaf, registers); ++subleaf) {
+                    if ((registers[0] & 0x1f) == 0) {
+                        break;
+                    }
+
+                    std::uint64_t ways = ((registers[1] >> 22) & 0x3ff) + 1;
+                    std::uint64_t partitions = ((registers[1] >> 12) & 0x3ff) + 1;
+                    std::uint64_t line = (registers[1] & 0xfff) + 1;
+                    std::uint64_t sets = static_cast<std::uint64_t>(registers[2]) + 1;
+
+                    size = ways * partitions * line * sets > size ? ways * partitions * line * sets : size;
+                }
+
+                if (size != 0) {
+                    break;
+                }
+            }
+
+            return size;
+        }
+
+    }
+
+    /**
+     * Getting size of last level cache, detected once<br>
+     * If size can`t be detected, 8 MiB is returned
+     * @return Size of last level cache in bytes
+     */
+    GSTD_INLINE auto LastLevelCacheSize() GSTD_NOEXCEPT -> std::uint64_t {
+        static const auto size = [] () -> std::uint64_t {
+            auto detected = detail::DetectLastLevelCacheSize();
+
+            return detected != 0 ? detected : 8 * 1024 * 1024;
+        }();
+
+        return size;
+    }
+
+    /**
+     * Limiting SIMD level of vectorized algorithms, for example for testing or benchmarking fallback paths
+     * @param level Maximal SIMD level
+     */
+    GSTD_INLINE auto LimitSimdLevel(SimdLevel level) GSTD_NOEXCEPT -> void {
+        detail::SimdLevelLimit.store(level,
+                                     std::memory_order_relaxed);
+    }
+
+    /**
+     * Getting SIMD level, that used by vectorized algorithms
+     * @return SIMD level
+     */
+    GSTD_INLINE auto CurrentSimdLevel() GSTD_NOEXCEPT -> SimdLevel {
+        auto best = CurrentCpuFeatures().BestSimdLevel();
+        auto limit = detail::SimdLevelLimit.load(std::memory_order_relaxed);
+
+        return best < limit ? best : limit;
+    }
+
+}
+
+#endif //GSTD_CPU_H
@@ -1,6 +1,6 @@
 #ifndef GSTD_SYSTEM_H
 #define GSTD_SYSTEM_H
 
-
+#include <gstd/System/Cpu.h>
 
 #endif //GSTD_SYSTEM_H
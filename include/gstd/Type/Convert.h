@@ -1,8 +1,12 @@
 #ifndef GSTD_CONVERT_H
 #define GSTD_CONVERT_H
 
-#include <gstd/Type/Trait.h>
 #include <string>
+#include <type_traits>
+#include <utility>
+
+#include <gstd/Type/NumberFormat.h>
+#include <gstd/Type/Trait.h>
 
 namespace gstd {
 
@@ -76,8 +80,21 @@ namespace gstd {
 
             using FromType = FromT;
 
+            /**
+             * Numbers are written into stack buffer by `WriteNumber`. `long double` is converted by `std::to_string`
+             */
             static auto Convert(FromType &&value) -> ToType {
-                return std::to_string(std::forward<FromType>(value));
+                using ValueType = std::remove_cvref_t<FromType>;
+
+                if GSTD_CONSTEXPR (std::is_arithmetic_v<ValueType> && !std::is_same_v<ValueType, long double>) {
+                    char buffer[MaxFormatSizeV<ValueType>];
+
+                    return ToType(buffer,
+                                  WriteNumber(buffer,
+                                              static_cast<ValueType>(value)));
+                } else {
+                    return std::to_string(std::forward<FromType>(value));
+                }
             }
 
         };
@@ -3,6 +3,7 @@
 
 #include <initializer_list>
 
+#include <gstd/Type/Convert.h>
 #include <gstd/Type/Types.h>
 
 namespace gstd {
@@ -5,6 +5,7 @@
 #include <gstd/Type/Pair.h>
 #include <gstd/Type/Ref.h>
 #include <gstd/Type/Result.h>
+#include <gstd/Type/Trait.h>
 
 namespace gstd {
 
@@ -632,7 +633,8 @@ namespace gstd {
          */
         GSTD_CONSTEXPR auto Expect(/* TODO: replace to gstd`s String */ std::string_view message) && -> ValueType {
             if (IsNone()) {
-                Panic(fmt::format("`Optional` failed expect `Some` with message '{}'!", message).c_str());
+                PanicFormat("`Optional` failed expect `Some` with message '{}'!",
+                            message);
             }
 
             return Storage::_some.Move();
@@ -646,7 +648,8 @@ namespace gstd {
          */
         GSTD_CONSTEXPR auto ExpectNone(/* TODO: replace to gstd`s String */ std::string_view message) && -> void {
             if (IsSome()) {
-                Panic(fmt::format("`Optional` failed expect `None` with message '{}'!", message).c_str());
+                PanicFormat("`Optional` failed expect `None` with message '{}'!",
+                            message);
             }
         }
 
@@ -1440,6 +1443,15 @@ namespace gstd {
         return Optional<ValueT>(MakeNone());
     }
 
+    /**
+     * `Optional` is trivially relocatable if its value type is trivially relocatable
+     * @tparam ValueT Value type
+     */
+    template<typename ValueT>
+    struct IsTriviallyRelocatable<Optional<ValueT>> : IsTriviallyRelocatable<ValueT> {
+
+    };
+
     /*
      * @todo Comment implementation of 'Result' methods
      */
@@ -1,7 +1,7 @@
 #ifndef GSTD_PAIR_H
 #define GSTD_PAIR_H
 
-#include <gstd/Macro/Macro.h>
+#include <gstd/Type/Trait.h>
 
 namespace gstd {
 
@@ -278,6 +278,19 @@ namespace gstd {
                                   std::forward<SecondT>(second));
     }
 
+    /**
+     * `Pair` is trivially relocatable if both of its element types are trivially relocatable
+     * @tparam FirstT First type
+     * @tparam SecondT Second type
+     */
+    template<typename FirstT,
+             typename SecondT>
+    struct IsTriviallyRelocatable<Pair<FirstT,
+                                       SecondT>> : BoolConstant<IsTriviallyRelocatableV<FirstT>
+                                                             && IsTriviallyRelocatableV<SecondT>> {
+
+    };
+
 }
 
 namespace std {
@@ -1,8 +1,11 @@
 #ifndef GSTD_REF_H
 #define GSTD_REF_H
 
+#include <functional>
 #include <type_traits>
 
+#include <gstd/Macro/Macro.h>
+
 namespace gstd {
 
     namespace detail {
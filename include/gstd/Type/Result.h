@@ -1,7 +1,11 @@
 #ifndef GSTD_RESULT_H
 #define GSTD_RESULT_H
 
-#include <fmt/format.h>
+#include <functional>
+
+#include <gstd/Diagnostic/PanicFormat.h>
+#include <gstd/Type/Ref.h>
+#include <gstd/Type/Trait.h>
 
 namespace gstd {
 
@@ -912,7 +916,8 @@ namespace gstd {
         GSTD_CONSTEXPR auto Expect(/* TODO: Replace to gstd::String */ std::string_view message) && -> ValueType {
             if (IsErr()) {
                 // TODO: create trait `Debug`
-                Panic(fmt::format("`Result` failed expect `Ok` with message '{}'!", message).c_str());
+                PanicFormat("`Result` failed expect `Ok` with message '{}'!",
+                            message);
             }
 
             return Storage::_ok.Move();
@@ -941,7 +946,8 @@ namespace gstd {
         GSTD_CONSTEXPR auto ExpectErr(/* TODO: Replace to gstd::String */ std::string_view message) && -> ErrorType {
             if (IsOk()) {
                 // TODO: `Debug` trait
-                Panic(fmt::format("`Result` failed expect `Err` with message '{}'!", message).c_str());
+                PanicFormat("`Result` failed expect `Err` with message '{}'!",
+                            message);
             }
 
             return Storage::_err.Move();
@@ -1108,6 +1114,19 @@ namespace gstd {
         };
     }
 
+    /**
+     * `Result` is trivially relocatable if its value and error types are trivially relocatable
+     * @tparam ValueT Value type
+     * @tparam ErrorT Error type
+     */
+    template<typename ValueT,
+             typename ErrorT>
+    struct IsTriviallyRelocatable<Result<ValueT,
+                                         ErrorT>> : BoolConstant<IsTriviallyRelocatableV<ValueT>
+                                                              && IsTriviallyRelocatableV<ErrorT>> {
+
+    };
+
 }
 
 #endif //GSTD_RESULT_H
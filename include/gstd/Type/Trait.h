@@ -1,6 +1,8 @@
 #ifndef GSTD_TRAIT_H
 #define GSTD_TRAIT_H
 
+#include <type_traits>
+
 #include <gstd/Type/Types.h>
 
 namespace gstd {
@@ -82,6 +84,24 @@ namespace gstd {
     GSTD_INLINE GSTD_CONSTEXPR bool IsConvertibleV = std::is_convertible_v<T,
                                                                            R>;
 
+    /**
+     * Trait for types, that can be relocated to other memory by bytes copying (`memmove`) instead of move constructing and destroying of old object<br>
+     * All trivially copyable types are trivially relocatable, other types can opt in by specialization of this trait
+     * @tparam T Type
+     */
+    template<typename T>
+    struct IsTriviallyRelocatable : BoolConstant<std::is_trivially_copyable_v<T>> {
+
+    };
+
+    template<typename T>
+    struct IsTriviallyRelocatable<const T> : IsTriviallyRelocatable<T> {
+
+    };
+
+    template<typename T>
+    GSTD_INLINE GSTD_CONSTEXPR bool IsTriviallyRelocatableV = IsTriviallyRelocatable<T>::Value;
+
     template<typename T,
              typename = void>
     struct AddReference {
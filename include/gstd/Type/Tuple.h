@@ -2,6 +2,7 @@
 #define GSTD_TUPLE_H
 
 #include <gstd/Meta/Meta.h>
+#include <gstd/Type/Trait.h>
 
 namespace gstd {
 
@@ -58,6 +59,15 @@ namespace gstd {
         };
     }
 
+    /**
+     * `Tuple` is trivially relocatable if all of its element types are trivially relocatable
+     * @tparam Types Element types
+     */
+    template<typename... Types>
+    struct IsTriviallyRelocatable<Tuple<Types...>> : BoolConstant<(IsTriviallyRelocatableV<Types> && ...)> {
+
+    };
+
     template<size_t IndexV,
              typename... Types>
     struct TupleType;
@@ -2,7 +2,9 @@
 #define GSTD_TYPES_H
 
 // TODO: remove?
+#include <compare>
 #include <cstdint>
+#include <utility>
 
 #include <gstd/Macro/Macro.h>
 
@@ -28,12 +28,14 @@
  * algorithm, async, backtrace, concurrent, container, contract, (error), io, macro, type
  */
 
+#include <gstd/Algorithm/Algorithm.h>
 #include <gstd/Containers/Containers.h>
 #include <gstd/Diagnostic/Diagnostic.h>
 #include <gstd/IO/IO.h>
 #include <gstd/Macro/Macro.h>
 #include <gstd/Memory/Memory.h>
 #include <gstd/Meta/Meta.h>
+#include <gstd/Parallel/Parallel.h>
 #include <gstd/System/System.h>
 #include <gstd/Type/Type.h>
 #include <gstd/Utils/Utils.h>
@@ -384,18 +384,11 @@ int main() {
 //    static std::shared_ptr<saservice::HttpResponse> New(std::vector<Book> books);
 //};
 //
-//struct Route {
+//using Route = gstd::StaticString<64>;
 //
-//    constexpr Route(const char *) {
-//
-//    }
-//
-//    const char *route;
-//
-//};
-//
-//inline constexpr auto operator""_route(const char *string, size_t size) -> Route {
-//    return Route { string };
+//template<gstd::StaticString StringV>
+//inline constexpr auto operator""_route() -> Route {
+//    return Route(StringV.AsRef());
 //}
 //
 //class BooksController : public saservice::HttpController {
@@ -0,0 +1,229 @@
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gstd/Algorithm/Sort.h>
+
+#include "../Test.h"
+
+namespace {
+
+    using KeyedString = std::pair<std::string, int>;
+
+    /**
+     * Integers in patterns, that are hard for quicksort: random, sorted, reversed, few distinct and organ pipe
+     */
+    auto MakeIntegers(std::mt19937_64 &random,
+                      std::uint64_t size,
+                      std::uint64_t pattern) -> std::vector<int> {
+        std::vector<int> values(size);
+
+        for (std::uint64_t index = 0; index < size; ++index) {
+            auto position = static_cast<int>(index);
+
+            switch (pattern) {
+                case 0:
+                    values[index] = static_cast<int>(random());
+                    break;
+                case 1:
+                    values[index] = position;
+                    break;
+                case 2:
+                    values[index] = static_cast<int>(size) - position;
+                    break;
+                case 3:
+                    values[index] = static_cast<int>(random() % 4);
+                    break;
+                default:
+                    values[index] = index % 2 == 0 ? position : -position;
+                    break;
+            }
+        }
+
+        return values;
+    }
+
+    auto ByteLess(const std::string &first,
+                  const std::string &second) -> bool {
+        return std::lexicographical_compare(first.begin(),
+                                            first.end(),
+                                            second.begin(),
+                                            second.end(),
+                                            [] (char left,
+                                                char right) {
+            return static_cast<unsigned char>(left) < static_cast<unsigned char>(right);
+        });
+    }
+
+    auto StringKey(const KeyedString &value) -> gstd::Span<const char> {
+        return gstd::Span<const char>(value.first.data(),
+                                      value.first.size());
+    }
+
+    auto TestSort() -> void {
+        std::mt19937_64 random(1);
+
+        for (std::uint64_t size : {0, 1, 2, 23, 24, 25, 129, 1000, 100000}) {
+            for (std::uint64_t pattern = 0; pattern < 5; ++pattern) {
+                auto values = MakeIntegers(random,
+                                           size,
+                                           pattern);
+                auto expected = values;
+
+                std::sort(expected.begin(),
+                          expected.end());
+
+                gstd::Sort(gstd::Span<int>(values.data(),
+                                           values.size()));
+
+                GSTD_CHECK(values == expected);
+
+                gstd::Sort(gstd::Span<int>(values.data(),
+                                           values.size()),
+                           std::greater<>());
+                std::sort(expected.begin(),
+                          expected.end(),
+                          std::greater<>());
+
+                GSTD_CHECK(values == expected);
+
+                std::vector<std::string> strings(size);
+
+                for (std::uint64_t index = 0; index < size; ++index) {
+                    strings[index] = std::to_string(values[index]);
+                }
+
+                auto expectedStrings = strings;
+
+                std::sort(expectedStrings.begin(),
+                          expectedStrings.end());
+
+                gstd::Sort(gstd::Span<std::string>(strings.data(),
+                                                   strings.size()));
+
+                GSTD_CHECK(strings == expectedStrings);
+            }
+        }
+    }
+
+    /**
+     * Radix sort of numbers is equal to `std::sort`, radix sort by key is equal to `std::stable_sort`
+     */
+    auto TestRadixSortNumbers() -> void {
+        std::mt19937_64 random(2);
+
+        for (std::uint64_t size : {0, 1, 2, 63, 64, 65, 1000, 100000}) {
+            for (std::uint64_t pattern = 0; pattern < 5; ++pattern) {
+                auto values = MakeIntegers(random,
+                                           size,
+                                           pattern);
+                auto expected = values;
+
+                std::sort(expected.begin(),
+                          expected.end());
+
+                gstd::RadixSort(gstd::Span<int>(values.data(),
+                                                values.size()));
+
+                GSTD_CHECK(values == expected);
+
+                std::vector<double> doubles(size);
+
+                for (std::uint64_t index = 0; index < size; ++index) {
+                    doubles[index] = static_cast<double>(values[index]) / 7.0 * (index % 3 == 0 ? -1.0 : 1.0);
+                }
+
+                auto expectedDoubles = doubles;
+
+                std::sort(expectedDoubles.begin(),
+                          expectedDoubles.end());
+
+                gstd::RadixSort(gstd::Span<double>(doubles.data(),
+                                                   doubles.size()));
+
+                GSTD_CHECK(doubles == expectedDoubles);
+
+                std::vector<std::pair<int, int>> keyed(size);
+
+                for (std::uint64_t index = 0; index < size; ++index) {
+                    keyed[index] = {values[(index * 7919) % size] % 100, static_cast<int>(index)};
+                }
+
+                auto expectedKeyed = keyed;
+
+                std::stable_sort(expectedKeyed.begin(),
+                                 expectedKeyed.end(),
+                                 [] (const std::pair<int, int> &first,
+                                     const std::pair<int, int> &second) {
+                    return first.first < second.first;
+                });
+
+                gstd::RadixSort(gstd::Span<std::pair<int, int>>(keyed.data(),
+                                                                keyed.size()),
+                                [] (const std::pair<int, int> &value) {
+                    return value.first;
+                });
+
+                GSTD_CHECK(keyed == expectedKeyed);
+            }
+        }
+    }
+
+    /**
+     * Radix sort of byte strings is stable and orders bytes as unsigned, also for long common prefixes,
+     * that are deeper than radix passes and than call stack could hold with recursion
+     */
+    auto TestRadixSortStrings() -> void {
+        std::mt19937_64 random(3);
+
+        for (std::uint64_t prefix : {0, 1, 63, 64, 65, 10000}) {
+            for (std::uint64_t size : {0, 1, 2, 70, 3000}) {
+                std::vector<KeyedString> values;
+
+                for (std::uint64_t index = 0; index < size; ++index) {
+                    std::string string(prefix, 'p');
+
+                    for (std::uint64_t length = random() % 4; length != 0; --length) {
+                        string += static_cast<char>('a' + random() % 3);
+                    }
+
+                    if (random() % 5 == 0) {
+                        string += static_cast<char>(0xff);
+                    }
+
+                    values.emplace_back(std::move(string),
+                                        static_cast<int>(index));
+                }
+
+                auto expected = values;
+
+                std::stable_sort(expected.begin(),
+                                 expected.end(),
+                                 [] (const KeyedString &first,
+                                     const KeyedString &second) {
+                    return ByteLess(first.first,
+                                    second.first);
+                });
+
+                gstd::RadixSort(gstd::Span<KeyedString>(values.data(),
+                                                        values.size()),
+                                StringKey);
+
+                GSTD_CHECK(values == expected);
+            }
+        }
+    }
+
+}
+
+int main() {
+    TestSort();
+    TestRadixSortNumbers();
+    TestRadixSortStrings();
+
+    return 0;
+}
@@ -0,0 +1,228 @@
+#include <compare>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gstd/Containers/CaseFolding.h>
+#include <gstd/System/Cpu.h>
+
+#include "../Test.h"
+
+namespace {
+
+    auto Encode(gstd::CodePoint codePoint) -> std::string {
+        char buffer[4];
+
+        return std::string(buffer,
+                           gstd::Symbol(codePoint).EncodeUtf8(buffer));
+    }
+
+    /**
+     * Code points of string after mapping by symbol, invalid byte is key after all code points
+     */
+    template<typename MappingT>
+    auto MapCodePoints(const std::string &string,
+                       MappingT &&mapping) -> std::vector<gstd::CodePoint> {
+        std::vector<gstd::CodePoint> codePoints;
+        auto data = string.data();
+        auto end = data + string.size();
+
+        while (data != end) {
+            auto decoded = gstd::detail::DecodeUtf8(data,
+                                                    end);
+
+            if (gstd::detail::IsInvalidDecoded(decoded)) {
+                codePoints.push_back(0x110000 + static_cast<std::uint8_t>(*data));
+
+                ++data;
+
+                continue;
+            }
+
+            codePoints.push_back(mapping(gstd::Symbol(decoded.First())).Value());
+
+            data += decoded.Second();
+        }
+
+        return codePoints;
+    }
+
+    /**
+     * String after mapping of each code point, invalid bytes are copied
+     */
+    template<typename MappingT>
+    auto MapString(const std::string &string,
+                   MappingT &&mapping) -> std::string {
+        std::string result;
+
+        for (auto codePoint : MapCodePoints(string,
+                                            mapping)) {
+            if (codePoint >= 0x110000) {
+                result += static_cast<char>(codePoint - 0x110000);
+            } else {
+                result += Encode(codePoint);
+            }
+        }
+
+        return result;
+    }
+
+    auto Lower(gstd::Symbol symbol) -> gstd::Symbol {
+        return gstd::ToLower(symbol);
+    }
+
+    auto Upper(gstd::Symbol symbol) -> gstd::Symbol {
+        return gstd::ToUpper(symbol);
+    }
+
+    auto Fold(gstd::Symbol symbol) -> gstd::Symbol {
+        return gstd::FoldCase(symbol);
+    }
+
+    /**
+     * Mappings of code points from Unicode data, folding is idempotent
+     */
+    auto TestSymbols() -> void {
+        static_assert(gstd::ToLower(gstd::Symbol('Q')).Value() == 'q');
+        static_assert(gstd::FoldCase(gstd::Symbol(0x212a)).Value() == 'k');
+
+        GSTD_CHECK(gstd::ToUpper(gstd::Symbol(0x3c2)).Value() == 0x3a3);
+        GSTD_CHECK(gstd::FoldCase(gstd::Symbol(0x3c2)).Value() == 0x3c3);
+        GSTD_CHECK(gstd::FoldCase(gstd::Symbol(0x1e9e)).Value() == 0xdf);
+        GSTD_CHECK(gstd::ToLower(gstd::Symbol(0x130)).Value() == 'i');
+        GSTD_CHECK(gstd::ToUpper(gstd::Symbol(0x131)).Value() == 'I');
+        GSTD_CHECK(gstd::ToLower(gstd::Symbol(0x23a)).Value() == 0x2c65);
+        GSTD_CHECK(gstd::ToLower(gstd::Symbol(0x10400)).Value() == 0x10428);
+        GSTD_CHECK(gstd::ToUpper(gstd::Symbol('7')).Value() == '7');
+
+        for (gstd::CodePoint codePoint = 0; codePoint < 0x110000; ++codePoint) {
+            auto folded = gstd::FoldCase(gstd::Symbol(codePoint));
+
+            GSTD_CHECK(gstd::FoldCase(folded) == folded);
+        }
+    }
+
+    /**
+     * Strings are compared as code points after folding, strings, that are equal ignoring case, have equal hashes,
+     * and conversion of strings is equal to conversion of each code point
+     */
+    auto TestStrings() -> void {
+        GSTD_CHECK(gstd::EqualsIgnoreCase("Kelvin", "\xe2\x84\xaa" "ELVIN"));
+        GSTD_CHECK(gstd::EqualsIgnoreCase("stra\xc3\x9f" "e", "STRA\xe1\xba\x9e" "E"));
+        GSTD_CHECK(gstd::EqualsIgnoreCase("\xcf\x83\xcf\x82", "\xce\xa3\xce\xa3"));
+        GSTD_CHECK(gstd::EqualsIgnoreCase("", ""));
+        GSTD_CHECK(!gstd::EqualsIgnoreCase("abc", "abd"));
+        GSTD_CHECK(gstd::HashIgnoreCase("Kelvin") == gstd::HashIgnoreCase("\xe2\x84\xaa" "ELVIN"));
+
+        std::mt19937_64 random(1);
+        const gstd::CodePoint pool[] = {
+            'a', 'Z', 'k', 'K', 's', 'S', 'i', 'I', '0', ' ', 0x212a, 0x17f, 0x130, 0x131, 0x23a, 0x2c65,
+            0x3a3, 0x3c3, 0x3c2, 0xdf, 0x1e9e, 0x10400, 0x10428, 0xc0, 0xe0
+        };
+        auto randomString = [&random, &pool] () {
+            std::string string;
+
+            for (auto size = random() % 80; size != 0; --size) {
+                auto kind = random() % 10;
+
+                if (kind < 5) {
+                    string += static_cast<char>('A' + random() % 58);
+                } else if (kind < 9) {
+                    string += Encode(pool[random() % std::size(pool)]);
+                } else {
+                    string += static_cast<char>(0x80 + random() % 128);
+                }
+            }
+
+            return string;
+        };
+
+        for (std::uint64_t iteration = 0; iteration < 100000; ++iteration) {
+            auto first = randomString();
+            std::string second;
+
+            switch (random() % 3) {
+                case 0:
+                    second = randomString();
+                    break;
+                case 1:
+                    second = first;
+
+                    for (auto &symbol : second) {
+                        if (((symbol | 0x20) >= 'a' && (symbol | 0x20) <= 'z') && random() % 2 == 0) {
+                            symbol ^= 0x20;
+                        }
+                    }
+
+                    break;
+                default:
+                    second = MapString(first,
+                                       Upper);
+                    break;
+            }
+
+            auto firstKeys = MapCodePoints(first,
+                                           Fold);
+            auto secondKeys = MapCodePoints(second,
+                                            Fold);
+
+            GSTD_CHECK(gstd::CompareIgnoreCase(first, second) == (firstKeys <=> secondKeys));
+            GSTD_CHECK(gstd::EqualsIgnoreCase(first, second) == (firstKeys == secondKeys));
+
+            if (firstKeys == secondKeys) {
+                GSTD_CHECK(gstd::HashIgnoreCase(first) == gstd::HashIgnoreCase(second));
+            }
+
+            auto lower = MapString(first,
+                                   Lower);
+            auto upper = MapString(first,
+                                   Upper);
+            std::vector<char> buffer(lower.size() + 3);
+            auto size = gstd::ToLower(first,
+                                      gstd::Span<char>(buffer.data(),
+                                                       buffer.size()));
+
+            GSTD_CHECK(size.IsSome());
+            GSTD_CHECK(std::string(buffer.data(),
+                                   std::move(size).Unwrap()) == lower);
+
+            if (!lower.empty()) {
+                GSTD_CHECK(gstd::ToLower(first,
+                                         gstd::Span<char>(buffer.data(),
+                                                          lower.size() - 1)).IsNone());
+            }
+
+            buffer.resize(upper.size());
+
+            GSTD_CHECK(gstd::ToUpper(first,
+                                     gstd::Span<char>(buffer.data(),
+                                                      buffer.size())).IsSome());
+            GSTD_CHECK(std::string(buffer.data(),
+                                   buffer.size()) == upper);
+
+            auto lowered = gstd::String::New(gstd::StringRef(first));
+            auto uppered = gstd::String::New(gstd::StringRef(first));
+
+            gstd::ToLower(lowered);
+            gstd::ToUpper(uppered);
+
+            GSTD_CHECK(lowered == gstd::StringRef(lower));
+            GSTD_CHECK(uppered == gstd::StringRef(upper));
+        }
+    }
+
+}
+
+int main() {
+    TestSymbols();
+
+    for (auto level : {gstd::SimdLevel::AVX512, gstd::SimdLevel::Scalar}) {
+        gstd::LimitSimdLevel(level);
+
+        TestStrings();
+    }
+
+    return 0;
+}
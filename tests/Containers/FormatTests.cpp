@@ -0,0 +1,192 @@
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+
+#include <gstd/Containers/Format.h>
+#include <gstd/Type/Convert.h>
+
+#include "../Test.h"
+
+namespace {
+
+    template<typename ValueT>
+    auto Format(ValueT value) -> std::string {
+        char buffer[64];
+        auto size = gstd::FormatTo(gstd::Span<char>(buffer,
+                                                    sizeof(buffer)),
+                                   value);
+
+        GSTD_CHECK(size.IsSome());
+
+        return std::string(buffer,
+                           std::move(size).Unwrap());
+    }
+
+    /**
+     * Count of significant digits in mantissa of number without trailing zeros
+     */
+    auto CountSignificantDigits(const std::string &number) -> std::uint64_t {
+        auto mantissa = number.substr(0,
+                                      number.find('e'));
+        std::uint64_t count = 0, trailing = 0;
+        auto started = false;
+
+        for (auto symbol : mantissa) {
+            if (symbol < '0' || symbol > '9') {
+                continue;
+            }
+
+            started = started || symbol != '0';
+
+            if (started) {
+                ++count;
+                trailing = symbol == '0' ? trailing + 1 : 0;
+            }
+        }
+
+        return count - trailing;
+    }
+
+    /**
+     * Floating point number is read back by `std::from_chars` exactly and has as many digits as shortest `std::to_chars`
+     */
+    template<typename ValueT>
+    auto CheckFloatingPoint(ValueT value) -> void {
+        auto formatted = Format(value);
+
+        if (std::isnan(value)) {
+            GSTD_CHECK(formatted == "nan");
+
+            return;
+        }
+
+        ValueT parsed {};
+        auto result = std::from_chars(formatted.data(),
+                                      formatted.data() + formatted.size(),
+                                      parsed);
+
+        GSTD_CHECK(result.ec == std::errc());
+        GSTD_CHECK(result.ptr == formatted.data() + formatted.size());
+        GSTD_CHECK(parsed == value);
+        GSTD_CHECK(std::signbit(parsed) == std::signbit(value));
+
+        char buffer[64];
+        auto shortest = std::to_chars(buffer,
+                                      buffer + sizeof(buffer),
+                                      value,
+                                      std::chars_format::scientific);
+
+        GSTD_CHECK(CountSignificantDigits(formatted) == CountSignificantDigits(std::string(buffer,
+                                                                                          shortest.ptr)));
+    }
+
+    auto TestIntegers() -> void {
+        GSTD_CHECK(Format(0) == "0");
+        GSTD_CHECK(Format(true) == "true");
+        GSTD_CHECK(Format(static_cast<short>(-32768)) == "-32768");
+        GSTD_CHECK(Format(std::numeric_limits<std::int64_t>::min()) == "-9223372036854775808");
+        GSTD_CHECK(Format(std::numeric_limits<std::uint64_t>::max()) == "18446744073709551615");
+
+        for (std::int64_t value = -100000; value < 100000; ++value) {
+            char buffer[32];
+            auto result = std::to_chars(buffer,
+                                        buffer + sizeof(buffer),
+                                        value * 99991);
+
+            GSTD_CHECK(Format(value * 99991) == std::string(buffer,
+                                                           result.ptr));
+        }
+    }
+
+    auto TestFloatingPoint() -> void {
+        GSTD_CHECK(Format(1.0) == "1");
+        GSTD_CHECK(Format(0.1) == "0.1");
+        GSTD_CHECK(Format(0.1f) == "0.1");
+        GSTD_CHECK(Format(-0.0) == "-0");
+        GSTD_CHECK(Format(1e20) == "100000000000000000000");
+        GSTD_CHECK(Format(1e21) == "1e+21");
+        GSTD_CHECK(Format(1.5e-6) == "0.0000015");
+        GSTD_CHECK(Format(1e-7) == "1e-7");
+        GSTD_CHECK(Format(5e-324) == "5e-324");
+        GSTD_CHECK(Format(std::numeric_limits<double>::infinity()) == "inf");
+
+        std::mt19937_64 random(1);
+
+        for (std::uint64_t iteration = 0; iteration < 1000000; ++iteration) {
+            auto bits = random();
+            auto bits32 = static_cast<std::uint32_t>(bits);
+            double value;
+            float value32;
+
+            std::memcpy(&value, &bits, sizeof(value));
+            std::memcpy(&value32, &bits32, sizeof(value32));
+
+            CheckFloatingPoint(value);
+            CheckFloatingPoint(value32);
+            CheckFloatingPoint(static_cast<double>(random() % 1000000) / static_cast<double>(1 + random() % 1000));
+        }
+
+        for (std::uint64_t exponent = 0; exponent < 2047; ++exponent) {
+            for (std::uint64_t mantissa : {0ull, 1ull, 2ull, 0x8000000000000ull, 0xfffffffffffffull}) {
+                auto bits = exponent << 52 | mantissa;
+                double value;
+
+                std::memcpy(&value, &bits, sizeof(value));
+
+                CheckFloatingPoint(value);
+            }
+        }
+    }
+
+    /**
+     * Too small buffer gives `None`, formatting with format string and conversion to `std::string`
+     */
+    auto TestFormatString() -> void {
+        char buffer[32];
+
+        GSTD_CHECK(gstd::FormatTo(gstd::Span<char>(buffer,
+                                                   3),
+                                  1234).IsNone());
+        GSTD_CHECK(gstd::FormatTo(gstd::Span<char>(buffer,
+                                                   3),
+                                  123).IsSome());
+
+        auto size = gstd::FormatTo<"{{{}}} {}">(gstd::Span<char>(buffer,
+                                                                 sizeof(buffer)),
+                                                7,
+                                                2.5);
+
+        GSTD_CHECK(size.IsSome());
+        GSTD_CHECK(std::string(buffer,
+                               std::move(size).Unwrap()) == "{7} 2.5");
+        GSTD_CHECK(gstd::FormatTo<"{}">(gstd::Span<char>(buffer,
+                                                         2),
+                                        123).IsNone());
+
+        GSTD_CHECK(gstd::AsString(42) == "42");
+        GSTD_CHECK(gstd::AsString(-2.5) == "-2.5");
+        GSTD_CHECK(gstd::As<std::string>(0.1f) == "0.1");
+    }
+
+    static_assert([] () {
+        char buffer[32] {};
+        auto size = gstd::FormatTo(gstd::Span<char>(buffer,
+                                                    sizeof(buffer)),
+                                   0.3);
+
+        return size.IsSome() && buffer[0] == '0' && buffer[1] == '.' && buffer[2] == '3';
+    }());
+
+}
+
+int main() {
+    TestIntegers();
+    TestFloatingPoint();
+    TestFormatString();
+
+    return 0;
+}
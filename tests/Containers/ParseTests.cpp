@@ -0,0 +1,252 @@
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <type_traits>
+
+#include <gstd/Containers/Parse.h>
+
+#include "../Test.h"
+
+namespace {
+
+    /**
+     * Result of `std::from_chars` for same string. Leading `+`, that `std::from_chars` doesn`t accept, is skipped
+     */
+    template<typename ValueT,
+             typename... ArgumentsT>
+    auto FromChars(const std::string &string,
+                   ValueT &value,
+                   const ArgumentsT &...arguments) -> std::from_chars_result {
+        auto begin = string.data();
+
+        if (!string.empty() && string[0] == '+' && (string.size() == 1 || string[1] != '-')) {
+            ++begin;
+        }
+
+        return std::from_chars(begin,
+                               string.data() + string.size(),
+                               value,
+                               arguments...);
+    }
+
+    template<typename ValueT>
+    auto CheckParsed(const std::string &string,
+                     gstd::Result<gstd::Parsed<ValueT>, gstd::ParseError> parsed,
+                     ValueT expected,
+                     std::from_chars_result result) -> void {
+        if (result.ec == std::errc()) {
+            GSTD_CHECK(parsed.IsOk());
+
+            auto value = std::move(parsed).Unwrap();
+
+            if constexpr (std::is_floating_point_v<ValueT>) {
+                using BitsType = std::conditional_t<sizeof(ValueT) == 8, std::uint64_t, std::uint32_t>;
+
+                GSTD_CHECK(std::isnan(expected) ? std::isnan(value.Value)
+                                                : std::bit_cast<BitsType>(value.Value) == std::bit_cast<BitsType>(expected));
+            } else {
+                GSTD_CHECK(value.Value == expected);
+            }
+
+            GSTD_CHECK(value.Consumed == static_cast<std::uint64_t>(result.ptr - string.data()));
+        } else if (result.ec == std::errc::result_out_of_range) {
+            if constexpr (std::is_floating_point_v<ValueT>) {
+                // `std::from_chars` reports underflow as error, parser rounds it to zero or to subnormal value
+                if (parsed.IsOk()) {
+                    GSTD_CHECK(std::fabs(std::move(parsed).Unwrap().Value) < 1e-30);
+
+                    return;
+                }
+            }
+
+            GSTD_CHECK(parsed.IsErr());
+            GSTD_CHECK(std::move(parsed).UnwrapErr() == gstd::ParseError::OutOfRange);
+        } else {
+            GSTD_CHECK(parsed.IsErr());
+        }
+    }
+
+    template<typename ValueT>
+    auto CheckDecimal(const std::string &string) -> void {
+        ValueT expected {};
+        auto result = FromChars(string,
+                                expected);
+
+        CheckParsed(string,
+                    gstd::ParsePrefix<ValueT>(string),
+                    expected,
+                    result);
+    }
+
+    template<typename ValueT>
+    auto CheckHex(const std::string &string) -> void {
+        ValueT expected {};
+        auto result = std::from_chars(string.data(),
+                                      string.data() + string.size(),
+                                      expected,
+                                      16);
+
+        CheckParsed(string,
+                    gstd::ParseHexPrefix<ValueT>(string),
+                    expected,
+                    result);
+    }
+
+    auto TestIntegers() -> void {
+        const char *strings[] = {
+            "", "+", "-", "0", "-0", "+-1", "123abc", "255", "256", "-128", "-129",
+            "9223372036854775807", "9223372036854775808", "-9223372036854775808", "-9223372036854775809",
+            "18446744073709551615", "18446744073709551616", "99999999999999999999", "1234567890123456789012345",
+            "000000000000000000000000000000012", "00000000000000000000018446744073709551615",
+            "ffffffffffffffff", "10000000000000000", "-8000000000000000", "aBcDeFg", "g"
+        };
+
+        for (std::string string : strings) {
+            CheckDecimal<std::int8_t>(string);
+            CheckDecimal<std::uint8_t>(string);
+            CheckDecimal<std::uint16_t>(string);
+            CheckDecimal<std::int32_t>(string);
+            CheckDecimal<std::int64_t>(string);
+            CheckDecimal<std::uint64_t>(string);
+            CheckHex<std::uint8_t>(string);
+            CheckHex<std::int64_t>(string);
+            CheckHex<std::uint64_t>(string);
+        }
+
+        std::mt19937_64 random(1);
+
+        for (std::uint64_t iteration = 0; iteration < 300000; ++iteration) {
+            std::string decimal = random() % 3 == 0 ? "-" : "";
+            std::string hex;
+
+            for (auto size = random() % 25; size != 0; --size) {
+                decimal += static_cast<char>('0' + random() % 10);
+                hex += "0123456789abcdefABCDEF"[random() % 22];
+            }
+
+            if (random() % 4 == 0) {
+                decimal += "x9";
+            }
+
+            CheckDecimal<std::int16_t>(decimal);
+            CheckDecimal<std::uint32_t>(decimal);
+            CheckDecimal<std::int64_t>(decimal);
+            CheckDecimal<std::uint64_t>(decimal);
+            CheckHex<std::int32_t>(hex);
+            CheckHex<std::uint64_t>(hex);
+        }
+    }
+
+    /**
+     * Floating point numbers are rounded correctly: limits, subnormal numbers, halfway cases and long significands
+     */
+    auto TestFloatingPoint() -> void {
+        const char *strings[] = {
+            "0", "-0", "1", "+1.25", "1.5", ".5", "5.", ".", "-.", "1e", "1e+", "1e5", "1E-5x",
+            "inf", "-Infinity", "infin", "nan", "NaN",
+            "1.7976931348623157e308", "1.7976931348623159e308", "1e309", "4.9e-324",
+            "2.4703282292062327e-324", "2.4703282292062328e-324", "2.2250738585072011e-308", "2.2250738585072012e-308",
+            "1e-400", "1e22", "1e23", "8.589973e9", "7.038531e-26",
+            "9007199254740993", "9007199254740992.000000000000000000000000000000001",
+            "1.00000000000000011102230246251565404236316680908203124",
+            "1.00000000000000011102230246251565404236316680908203125",
+            "1.00000000000000011102230246251565404236316680908203126",
+            "3.4028235e38", "3.4028236e38", "1.17549435e-38", "1.4e-45",
+            "0.000000000000000000000000000000000000000000000000001", "123456789012345678901234567890e-10",
+            "00000000000000000000000000000000000000000", "0.0000000000000000000000000000000000000000000000000000e99999999999",
+            "1e-99999999999999", "1e99999999999999"
+        };
+
+        for (std::string string : strings) {
+            CheckDecimal<float>(string);
+            CheckDecimal<double>(string);
+        }
+
+        std::mt19937_64 random(2);
+        char buffer[128];
+
+        for (std::uint64_t iteration = 0; iteration < 300000; ++iteration) {
+            double value;
+
+            do {
+                value = std::bit_cast<double>(random());
+            } while (!std::isfinite(value));
+
+            auto size = random() % 2 == 0 ? std::snprintf(buffer, sizeof(buffer), "%.17g", value)
+                                          : std::snprintf(buffer, sizeof(buffer), "%.*e", static_cast<int>(random() % 25), value);
+
+            CheckDecimal<float>(std::string(buffer,
+                                            size));
+            CheckDecimal<double>(std::string(buffer,
+                                             size));
+
+            std::string digits;
+
+            for (auto count = random() % 60 + 1; count != 0; --count) {
+                digits += static_cast<char>('0' + random() % 10);
+            }
+
+            if (random() % 2 == 0) {
+                digits.insert(random() % digits.size(),
+                              ".");
+            }
+
+            if (random() % 2 == 0) {
+                digits += "e" + std::to_string(static_cast<int>(random() % 700) - 350);
+            }
+
+            CheckDecimal<float>(digits);
+            CheckDecimal<double>(digits);
+        }
+
+        for (std::uint64_t iteration = 0; iteration < 100000; ++iteration) {
+            auto value = std::bit_cast<double>(random() >> 1);
+            auto next = std::nextafter(value,
+                                       INFINITY);
+
+            if (!std::isfinite(next) || value == 0) {
+                continue;
+            }
+
+            auto size = std::snprintf(buffer,
+                                      sizeof(buffer),
+                                      "%.40Le",
+                                      (static_cast<long double>(value) + next) / 2);
+
+            CheckDecimal<double>(std::string(buffer,
+                                             size));
+        }
+    }
+
+    /**
+     * Whole string must be value, errors are reported by kind
+     */
+    auto TestParse() -> void {
+        GSTD_CHECK(gstd::Parse<int>("42").IsOk());
+        GSTD_CHECK(gstd::Parse<int>("42 ").UnwrapErr() == gstd::ParseError::InvalidCharacter);
+        GSTD_CHECK(gstd::Parse<int>("").UnwrapErr() == gstd::ParseError::Empty);
+        GSTD_CHECK(gstd::Parse<int>("x").UnwrapErr() == gstd::ParseError::InvalidCharacter);
+        GSTD_CHECK(gstd::Parse<std::uint8_t>("256").UnwrapErr() == gstd::ParseError::OutOfRange);
+        GSTD_CHECK(gstd::Parse<bool>("true").Unwrap());
+        GSTD_CHECK(gstd::Parse<bool>("").IsErr());
+        GSTD_CHECK(gstd::ParsePrefix<bool>("falsex").Unwrap().Consumed == 5);
+        GSTD_CHECK(gstd::ParseHex<std::uint32_t>("DEADbeef").Unwrap() == 0xdeadbeef);
+        GSTD_CHECK(gstd::ParseHex<std::uint32_t>("beefy").IsErr());
+
+        static_assert(gstd::Parse<int>("-123").Unwrap() == -123);
+        static_assert(gstd::Parse<double>("1.5e3").Unwrap() == 1500.0);
+    }
+
+}
+
+int main() {
+    TestIntegers();
+    TestFloatingPoint();
+    TestParse();
+
+    return 0;
+}
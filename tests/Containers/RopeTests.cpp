@@ -0,0 +1,133 @@
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gstd/Containers/Rope.h>
+
+#include "../Test.h"
+
+namespace {
+
+    auto ToStdString(const gstd::Rope &rope) -> std::string {
+        std::string string;
+
+        rope.ForEachChunk([&string] (gstd::StringRef chunk) {
+            string.append(chunk.Data(),
+                          chunk.Size());
+        });
+
+        return string;
+    }
+
+    /**
+     * Random insertions, erasures and appends of substrings give same text as `std::string`,
+     * and copies of rope keep their text after rope is changed
+     */
+    auto TestEdits() -> void {
+        std::mt19937_64 random(1);
+        std::string expected(100000, 'a');
+
+        for (auto &symbol : expected) {
+            symbol = static_cast<char>('a' + random() % 26);
+        }
+
+        auto rope = gstd::Rope::New(expected);
+        std::vector<std::pair<gstd::Rope, std::string>> versions;
+
+        for (std::uint64_t iteration = 0; iteration < 20000; ++iteration) {
+            auto operation = random() % 5;
+            auto index = random() % (expected.size() + 1);
+
+            if (operation < 2) {
+                std::string piece(random() % (random() % 10 == 0 ? 3000 : 20), 'x');
+
+                for (auto &symbol : piece) {
+                    symbol = static_cast<char>('A' + random() % 26);
+                }
+
+                rope.Insert(index,
+                            piece);
+                expected.insert(index,
+                                piece);
+            } else if (operation < 4) {
+                auto count = random() % 2000;
+
+                rope.Erase(index,
+                           count);
+                expected.erase(index,
+                               count);
+            } else {
+                auto count = random() % 5000;
+                auto substring = rope.Substring(index,
+                                                count);
+
+                GSTD_CHECK(ToStdString(substring) == expected.substr(index,
+                                                                     count));
+
+                rope.Append(substring);
+                expected += expected.substr(index,
+                                            count);
+            }
+
+            GSTD_CHECK(rope.Size() == expected.size());
+
+            if (iteration % 500 == 0) {
+                GSTD_CHECK(rope.ToString() == gstd::StringRef(expected));
+
+                versions.emplace_back(rope,
+                                      expected);
+
+                if (!expected.empty()) {
+                    auto position = random() % expected.size();
+
+                    GSTD_CHECK(rope[position] == expected[position]);
+                    GSTD_CHECK(rope.At(position).IsSome());
+                }
+
+                GSTD_CHECK(rope.At(expected.size()).IsNone());
+            }
+        }
+
+        for (auto &[version, text] : versions) {
+            GSTD_CHECK(ToStdString(version) == text);
+        }
+    }
+
+    /**
+     * Appending many small pieces joins them into leaves instead of creating leaf per piece
+     */
+    auto TestSmallAppends() -> void {
+        gstd::Rope rope;
+        std::string expected;
+
+        for (std::uint64_t index = 0; index < 10000; ++index) {
+            rope += gstd::StringRef("ab");
+            expected += "ab";
+        }
+
+        std::uint64_t chunks = 0;
+
+        rope.ForEachChunk([&chunks] (gstd::StringRef) {
+            ++chunks;
+        });
+
+        GSTD_CHECK(ToStdString(rope) == expected);
+        GSTD_CHECK(chunks < 60);
+
+        std::string buffer(expected.size(), '\0');
+
+        GSTD_CHECK(rope.CopyTo(gstd::Span<char>(buffer.data(),
+                                                buffer.size())) == expected.size());
+        GSTD_CHECK(buffer == expected);
+    }
+
+}
+
+int main() {
+    TestEdits();
+    TestSmallAppends();
+
+    return 0;
+}
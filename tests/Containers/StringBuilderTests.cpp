@@ -0,0 +1,92 @@
+#include <charconv>
+#include <cstdint>
+#include <string>
+
+#include <gstd/Containers/StringBuilder.h>
+
+#include "../Test.h"
+
+namespace {
+
+    template<typename ValueT>
+    auto ToChars(ValueT value) -> std::string {
+        char buffer[64];
+        auto result = std::to_chars(buffer,
+                                    buffer + sizeof(buffer),
+                                    value);
+
+        return std::string(buffer,
+                           result.ptr);
+    }
+
+    /**
+     * Pieces larger and smaller than chunks are assembled in order
+     */
+    auto TestAppend() -> void {
+        auto builder = gstd::StringBuilder::New();
+        std::string expected;
+
+        for (std::uint64_t index = 0; index < 100000; ++index) {
+            auto piece = std::to_string(index) + (index % 1000 == 0 ? std::string(5000, 'z') : ",");
+
+            builder.Append(piece);
+            expected += piece;
+
+            if (index % 7 == 0) {
+                builder += '!';
+                expected += '!';
+            }
+        }
+
+        GSTD_CHECK(builder.Size() == expected.size());
+        GSTD_CHECK(builder.Build() == gstd::StringRef(expected));
+
+        auto moved = std::move(builder);
+
+        GSTD_CHECK(moved.Size() == expected.size());
+
+        moved.Clear();
+
+        GSTD_CHECK(moved.Empty());
+        GSTD_CHECK(moved.Build().Empty());
+    }
+
+    /**
+     * Numbers are formatted with only StringBuilder.h included, floating point in shortest form as `std::to_chars`
+     */
+    auto TestFormatTo() -> void {
+        auto builder = gstd::StringBuilder::New();
+        auto count = gstd::FormatTo<"{} + {} = {}, {}; {}">(builder,
+                                                           42,
+                                                           -1.5,
+                                                           0.1f,
+                                                           std::uint64_t(18446744073709551615u),
+                                                           gstd::StringRef("done"));
+        std::string expected = "42 + -1.5 = 0.1, 18446744073709551615; done";
+
+        GSTD_CHECK(count == expected.size());
+        GSTD_CHECK(builder.Build() == gstd::StringRef(expected));
+
+        builder.Clear();
+        expected.clear();
+
+        for (std::int64_t value = -1000000; value <= 1000000; value += 9973) {
+            auto floating = static_cast<double>(value) / 3.0;
+
+            gstd::FormatTo<"{}|{};">(builder,
+                                     value,
+                                     floating);
+            expected += ToChars(value) + "|" + ToChars(floating) + ";";
+        }
+
+        GSTD_CHECK(builder.Build() == gstd::StringRef(expected));
+    }
+
+}
+
+int main() {
+    TestAppend();
+    TestFormatTo();
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+#include <cstdint>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gstd/Containers/SymbolTable.h>
+
+#include "../Test.h"
+
+namespace {
+
+    inline constexpr gstd::StringRef FieldNames[] = {"cpu", "memory", "disk"};
+
+    inline constexpr gstd::SymbolSeeds Fields(FieldNames);
+
+    static_assert(Fields.Id("disk").Value() == 2);
+
+    /**
+     * Interning is idempotent, ids are dense and strings are stored null-terminated, also longer than one block
+     */
+    auto TestIntern() -> void {
+        auto table = gstd::SymbolTable::New(Fields);
+
+        GSTD_CHECK(table.Size() == 3);
+        GSTD_CHECK(table.Intern("disk") == Fields.Id("disk"));
+        GSTD_CHECK(table.Get(Fields.Id("disk")) == gstd::StringRef("disk"));
+
+        std::vector<std::string> strings;
+        std::vector<std::uint32_t> ids;
+
+        for (std::uint64_t index = 0; index < 100000; ++index) {
+            strings.push_back("metric." + std::to_string(index * 7919 % 1000003) + (index % 5000 == 0 ? std::string(20000, 'x') : ""));
+        }
+
+        for (auto &string : strings) {
+            ids.push_back(table.Intern(string).Value());
+        }
+
+        std::set<std::uint32_t> unique(ids.begin(),
+                                       ids.end());
+
+        GSTD_CHECK(unique.size() == strings.size());
+        GSTD_CHECK(table.Size() == strings.size() + 3);
+
+        for (std::uint64_t index = 0; index < strings.size(); ++index) {
+            auto stored = table.Get(gstd::SymbolId(ids[index]));
+
+            GSTD_CHECK(table.Intern(strings[index]).Value() == ids[index]);
+            GSTD_CHECK(stored == gstd::StringRef(strings[index]));
+            GSTD_CHECK(stored.Data()[stored.Size()] == '\0');
+        }
+
+        GSTD_CHECK(table.Find("missing").IsNone());
+        GSTD_CHECK(table.Find(strings[5]).IsSome());
+        GSTD_CHECK(table.Intern("") == table.Intern(""));
+    }
+
+    /**
+     * Threads intern overlapping strings: each string gets one id
+     */
+    auto TestConcurrentIntern() -> void {
+        gstd::SymbolTable table;
+        std::vector<std::thread> threads;
+
+        for (std::uint64_t thread = 0; thread < 8; ++thread) {
+            threads.emplace_back([&table, thread] () {
+                for (std::uint64_t index = 0; index < 50000; ++index) {
+                    auto string = "key." + std::to_string(index * (thread + 1) % 20000);
+
+                    GSTD_CHECK(table.Get(table.Intern(string)) == gstd::StringRef(string));
+                }
+            });
+        }
+
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        GSTD_CHECK(table.Size() == 20000);
+
+        std::set<std::uint32_t> unique;
+
+        for (std::uint64_t index = 0; index < 20000; ++index) {
+            unique.insert(table.Intern("key." + std::to_string(index)).Value());
+        }
+
+        GSTD_CHECK(unique.size() == 20000);
+    }
+
+}
+
+int main() {
+    TestIntern();
+    TestConcurrentIntern();
+
+    return 0;
+}
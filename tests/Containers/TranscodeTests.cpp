@@ -0,0 +1,142 @@
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include <gstd/Containers/String.h>
+#include <gstd/Containers/Transcode.h>
+#include <gstd/System/Cpu.h>
+
+#include "../Test.h"
+
+namespace {
+
+    struct Encodings {
+
+        std::string Utf8;
+
+        std::u16string Utf16;
+
+        std::u32string Utf32;
+    };
+
+    /**
+     * Random code points without surrogates, encoded by definitions of UTF-8 and UTF-16
+     */
+    auto RandomEncodings(std::mt19937_64 &random) -> Encodings {
+        Encodings encodings;
+
+        for (auto count = random() % 100; count != 0; --count) {
+            auto kind = random() % 10;
+            char32_t codePoint = kind < 5 ? random() % 0x80
+                               : kind < 7 ? 0x80 + random() % 0x780
+                               : kind < 9 ? 0x800 + random() % 0xf800
+                               : 0x10000 + random() % 0x100000;
+
+            if (codePoint >= 0xd800 && codePoint <= 0xdfff) {
+                codePoint = 'x';
+            }
+
+            encodings.Utf32 += codePoint;
+
+            if (codePoint < 0x80) {
+                encodings.Utf8 += static_cast<char>(codePoint);
+            } else if (codePoint < 0x800) {
+                encodings.Utf8 += static_cast<char>(0xc0 | (codePoint >> 6));
+                encodings.Utf8 += static_cast<char>(0x80 | (codePoint & 0x3f));
+            } else if (codePoint < 0x10000) {
+                encodings.Utf8 += static_cast<char>(0xe0 | (codePoint >> 12));
+                encodings.Utf8 += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+                encodings.Utf8 += static_cast<char>(0x80 | (codePoint & 0x3f));
+            } else {
+                encodings.Utf8 += static_cast<char>(0xf0 | (codePoint >> 18));
+                encodings.Utf8 += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3f));
+                encodings.Utf8 += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+                encodings.Utf8 += static_cast<char>(0x80 | (codePoint & 0x3f));
+            }
+
+            if (codePoint < 0x10000) {
+                encodings.Utf16 += static_cast<char16_t>(codePoint);
+            } else {
+                encodings.Utf16 += static_cast<char16_t>(0xd800 + ((codePoint - 0x10000) >> 10));
+                encodings.Utf16 += static_cast<char16_t>(0xdc00 + ((codePoint - 0x10000) & 0x3ff));
+            }
+        }
+
+        return encodings;
+    }
+
+    auto TestRoundTrip() -> void {
+        std::mt19937_64 random(1);
+
+        for (std::uint64_t iteration = 0; iteration < 20000; ++iteration) {
+            auto encodings = RandomEncodings(random);
+            gstd::StringRef utf8(encodings.Utf8);
+
+            GSTD_CHECK(gstd::String::New(encodings.Utf16) == utf8);
+            GSTD_CHECK(gstd::String::New(encodings.Utf32) == utf8);
+            GSTD_CHECK(gstd::String::New(std::wstring(encodings.Utf32.begin(),
+                                                      encodings.Utf32.end())) == utf8);
+
+            auto utf16 = gstd::ToUtf16(utf8);
+            auto utf32 = gstd::ToUtf32(utf8);
+
+            GSTD_CHECK(std::u16string(utf16.Data(),
+                                      utf16.Size()) == encodings.Utf16);
+            GSTD_CHECK(std::u32string(utf32.Data(),
+                                      utf32.Size()) == encodings.Utf32);
+        }
+    }
+
+    /**
+     * Unpaired surrogates and code points out of range are replaced by U+FFFD, so result is valid UTF-8
+     */
+    auto TestReplacement() -> void {
+        std::mt19937_64 random(2);
+
+        for (std::uint64_t iteration = 0; iteration < 20000; ++iteration) {
+            auto encodings = RandomEncodings(random);
+
+            if (!encodings.Utf16.empty()) {
+                encodings.Utf16[random() % encodings.Utf16.size()] = static_cast<char16_t>(0xd800 + random() % 0x800);
+            }
+
+            auto fromUtf16 = gstd::String::New(encodings.Utf16);
+
+            GSTD_CHECK(gstd::IsValidUtf8(fromUtf16));
+            GSTD_CHECK(fromUtf16.Size() == gstd::Utf8SizeOfUtf16(gstd::Span<const char16_t>(encodings.Utf16.data(),
+                                                                                           encodings.Utf16.size())));
+
+            auto size = encodings.Utf8.size();
+
+            encodings.Utf32 += char32_t(0x110000);
+            encodings.Utf32 += char32_t(0xdc00);
+
+            auto fromUtf32 = gstd::String::New(encodings.Utf32);
+
+            GSTD_CHECK(fromUtf32.Size() == size + 6);
+            GSTD_CHECK(gstd::StringRef(fromUtf32.Data() + size,
+                                       6) == gstd::StringRef("\xef\xbf\xbd\xef\xbf\xbd"));
+        }
+
+        GSTD_CHECK(gstd::String::New(L"h\u00e9llo \U0001f600") == gstd::StringRef("h\xc3\xa9llo \xf0\x9f\x98\x80"));
+
+        char16_t buffer[4];
+
+        GSTD_CHECK(gstd::ConvertUtf8ToUtf16("a\xf0\x9f\x98\x80",
+                                            gstd::Span<char16_t>(buffer,
+                                                                 4)) == 3);
+        GSTD_CHECK(buffer[1] == 0xd83d && buffer[2] == 0xde00);
+    }
+
+}
+
+int main() {
+    for (auto level : {gstd::SimdLevel::AVX512, gstd::SimdLevel::Scalar}) {
+        gstd::LimitSimdLevel(level);
+
+        TestRoundTrip();
+        TestReplacement();
+    }
+
+    return 0;
+}
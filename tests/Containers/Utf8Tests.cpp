@@ -0,0 +1,222 @@
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gstd/Containers/String.h>
+#include <gstd/Containers/Utf8.h>
+#include <gstd/System/Cpu.h>
+
+#include "../Test.h"
+
+namespace {
+
+    /**
+     * Offset of first invalid sequence by definition of UTF-8 from RFC 3629 or size of string, if it is valid
+     */
+    auto FindInvalidReference(const std::string &string) -> std::uint64_t {
+        std::uint64_t index = 0;
+
+        while (index < string.size()) {
+            auto lead = static_cast<unsigned char>(string[index]);
+
+            if (lead < 0x80) {
+                ++index;
+
+                continue;
+            }
+
+            std::uint64_t size = 0;
+            std::uint32_t codePoint = 0;
+
+            if (lead >= 0xc2 && lead <= 0xdf) {
+                size = 2;
+                codePoint = lead & 0x1f;
+            } else if (lead >= 0xe0 && lead <= 0xef) {
+                size = 3;
+                codePoint = lead & 0x0f;
+            } else if (lead >= 0xf0 && lead <= 0xf4) {
+                size = 4;
+                codePoint = lead & 0x07;
+            } else {
+                return index;
+            }
+
+            if (index + size > string.size()) {
+                return index;
+            }
+
+            for (std::uint64_t offset = 1; offset < size; ++offset) {
+                auto continuation = static_cast<unsigned char>(string[index + offset]);
+
+                if ((continuation & 0xc0) != 0x80) {
+                    return index;
+                }
+
+                codePoint = (codePoint << 6) | (continuation & 0x3f);
+            }
+
+            if ((size == 3 && codePoint < 0x800)
+                || (size == 4 && codePoint < 0x10000)
+                || codePoint > 0x10ffff
+                || (codePoint >= 0xd800 && codePoint <= 0xdfff)) {
+                return index;
+            }
+
+            index += size;
+        }
+
+        return string.size();
+    }
+
+    auto CheckValidation(const std::string &string) -> void {
+        auto offset = FindInvalidReference(string);
+        auto invalid = gstd::FindInvalidUtf8(string);
+
+        GSTD_CHECK(gstd::IsValidUtf8(string) == (offset == string.size()));
+        GSTD_CHECK(invalid.IsSome() == (offset != string.size()));
+
+        if (invalid.IsSome()) {
+            GSTD_CHECK(std::move(invalid).Unwrap() == offset);
+        }
+    }
+
+    auto RandomValidString(std::mt19937_64 &random,
+                           std::uint64_t size) -> std::string {
+        std::string string;
+
+        while (string.size() < size) {
+            auto kind = random() % 10;
+            gstd::CodePoint codePoint = kind < 5 ? random() % 0x80
+                                      : kind < 7 ? 0x80 + random() % 0x780
+                                      : kind < 9 ? 0x800 + random() % 0xf800
+                                      : 0x10000 + random() % 0x100000;
+
+            if (codePoint >= 0xd800 && codePoint <= 0xdfff) {
+                codePoint = 'A';
+            }
+
+            char buffer[4];
+
+            string.append(buffer,
+                          gstd::Symbol(codePoint).EncodeUtf8(buffer));
+        }
+
+        return string;
+    }
+
+    /**
+     * All pairs of bytes after ASCII prefix and before continuation bytes and ASCII tail,
+     * so sequences cross 32-byte halves of SIMD blocks
+     */
+    auto TestValidationPairs() -> void {
+        for (unsigned first = 0; first < 256; ++first) {
+            for (unsigned second = 0; second < 256; ++second) {
+                std::string string(30, 'a');
+
+                string += static_cast<char>(first);
+                string += static_cast<char>(second);
+
+                CheckValidation(string);
+
+                for (unsigned third : {0x41u, 0x80u, 0x9fu, 0xa0u, 0xbfu}) {
+                    auto extended = string;
+
+                    extended += static_cast<char>(third);
+                    extended += static_cast<char>(0x80);
+
+                    CheckValidation(extended);
+
+                    extended += std::string(40, 'q');
+
+                    CheckValidation(extended);
+                }
+            }
+        }
+    }
+
+    /**
+     * Valid strings with random bytes changed and random truncation
+     */
+    auto TestValidationMutations() -> void {
+        std::mt19937_64 random(1);
+
+        for (std::uint64_t iteration = 0; iteration < 20000; ++iteration) {
+            auto string = RandomValidString(random,
+                                            random() % 200);
+
+            CheckValidation(string);
+
+            if (!string.empty()) {
+                string[random() % string.size()] = static_cast<char>(random());
+
+                if (random() % 3 == 0) {
+                    string.resize(random() % string.size());
+                }
+            }
+
+            CheckValidation(string);
+        }
+    }
+
+    auto TestCodePoints() -> void {
+        std::mt19937_64 random(2);
+
+        for (std::uint64_t iteration = 0; iteration < 2000; ++iteration) {
+            auto string = RandomValidString(random,
+                                            random() % 300);
+            std::vector<gstd::CodePoint> expected;
+
+            for (std::uint64_t index = 0; index < string.size();) {
+                auto decoded = gstd::detail::DecodeUtf8(string.data() + index,
+                                                        string.data() + string.size());
+
+                expected.push_back(decoded.First());
+                index += decoded.Second();
+            }
+
+            std::vector<gstd::CodePoint> codePoints;
+
+            for (gstd::StringIterator iterator(string); iterator.has_next(); iterator.next()) {
+                codePoints.push_back(iterator.current().Value());
+            }
+
+            GSTD_CHECK(codePoints == expected);
+            GSTD_CHECK(gstd::CountCodePoints(string) == expected.size());
+
+            for (std::uint64_t index = 0; index < expected.size(); index += 7) {
+                auto offset = gstd::CodePointOffset(string,
+                                                    index);
+
+                GSTD_CHECK(offset.IsSome());
+                GSTD_CHECK(gstd::CodePointIndex(string,
+                                                std::move(offset).Unwrap()) == index);
+            }
+
+            GSTD_CHECK(gstd::CodePointOffset(string,
+                                             expected.size()).IsNone());
+        }
+
+        std::string invalid = "ab\xff" "cd";
+        std::vector<gstd::CodePoint> codePoints;
+
+        for (gstd::StringIterator iterator(invalid); iterator.has_next(); iterator.next()) {
+            codePoints.push_back(iterator.current().Value());
+        }
+
+        GSTD_CHECK((codePoints == std::vector<gstd::CodePoint> {'a', 'b', gstd::ReplacementCodePoint, 'c', 'd'}));
+    }
+
+}
+
+int main() {
+    for (auto level : {gstd::SimdLevel::AVX512, gstd::SimdLevel::Scalar}) {
+        gstd::LimitSimdLevel(level);
+
+        TestValidationPairs();
+        TestValidationMutations();
+        TestCodePoints();
+    }
+
+    return 0;
+}
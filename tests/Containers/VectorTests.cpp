@@ -0,0 +1,61 @@
+#include <string>
+
+#include <gstd/Containers/Vector.h>
+
+#include "../Test.h"
+
+namespace {
+
+    /**
+     * Appending own element to full vector: argument refers to old buffer, that is freed on growth
+     */
+    auto TestAppendOwnElement() -> void {
+        auto vector = gstd::Vector<std::string>::New();
+
+        vector.Append(std::string(64, 'a'));
+
+        while (vector.Size() < vector.Capacity()) {
+            vector.Append(std::string(64, 'b'));
+        }
+
+        auto capacity = vector.Capacity();
+
+        vector.Append(vector[0]);
+
+        GSTD_CHECK(vector.Capacity() > capacity);
+        GSTD_CHECK(vector[vector.Size() - 1] == std::string(64, 'a'));
+        GSTD_CHECK(vector[0] == std::string(64, 'a'));
+
+        for (std::uint64_t index = 0; index < 100; ++index) {
+            vector.Append(vector[vector.Size() - 1]);
+        }
+
+        GSTD_CHECK(vector[vector.Size() - 1] == std::string(64, 'a'));
+    }
+
+    /**
+     * Chunks after last element are empty, also when they are reserved after popping
+     */
+    auto TestStableVectorEmptyChunks() -> void {
+        auto vector = gstd::StableVector<int>::New();
+
+        vector.Append(1);
+        vector.Append(2);
+        vector.Pop();
+        vector.Reserve(vector.Capacity() * 4);
+
+        GSTD_CHECK(vector.Chunk(0).Size() == 1);
+
+        for (std::uint64_t index = 1; index < vector.ChunkCount(); ++index) {
+            GSTD_CHECK(vector.Chunk(index).Size() == 0);
+        }
+    }
+
+}
+
+int main() {
+    TestAppendOwnElement();
+    TestStableVectorEmptyChunks();
+
+    return 0;
+}
@@ -0,0 +1,179 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gstd/Parallel/Parallel.h>
+
+#include "../Test.h"
+
+namespace {
+
+    /**
+     * Sorting random integers with different grains: merges are split across threads by co-ranking
+     */
+    auto TestSortIntegers() -> void {
+        std::mt19937_64 random(1);
+
+        for (std::uint64_t size : {0, 1, 2, 3, 100, 4096, 100003}) {
+            for (std::uint64_t grain : {1, 7, 1000, 65536}) {
+                std::vector<std::int64_t> values(size);
+
+                for (auto &value : values) {
+                    value = static_cast<std::int64_t>(random() % 1000) - 500;
+                }
+
+                auto expected = values;
+
+                std::sort(expected.begin(),
+                          expected.end());
+
+                gstd::ParallelSort(gstd::Span<std::int64_t>(values.data(),
+                                                            values.size()),
+                                   std::less<>(),
+                                   grain);
+
+                GSTD_CHECK(values == expected);
+            }
+        }
+    }
+
+    /**
+     * Sorting by part of element: keys are sorted and elements are permutation of input
+     */
+    auto TestSortByKey() -> void {
+        std::mt19937_64 random(2);
+
+        for (std::uint64_t iteration = 0; iteration < 50; ++iteration) {
+            std::uint64_t size = random() % 20000;
+            std::vector<std::pair<int, int>> values(size);
+
+            for (std::uint64_t index = 0; index < size; ++index) {
+                values[index] = {static_cast<int>(random() % 50), static_cast<int>(index)};
+            }
+
+            auto expected = values;
+
+            std::sort(expected.begin(),
+                      expected.end());
+
+            gstd::ParallelSort(gstd::Span<std::pair<int, int>>(values.data(),
+                                                               values.size()),
+                               [] (const std::pair<int, int> &first,
+                                   const std::pair<int, int> &second) {
+                return first.first < second.first;
+            },
+                               1 + random() % 3000);
+
+            for (std::uint64_t index = 1; index < size; ++index) {
+                GSTD_CHECK(values[index - 1].first <= values[index].first);
+            }
+
+            std::sort(values.begin(),
+                      values.end());
+
+            GSTD_CHECK(values == expected);
+        }
+    }
+
+    auto TestSortStrings() -> void {
+        std::mt19937_64 random(3);
+        std::vector<std::string> values(50000);
+
+        for (auto &value : values) {
+            value = std::to_string(random() % 100000);
+        }
+
+        auto expected = values;
+
+        std::sort(expected.begin(),
+                  expected.end());
+
+        gstd::ParallelSort(gstd::Span<std::string>(values.data(),
+                                                   values.size()),
+                           std::less<>(),
+                           1000);
+
+        GSTD_CHECK(values == expected);
+    }
+
+    auto TestForReduceScan() -> void {
+        const std::uint64_t size = 100003;
+        std::mt19937_64 random(4);
+        std::vector<std::int64_t> values(size);
+
+        for (auto &value : values) {
+            value = static_cast<std::int64_t>(random() % 1000000) - 500000;
+        }
+
+        gstd::Span<std::int64_t> span(values.data(),
+                                      size);
+        std::vector<std::atomic<int>> hits(size);
+
+        gstd::ParallelFor(0,
+                          size,
+                          [&hits] (std::uint64_t index) {
+            ++hits[index];
+        });
+
+        for (auto &hit : hits) {
+            GSTD_CHECK(hit == 1);
+        }
+
+        GSTD_CHECK(gstd::ParallelReduce(span,
+                                        std::int64_t(7),
+                                        std::plus<>()) == std::accumulate(values.begin(),
+                                                                          values.end(),
+                                                                          std::int64_t(7)));
+
+        std::vector<std::int64_t> output(size);
+        std::vector<std::int64_t> expected(size);
+
+        gstd::ParallelInclusiveScan(span,
+                                    gstd::Span<std::int64_t>(output.data(),
+                                                             size),
+                                    std::plus<>());
+        std::inclusive_scan(values.begin(),
+                            values.end(),
+                            expected.begin());
+
+        GSTD_CHECK(output == expected);
+
+        gstd::ParallelExclusiveScan(span,
+                                    gstd::Span<std::int64_t>(output.data(),
+                                                             size),
+                                    std::int64_t(5),
+                                    std::plus<>());
+        std::exclusive_scan(values.begin(),
+                            values.end(),
+                            expected.begin(),
+                            std::int64_t(5));
+
+        GSTD_CHECK(output == expected);
+
+        gstd::ParallelTransform(span,
+                                gstd::Span<std::int64_t>(output.data(),
+                                                         size),
+                                [] (std::int64_t value) {
+            return value * 2;
+        });
+
+        for (std::uint64_t index = 0; index < size; ++index) {
+            GSTD_CHECK(output[index] == values[index] * 2);
+        }
+    }
+
+}
+
+int main() {
+    TestSortIntegers();
+    TestSortByKey();
+    TestSortStrings();
+    TestForReduceScan();
+
+    return 0;
+}
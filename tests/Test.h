@@ -0,0 +1,61 @@
+#ifndef GSTD_TEST_H
+#define GSTD_TEST_H
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include <gstd/Memory/Allocator.h>
+
+#define GSTD_CHECK(condition)                                                                          \
+    do {                                                                                               \
+        if (!(condition)) {                                                                            \
+            std::fprintf(stderr, "%s:%d: check `%s` failed!\n", __FILE__, __LINE__, #condition);       \
+            std::abort();                                                                              \
+        }                                                                                              \
+    } while (false)
+
+namespace gstd {
+
+    [[noreturn]] void Panic(const char *message) {
+        std::fprintf(stderr,
+                     "Panic: %s\n",
+                     message);
+        std::abort();
+    }
+
+    /**
+     * Allocator on global heap for tests
+     */
+    class HeapAllocator : public Allocator {
+    public:
+
+        HeapAllocator()
+                : Allocator(Span<Byte>(nullptr,
+                                       0)) {}
+
+    private:
+
+        auto DoAllocate(SizeType size,
+                        AlignmentType alignment) -> PointerType override {
+            return static_cast<PointerType>(::operator new(size == 0 ? 1 : size,
+                                                           std::align_val_t(alignment)));
+        }
+
+        auto DoDeallocate(PointerType pointer,
+                          SizeType,
+                          AlignmentType alignment) -> void override {
+            ::operator delete(pointer,
+                              std::align_val_t(alignment));
+        }
+    };
+
+    [[maybe_unused]] static auto DefaultAllocator() -> Allocator * {
+        static HeapAllocator allocator;
+
+        return &allocator;
+    }
+
+}
+
+#endif //GSTD_TEST_H